@@ -261,6 +261,7 @@ LOCAL_SRC_FILES                                          := \
     third_party/mbedtls/repo/library/ssl_ticket.c           \
     third_party/mbedtls/repo/library/ssl_tls.c              \
     third_party/mbedtls/repo/library/aes.c                  \
+    third_party/mbedtls/repo/library/aesni.c                \
     third_party/mbedtls/repo/library/ecp.c                  \
     $(NULL)
 
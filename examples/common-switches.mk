@@ -33,6 +33,9 @@ BORDER_AGENT        ?= 0
 BORDER_ROUTER       ?= 0
 COAP                ?= 0
 COAPS               ?= 0
+COAP_BLOCK          ?= 0
+COAP_CONGESTION     ?= 0
+COAP_COCOA          ?= 0
 COMMISSIONER        ?= 0
 COVERAGE            ?= 0
 CHANNEL_MANAGER     ?= 0
@@ -59,6 +62,7 @@ SETTINGS_RAM        ?= 0
 SLAAC               ?= 1
 SNTP_CLIENT         ?= 0
 TIME_SYNC           ?= 0
+TIMER_WHEEL         ?= 0
 UDP_FORWARD         ?= 0
 
 
@@ -82,6 +86,18 @@ ifeq ($(COAPS),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE=1
 endif
 
+ifeq ($(COAP_BLOCK),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE=1
+endif
+
+ifeq ($(COAP_CONGESTION),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE=1
+endif
+
+ifeq ($(COAP_COCOA),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_COCOA_ENABLE=1
+endif
+
 ifeq ($(COMMISSIONER),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COMMISSIONER_ENABLE=1
 endif
@@ -180,6 +196,10 @@ ifeq ($(TIME_SYNC),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_TIME_SYNC_ENABLE=1 -DOPENTHREAD_MAC_CONFIG_HEADER_IE_SUPPORT=1
 endif
 
+ifeq ($(TIMER_WHEEL),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE=1
+endif
+
 ifeq ($(UDP_FORWARD),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_UDP_FORWARD_ENABLE=1
 endif
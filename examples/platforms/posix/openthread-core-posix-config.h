@@ -126,4 +126,14 @@
  *
  */
 #define CLI_COAP_SECURE_USE_COAP_DEFAULT_HANDLER 1
+/**
+ * @def OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+ *
+ * Define as 1 to build the builtin mbedTLS with AES-NI support (selected at run time when the CPU supports it).
+ *
+ */
+#if !defined(OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE) && defined(__x86_64__)
+#define OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE 1
+#endif
+
 #endif // OPENTHREAD_CORE_POSIX_CONFIG_H_
@@ -324,7 +324,7 @@ static inline void getExtAddress(const uint8_t *aFrame, otExtAddress *aAddress)
     }
 }
 
-static uint16_t crc16_citt(uint16_t aFcs, uint8_t aByte)
+static uint16_t crc16_citt(uint16_t aFcs, const uint8_t *aData, uint16_t aLength)
 {
     // CRC-16/CCITT, CRC-16/CCITT-TRUE, CRC-CCITT
     // width=16 poly=0x1021 init=0x0000 refin=true refout=true xorout=0x0000 check=0x2189 name="KERMIT"
@@ -349,7 +349,13 @@ static uint16_t crc16_citt(uint16_t aFcs, uint8_t aByte)
         0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1, 0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb,
         0x0e70, 0x1ff9, 0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330, 0x7bc7, 0x6a4e, 0x58d5, 0x495c,
         0x3de3, 0x2c6a, 0x1ef1, 0x0f78};
-    return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff];
+
+    while (aLength--)
+    {
+        aFcs = (aFcs >> 8) ^ sFcsTable[(aFcs ^ *aData++) & 0xff];
+    }
+
+    return aFcs;
 }
 
 void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
@@ -681,13 +687,8 @@ exit:
 
 static void radioComputeCrc(struct RadioMessage *aMessage, uint16_t aLength)
 {
-    uint16_t crc        = 0;
     uint16_t crc_offset = aLength - sizeof(uint16_t);
-
-    for (uint16_t i = 0; i < crc_offset; i++)
-    {
-        crc = crc16_citt(crc, aMessage->mPsdu[i]);
-    }
+    uint16_t crc        = crc16_citt(0, aMessage->mPsdu, crc_offset);
 
     aMessage->mPsdu[crc_offset]     = crc & 0xff;
     aMessage->mPsdu[crc_offset + 1] = crc >> 8;
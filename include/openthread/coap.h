@@ -51,6 +51,8 @@ extern "C" {
  *   This module includes functions that control CoAP communication.
  *
  *   The functions in this module are available when CoAP API feature (`OPENTHREAD_CONFIG_COAP_API_ENABLE`) is enabled.
+ *   The block-wise transfer functions also require `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE`, and the peer
+ *   statistics require `OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE`.
  *
  * @{
  *
@@ -90,12 +92,13 @@ typedef enum otCoapCode
     OT_COAP_CODE_PUT    = OT_COAP_CODE(0, 3), ///< Put
     OT_COAP_CODE_DELETE = OT_COAP_CODE(0, 4), ///< Delete
 
-    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0), ///< 2.00
-    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1), ///< Created
-    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2), ///< Deleted
-    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3), ///< Valid
-    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4), ///< Changed
-    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5), ///< Content
+    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0),  ///< 2.00
+    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1),  ///< Created
+    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2),  ///< Deleted
+    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3),  ///< Valid
+    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4),  ///< Changed
+    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5),  ///< Content
+    OT_COAP_CODE_CONTINUE     = OT_COAP_CODE(2, 31), ///< Continue (RFC 7959)
 
     OT_COAP_CODE_BAD_REQUEST         = OT_COAP_CODE(4, 0),  ///< Bad Request
     OT_COAP_CODE_UNAUTHORIZED        = OT_COAP_CODE(4, 1),  ///< Unauthorized
@@ -104,6 +107,7 @@ typedef enum otCoapCode
     OT_COAP_CODE_NOT_FOUND           = OT_COAP_CODE(4, 4),  ///< Not Found
     OT_COAP_CODE_METHOD_NOT_ALLOWED  = OT_COAP_CODE(4, 5),  ///< Method Not Allowed
     OT_COAP_CODE_NOT_ACCEPTABLE      = OT_COAP_CODE(4, 6),  ///< Not Acceptable
+    OT_COAP_CODE_REQUEST_INCOMPLETE  = OT_COAP_CODE(4, 8),  ///< Request Entity Incomplete (RFC 7959)
     OT_COAP_CODE_PRECONDITION_FAILED = OT_COAP_CODE(4, 12), ///< Precondition Failed
     OT_COAP_CODE_REQUEST_TOO_LARGE   = OT_COAP_CODE(4, 13), ///< Request Entity Too Large
     OT_COAP_CODE_UNSUPPORTED_FORMAT  = OT_COAP_CODE(4, 15), ///< Unsupported Content-Format
@@ -134,6 +138,9 @@ typedef enum otCoapOptionType
     OT_COAP_OPTION_URI_QUERY      = 15, ///< Uri-Query
     OT_COAP_OPTION_ACCEPT         = 17, ///< Accept
     OT_COAP_OPTION_LOCATION_QUERY = 20, ///< Location-Query
+    OT_COAP_OPTION_BLOCK2         = 23, ///< Block2 (RFC 7959)
+    OT_COAP_OPTION_BLOCK1         = 27, ///< Block1 (RFC 7959)
+    OT_COAP_OPTION_SIZE2          = 28, ///< Size2 (RFC 7959)
     OT_COAP_OPTION_PROXY_URI      = 35, ///< Proxy-Uri
     OT_COAP_OPTION_PROXY_SCHEME   = 39, ///< Proxy-Scheme
     OT_COAP_OPTION_SIZE1          = 60, ///< Size1
@@ -292,6 +299,21 @@ typedef enum otCoapOptionContentFormat
     OT_COAP_OPTION_CONTENT_FORMAT_SENSML_XML = 311
 } otCoapOptionContentFormat;
 
+/**
+ * CoAP block sizes of block-wise transfers (RFC 7959).
+ *
+ */
+typedef enum otCoapBlockSize
+{
+    OT_COAP_BLOCK_SIZE_16   = 0, ///< 16 bytes
+    OT_COAP_BLOCK_SIZE_32   = 1, ///< 32 bytes
+    OT_COAP_BLOCK_SIZE_64   = 2, ///< 64 bytes
+    OT_COAP_BLOCK_SIZE_128  = 3, ///< 128 bytes
+    OT_COAP_BLOCK_SIZE_256  = 4, ///< 256 bytes
+    OT_COAP_BLOCK_SIZE_512  = 5, ///< 512 bytes
+    OT_COAP_BLOCK_SIZE_1024 = 6, ///< 1024 bytes
+} otCoapBlockSize;
+
 /**
  * This function pointer is called when a CoAP response is received or on the request timeout.
  *
@@ -320,6 +342,50 @@ typedef void (*otCoapResponseHandler)(void *               aContext,
  */
 typedef void (*otCoapRequestHandler)(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function pointer is called to produce a block of a block-wise transfer.
+ *
+ * The payload is produced in order, one block at a time, so that the whole payload never needs to be buffered.
+ *
+ * @param[in]   aContext    A pointer to application-specific context.
+ * @param[in]   aMessage    A pointer to the message to append the block to.
+ * @param[in]   aPosition   The position of the block within the whole payload, in bytes.
+ * @param[in]   aBlockSize  The block size. Exactly @p aBlockSize bytes must be appended unless it is the last block,
+ *                          which may be shorter.
+ * @param[out]  aMore       Set to TRUE if more blocks follow this one, FALSE if it is the last one.
+ *
+ * @retval OT_ERROR_NONE  Successfully appended the block.
+ * @retval ...            Failed to produce the block, the transfer is aborted.
+ *
+ */
+typedef otError (*otCoapBlockwiseTransmitHook)(void *     aContext,
+                                               otMessage *aMessage,
+                                               uint32_t   aPosition,
+                                               uint16_t   aBlockSize,
+                                               bool *     aMore);
+
+/**
+ * This function pointer is called when a block of a block-wise transfer is received.
+ *
+ * The block is read from @p aMessage, starting at its offset (see otMessageGetOffset()).
+ *
+ * @param[in]  aContext   A pointer to application-specific context.
+ * @param[in]  aMessage   A pointer to the message carrying the block.
+ * @param[in]  aPosition  The position of the block within the whole payload, in bytes.
+ * @param[in]  aLength    The length of the block, in bytes.
+ * @param[in]  aMore      TRUE if more blocks follow this one, FALSE if it is the last one.
+ *
+ * @retval OT_ERROR_NONE     Successfully consumed the block.
+ * @retval OT_ERROR_NO_BUFS  The payload is too large, the transfer is aborted.
+ * @retval ...               Failed to consume the block (e.g. it is out of order), the transfer is aborted.
+ *
+ */
+typedef otError (*otCoapBlockwiseReceiveHook)(void *           aContext,
+                                              const otMessage *aMessage,
+                                              uint32_t         aPosition,
+                                              uint16_t         aLength,
+                                              bool             aMore);
+
 /**
  * This structure represents a CoAP resource.
  *
@@ -332,6 +398,25 @@ typedef struct otCoapResource
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
 } otCoapResource;
 
+#define OT_COAP_PEER_STATS_ITERATOR_INIT 0 ///< Initializer for otCoapPeerStatsIterator.
+
+typedef uint8_t otCoapPeerStatsIterator; ///< Used to iterate through the CoAP peers.
+
+/**
+ * This structure represents the congestion control state and statistics of a CoAP peer.
+ *
+ */
+typedef struct otCoapPeerStats
+{
+    otIp6Address mPeerAddress;           ///< The IPv6 address of the peer
+    uint16_t     mPeerPort;              ///< The UDP port of the peer
+    uint8_t      mNumInFlight;           ///< Number of outstanding confirmable messages to the peer
+    uint16_t     mNumDeferred;           ///< Number of confirmable messages to the peer awaiting NSTART
+    uint32_t     mRetransmissionTimeout; ///< Retransmission timeout of the next message to the peer (ms)
+    uint32_t     mNumTransmissions;      ///< Number of confirmable messages sent to the peer
+    uint32_t     mNumRetransmissions;    ///< Number of retransmissions to the peer
+} otCoapPeerStats;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -660,6 +745,21 @@ otError otCoapStop(otInstance *aInstance);
  */
 otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function adds an array of resources to the CoAP server.
+ *
+ * Resources of @p aResources that were already added are skipped, the others are still added.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aResources     A pointer to an array of resources.
+ * @param[in]  aNumResources  The number of resources in @p aResources.
+ *
+ * @retval OT_ERROR_NONE     Successfully added all of @p aResources.
+ * @retval OT_ERROR_ALREADY  One or more of @p aResources were already added.
+ *
+ */
+otError otCoapAddResources(otInstance *aInstance, otCoapResource *aResources, uint8_t aNumResources);
+
 /**
  * This function removes a resource from the CoAP server.
  *
@@ -692,6 +792,120 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
  */
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function sends a CoAP request whose request and/or response payload is transferred block-wise (RFC 7959).
+ *
+ * @p aMessage holds the request header only: it must not have a payload nor options numbered Block2 or higher.
+ *
+ * If @p aTransmitHook is not NULL, the request payload is produced by @p aTransmitHook and sent in Block1 blocks of
+ * @p aBlockSize. Each block is a separate confirmable request, sent once the previous one was acknowledged with a
+ * 2.31 (Continue) response.
+ *
+ * If @p aReceiveHook is not NULL, the payload of successful responses is passed to @p aReceiveHook. Responses
+ * carrying a Block2 option are followed by requests for the next block until the last one is received.
+ *
+ * @p aHandler is called once the transfer completes, with the last response, or if any block fails.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the confirmable request to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aBlockSize     The block size of the request payload, and the preferred one of the response payload.
+ * @param[in]  aTransmitHook  A function pointer that is called to produce the request payload, or NULL.
+ * @param[in]  aReceiveHook   A function pointer that is called with the response payload, or NULL.
+ * @param[in]  aHandler       A function pointer that shall be called once the transfer completes or fails.
+ * @param[in]  aContext       A pointer to arbitrary context information, passed to all of the above functions.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent the first block.
+ * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a confirmable request, or both hooks are NULL.
+ * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the first block.
+ *
+ */
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapBlockSize             aBlockSize,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext);
+
+/**
+ * This function sends the block of a CoAP response payload requested by the Block2 option of a request (RFC 7959).
+ *
+ * @p aMessage holds the response header only: it must not have a payload nor options numbered Block2 or higher.
+ * The block is produced by @p aTransmitHook, in the smaller of @p aBlockSize and the block size of the request.
+ *
+ * No state is kept between blocks: each request for a block is handled by the resource as a new request.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the CoAP response to send.
+ * @param[in]  aRequest       A pointer to the CoAP request @p aMessage responds to.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aBlockSize     The largest block size to send.
+ * @param[in]  aTransmitHook  A function pointer that is called to produce the block.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+ *
+ * @retval OT_ERROR_NONE     Successfully enqueued the CoAP response message.
+ * @retval OT_ERROR_PARSE    The Block2 option of @p aRequest is malformed.
+ * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+ *
+ */
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    otMessage *                 aRequest,
+                                    const otMessageInfo *       aMessageInfo,
+                                    otCoapBlockSize             aBlockSize,
+                                    otCoapBlockwiseTransmitHook aTransmitHook,
+                                    void *                      aContext);
+
+/**
+ * This function passes the payload of a received CoAP request to a block-wise consumer (RFC 7959).
+ *
+ * A request without a Block1 option is passed as a single block. A block that is not the last one is acknowledged
+ * with a 2.31 (Continue) response asking for the next block. A block rejected by @p aReceiveHook is answered with a
+ * 4.13 (Request Entity Too Large) response if it returned OT_ERROR_NO_BUFS, 4.08 (Request Entity Incomplete)
+ * otherwise.
+ *
+ * The request handler sends its own response only once this function succeeded with @p aMore set to FALSE.
+ *
+ * @param[in]   aInstance     A pointer to an OpenThread instance.
+ * @param[in]   aRequest      A pointer to the received CoAP request.
+ * @param[in]   aMessageInfo  A pointer to the message info associated with @p aRequest.
+ * @param[in]   aReceiveHook  A function pointer that is called with the block.
+ * @param[in]   aContext      A pointer to arbitrary context information passed to @p aReceiveHook.
+ * @param[out]  aMore         Set to TRUE if more blocks follow, FALSE if the whole payload was received.
+ *
+ * @retval OT_ERROR_NONE     Successfully passed the block to @p aReceiveHook.
+ * @retval OT_ERROR_PARSE    The Block1 option of @p aRequest is malformed, a 4.00 (Bad Request) response was sent.
+ * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the 2.31 (Continue) response.
+ * @retval ...               The error returned by @p aReceiveHook.
+ *
+ */
+otError otCoapReceiveRequestBlockWise(otInstance *               aInstance,
+                                      otMessage *                aRequest,
+                                      const otMessageInfo *      aMessageInfo,
+                                      otCoapBlockwiseReceiveHook aReceiveHook,
+                                      void *                     aContext,
+                                      bool *                     aMore);
+
+/**
+ * This function gets the congestion control state and statistics of the next CoAP peer.
+ *
+ * The CoAP agent keeps the state of up to `OPENTHREAD_CONFIG_COAP_MAX_PEERS` recently used peers. The retransmission
+ * timeout is the one the next confirmable message to the peer starts from, before randomization. It is adapted to the
+ * measured round-trip times when `OPENTHREAD_CONFIG_COAP_COCOA_ENABLE` is set.
+ *
+ * @param[in]     aInstance  A pointer to an OpenThread instance.
+ * @param[inout]  aIterator  A pointer to the iterator context. To get the first peer it should be set to
+ *                           OT_COAP_PEER_STATS_ITERATOR_INIT.
+ * @param[out]    aStats     A pointer to where the peer state and statistics are placed.
+ *
+ * @retval OT_ERROR_NONE       Successfully found the next peer.
+ * @retval OT_ERROR_NOT_FOUND  No subsequent peer exists.
+ *
+ */
+otError otCoapGetNextPeerStats(otInstance *aInstance, otCoapPeerStatsIterator *aIterator, otCoapPeerStats *aStats);
+
 /**
  * @}
  *
@@ -86,6 +86,12 @@ typedef struct otBufferInfo
     uint16_t mCoapSecureBuffers;       ///< The number of buffers in the CoAP secure send queue.
     uint16_t mApplicationCoapMessages; ///< The number of messages in the application CoAP send queue.
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
+    uint16_t mMaxUsedBuffers;          ///< The largest number of message buffers in use at the same time.
+    uint16_t mTotalLargeBuffers;       ///< The number of large buffers in the pool.
+    uint16_t mFreeLargeBuffers;        ///< The number of free large message buffers.
+    uint16_t mMaxUsedLargeBuffers;     ///< The largest number of large message buffers in use at the same time.
+    uint16_t mFallbackAllocations;     ///< The number of allocations served from the non-preferred buffer class.
+    uint16_t mFailedAllocations;       ///< The number of buffer allocations that failed.
 } otBufferInfo;
 
 /**
@@ -653,6 +653,48 @@ otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress a
  */
 otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress);
 
+/**
+ * Add short addresses to the source address match table.
+ *
+ * The entries are added in order, stopping at the first one which cannot be added. A default implementation calling
+ * otPlatRadioAddSrcMatchShortEntry() for each entry is provided, a platform with a remote radio may override it to
+ * write the entries in one burst.
+ *
+ * @param[in]   aInstance        The OpenThread instance structure.
+ * @param[in]   aShortAddresses  A pointer to the short addresses to be added.
+ * @param[in]   aNumEntries      The number of short addresses in @p aShortAddresses.
+ * @param[out]  aNumAdded        A pointer to where the number of leading entries that were added is placed.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all short addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint8_t               aNumEntries,
+                                           uint8_t *             aNumAdded);
+
+/**
+ * Add extended addresses to the source address match table.
+ *
+ * The entries are added in order, stopping at the first one which cannot be added. A default implementation calling
+ * otPlatRadioAddSrcMatchExtEntry() for each entry is provided, a platform with a remote radio may override it to
+ * write the entries in one burst.
+ *
+ * @param[in]   aInstance      The OpenThread instance structure.
+ * @param[in]   aExtAddresses  A pointer to the extended addresses to be added stored in little-endian byte order.
+ * @param[in]   aNumEntries    The number of extended addresses in @p aExtAddresses.
+ * @param[out]  aNumAdded      A pointer to where the number of leading entries that were added is placed.
+ *
+ * @retval OT_ERROR_NONE      Successfully added all extended addresses to the source match table.
+ * @retval OT_ERROR_NO_BUFS   No available entry in the source match table.
+ *
+ */
+otError otPlatRadioAddSrcMatchExtEntries(otInstance *        aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint8_t             aNumEntries,
+                                         uint8_t *           aNumAdded);
+
 /**
  * Remove a short address from the source address match table.
  *
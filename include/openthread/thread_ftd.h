@@ -89,7 +89,7 @@ typedef struct otEidCacheEntry
 {
     otIp6Address   mTarget;    ///< Target
     otShortAddress mRloc16;    ///< RLOC16
-    uint8_t        mAge;       ///< Age (order of use, 0 indicates most recently used entry)
+    uint16_t       mAge;       ///< Age (order of use, 0 indicates most recently used entry)
     bool           mValid : 1; ///< Indicates whether or not the cache entry is valid
 } otEidCacheEntry;
 
@@ -518,7 +518,7 @@ otError otThreadGetRouterInfo(otInstance *aInstance, uint16_t aRouterId, otRoute
  * @retval OT_ERROR_INVALID_ARGS  @p aIndex was out of bounds or @p aEntry was NULL.
  *
  */
-otError otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry);
+otError otThreadGetEidCacheEntry(otInstance *aInstance, uint16_t aIndex, otEidCacheEntry *aEntry);
 
 /**
  * Get the thrPSKc.
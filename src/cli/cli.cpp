@@ -424,6 +424,17 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
 
     mServer->OutputFormat("total: %d\r\n", bufferInfo.mTotalBuffers);
     mServer->OutputFormat("free: %d\r\n", bufferInfo.mFreeBuffers);
+    mServer->OutputFormat("max used: %d\r\n", bufferInfo.mMaxUsedBuffers);
+
+    if (bufferInfo.mTotalLargeBuffers > 0)
+    {
+        mServer->OutputFormat("large total: %d\r\n", bufferInfo.mTotalLargeBuffers);
+        mServer->OutputFormat("large free: %d\r\n", bufferInfo.mFreeLargeBuffers);
+        mServer->OutputFormat("large max used: %d\r\n", bufferInfo.mMaxUsedLargeBuffers);
+        mServer->OutputFormat("fallback allocs: %d\r\n", bufferInfo.mFallbackAllocations);
+    }
+
+    mServer->OutputFormat("failed allocs: %d\r\n", bufferInfo.mFailedAllocations);
     mServer->OutputFormat("6lo send: %d %d\r\n", bufferInfo.m6loSendMessages, bufferInfo.m6loSendBuffers);
     mServer->OutputFormat("6lo reas: %d %d\r\n", bufferInfo.m6loReassemblyMessages, bufferInfo.m6loReassemblyBuffers);
     mServer->OutputFormat("ip6: %d %d\r\n", bufferInfo.mIp6Messages, bufferInfo.mIp6Buffers);
@@ -1019,7 +1030,7 @@ void Interpreter::ProcessEidCache(int argc, char *argv[])
 
     otEidCacheEntry entry;
 
-    for (uint8_t i = 0;; i++)
+    for (uint16_t i = 0;; i++)
     {
         SuccessOrExit(otThreadGetEidCacheEntry(mInstance, i, &entry));
 
@@ -203,6 +203,13 @@ otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource)
     return instance.GetApplicationCoap().AddResource(*static_cast<Coap::Resource *>(aResource));
 }
 
+otError otCoapAddResources(otInstance *aInstance, otCoapResource *aResources, uint8_t aNumResources)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AddResources(static_cast<Coap::Resource *>(aResources), aNumResources);
+}
+
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -225,4 +232,60 @@ otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otM
                                                      *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapBlockSize             aBlockSize,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendRequestBlockWise(
+        *static_cast<Coap::Message *>(aMessage), *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aBlockSize,
+        aTransmitHook, aReceiveHook, aHandler, aContext);
+}
+
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    otMessage *                 aRequest,
+                                    const otMessageInfo *       aMessageInfo,
+                                    otCoapBlockSize             aBlockSize,
+                                    otCoapBlockwiseTransmitHook aTransmitHook,
+                                    void *                      aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendResponseBlockWise(
+        *static_cast<Coap::Message *>(aMessage), *static_cast<Coap::Message *>(aRequest),
+        *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aBlockSize, aTransmitHook, aContext);
+}
+
+otError otCoapReceiveRequestBlockWise(otInstance *               aInstance,
+                                      otMessage *                aRequest,
+                                      const otMessageInfo *      aMessageInfo,
+                                      otCoapBlockwiseReceiveHook aReceiveHook,
+                                      void *                     aContext,
+                                      bool *                     aMore)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().ReceiveRequestBlockWise(*static_cast<Coap::Message *>(aRequest),
+                                                                 *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                                                 aReceiveHook, aContext, *aMore);
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+otError otCoapGetNextPeerStats(otInstance *aInstance, otCoapPeerStatsIterator *aIterator, otCoapPeerStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().GetNextPeerStats(*aIterator, *aStats);
+}
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
 #endif // OPENTHREAD_CONFIG_COAP_API_ENABLE
@@ -72,12 +72,13 @@ void otCryptoAesCcm(const uint8_t *aKey,
                     bool           aEncrypt,
                     void *         aTag)
 {
-    AesCcm  aesCcm;
-    uint8_t tagLength;
+    KeyScheduleCache<1> keyScheduleCache;
+    AesCcm              aesCcm;
+    uint8_t             tagLength;
 
     assert((aKey != NULL) && (aNonce != NULL) && (aPlainText != NULL) && (aCipherText != NULL) && (aTag != NULL));
 
-    aesCcm.SetKey(aKey, aKeyLength);
+    aesCcm.SetKey(aKey, aKeyLength, keyScheduleCache);
     SuccessOrExit(aesCcm.Init(aHeaderLength, aLength, aTagLength, aNonce, aNonceLength));
 
     if (aHeaderLength != 0)
@@ -171,7 +171,15 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     aBufferInfo->mTotalBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 
-    aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
+    aBufferInfo->mFreeBuffers    = instance.Get<MessagePool>().GetFreeBufferCount();
+    aBufferInfo->mMaxUsedBuffers = instance.Get<MessagePool>().GetMaxUsedBufferCount();
+
+    aBufferInfo->mTotalLargeBuffers   = OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS;
+    aBufferInfo->mFreeLargeBuffers    = instance.Get<MessagePool>().GetFreeLargeBufferCount();
+    aBufferInfo->mMaxUsedLargeBuffers = instance.Get<MessagePool>().GetMaxUsedLargeBufferCount();
+
+    aBufferInfo->mFallbackAllocations = instance.Get<MessagePool>().GetFallbackAllocationCount();
+    aBufferInfo->mFailedAllocations   = instance.Get<MessagePool>().GetFailedAllocationCount();
 
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
@@ -312,7 +312,7 @@ exit:
     return error;
 }
 
-otError otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry)
+otError otThreadGetEidCacheEntry(otInstance *aInstance, uint16_t aIndex, otEidCacheEntry *aEntry)
 {
     otError   error;
     Instance &instance = *static_cast<Instance *>(aInstance);
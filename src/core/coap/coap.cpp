@@ -48,8 +48,13 @@ namespace Coap {
 
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
+    , mNumUnindexedRequests(0)
     , mRetransmissionTimer(aInstance, &Coap::HandleRetransmissionTimer, this)
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    , mNumDeferredMessages(0)
+#endif
     , mResources(NULL)
+    , mNumUnindexedResources(0)
     , mContext(NULL)
     , mInterceptor(NULL)
     , mResponsesQueue(aInstance)
@@ -81,7 +86,9 @@ void CoapBase::ClearRequestsAndResponses(void)
 
 otError CoapBase::AddResource(Resource &aResource)
 {
-    otError error = OT_ERROR_NONE;
+    otError   error = OT_ERROR_NONE;
+    uint16_t  key;
+    Resource *indexed;
 
     for (Resource *cur = mResources; cur; cur = cur->GetNext())
     {
@@ -91,25 +98,79 @@ otError CoapBase::AddResource(Resource &aResource)
     aResource.mNext = mResources;
     mResources      = &aResource;
 
+    // Only the first resource in `mResources` with a given URI path is indexed. The new resource takes the place of
+    // an older one sharing its URI path.
+    key = GetUriPathKey(aResource.mUriPath);
+
+    if ((indexed = FindIndexedResource(aResource.mUriPath, key)) != NULL)
+    {
+        mResourceIndex.Remove(*indexed, key);
+        mNumUnindexedResources++;
+    }
+
+    if (!mResourceIndex.Add(aResource, key))
+    {
+        mNumUnindexedResources++;
+    }
+
 exit:
     return error;
 }
 
+otError CoapBase::AddResources(Resource *aResources, uint8_t aNumResources)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (uint8_t i = 0; i < aNumResources; i++)
+    {
+        if (AddResource(aResources[i]) != OT_ERROR_NONE)
+        {
+            error = OT_ERROR_ALREADY;
+        }
+    }
+
+    return error;
+}
+
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    if (mResources == &aResource)
+    Resource *prev = NULL;
+    Resource *cur  = mResources;
+
+    while (cur != NULL && cur != &aResource)
+    {
+        prev = cur;
+        cur  = cur->GetNext();
+    }
+
+    VerifyOrExit(cur != NULL);
+
+    if (prev == NULL)
     {
         mResources = aResource.GetNext();
     }
     else
     {
-        for (Resource *cur = mResources; cur; cur = cur->GetNext())
+        prev->mNext = aResource.mNext;
+    }
+
+    if (!mResourceIndex.Remove(aResource, GetUriPathKey(aResource.mUriPath)))
+    {
+        mNumUnindexedResources--;
+        ExitNow();
+    }
+
+    // Index a resource that is not in the index, unless an earlier resource with the same URI path already is. As
+    // `mResources` is walked from its head, this indexes the first resource with a given URI path.
+    for (cur = mResources; mNumUnindexedResources > 0 && cur != NULL; cur = cur->GetNext())
+    {
+        uint16_t key = GetUriPathKey(cur->mUriPath);
+
+        if (!mResourceIndex.Contains(*cur, key) && FindIndexedResource(cur->mUriPath, key) == NULL)
         {
-            if (cur->mNext == &aResource)
-            {
-                cur->mNext = aResource.mNext;
-                ExitNow();
-            }
+            mResourceIndex.Add(*cur, key);
+            mNumUnindexedResources--;
+            break;
         }
     }
 
@@ -117,6 +178,56 @@ exit:
     aResource.mNext = NULL;
 }
 
+Resource *CoapBase::FindIndexedResource(const char *aUriPath, uint16_t aKey) const
+{
+    Resource *resource;
+
+    HashIndex<Resource, kMaxIndexedResources>::Iterator iterator;
+
+    for (resource = mResourceIndex.GetFirst(aKey, iterator); resource != NULL;
+         resource = mResourceIndex.GetNext(aKey, iterator))
+    {
+        if (strcmp(resource->mUriPath, aUriPath) == 0)
+        {
+            break;
+        }
+    }
+
+    return resource;
+}
+
+const Resource *CoapBase::FindResource(const char *aUriPath) const
+{
+    // The indexed resource with a URI path is the first one in `mResources`, so it takes precedence as before.
+    const Resource *resource = FindIndexedResource(aUriPath, GetUriPathKey(aUriPath));
+
+    VerifyOrExit(resource == NULL && mNumUnindexedResources > 0);
+
+    // Resources that are not indexed are matched one after another.
+    for (resource = mResources; resource != NULL; resource = resource->GetNext())
+    {
+        if (strcmp(resource->mUriPath, aUriPath) == 0)
+        {
+            break;
+        }
+    }
+
+exit:
+    return resource;
+}
+
+uint16_t CoapBase::GetUriPathKey(const char *aUriPath)
+{
+    uint16_t key = 0x811c;
+
+    for (; *aUriPath != '\0'; aUriPath++)
+    {
+        key = static_cast<uint16_t>((key ^ static_cast<uint8_t>(*aUriPath)) * 0x0193);
+    }
+
+    return key;
+}
+
 void CoapBase::SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext)
 {
     mDefaultHandler        = aHandler;
@@ -139,17 +250,11 @@ otError CoapBase::SendMessage(Message &               aMessage,
                               otCoapResponseHandler   aHandler,
                               void *                  aContext)
 {
-    otError      error;
+    otError      error      = OT_ERROR_NONE;
     CoapMetadata coapMetadata;
     Message *    storedCopy = NULL;
     uint16_t     copyLength = 0;
 
-    if ((aMessage.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || aMessage.GetType() == OT_COAP_TYPE_RESET) &&
-        aMessage.GetCode() != OT_COAP_CODE_EMPTY)
-    {
-        mResponsesQueue.EnqueueResponse(aMessage, aMessageInfo);
-    }
-
     // Set Message Id if it was not already set.
     if (aMessage.GetMessageId() == 0 &&
         (aMessage.GetType() == OT_COAP_TYPE_CONFIRMABLE || aMessage.GetType() == OT_COAP_TYPE_NON_CONFIRMABLE))
@@ -159,6 +264,13 @@ otError CoapBase::SendMessage(Message &               aMessage,
 
     aMessage.Finish();
 
+    // Cache the response only once its header is written, so that the cached copy can be resent as is.
+    if ((aMessage.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || aMessage.GetType() == OT_COAP_TYPE_RESET) &&
+        aMessage.GetCode() != OT_COAP_CODE_EMPTY)
+    {
+        mResponsesQueue.EnqueueResponse(aMessage, aMessageInfo);
+    }
+
     if (aMessage.IsConfirmable())
     {
         // Create a copy of entire message and enqueue it.
@@ -177,18 +289,374 @@ otError CoapBase::SendMessage(Message &               aMessage,
                      error = OT_ERROR_NO_BUFS);
     }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    if (coapMetadata.mDeferred)
+    {
+        // The stored copy is sent once the peer has fewer outstanding messages.
+        aMessage.Free();
+        ExitNow();
+    }
+#endif
+
     SuccessOrExit(error = Send(aMessage, aMessageInfo));
 
 exit:
 
     if (error != OT_ERROR_NONE && storedCopy != NULL)
     {
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        EndInteraction(coapMetadata, false);
+#endif
         DequeueMessage(*storedCopy);
     }
 
     return error;
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError CoapBase::SendRequestBlockWise(Message &                   aMessage,
+                                       const Ip6::MessageInfo &    aMessageInfo,
+                                       otCoapBlockSize             aBlockSize,
+                                       otCoapBlockwiseTransmitHook aTransmitHook,
+                                       otCoapBlockwiseReceiveHook  aReceiveHook,
+                                       otCoapResponseHandler       aHandler,
+                                       void *                      aContext)
+{
+    otError      error = OT_ERROR_NONE;
+    CoapMetadata transfer;
+
+    VerifyOrExit(aMessage.IsConfirmable() && aMessage.IsRequest(), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aTransmitHook != NULL || aReceiveHook != NULL, error = OT_ERROR_INVALID_ARGS);
+
+    transfer.mResponseHandler       = aHandler;
+    transfer.mResponseContext       = aContext;
+    transfer.mBlockwiseTransmitHook = aTransmitHook;
+    transfer.mBlockwiseReceiveHook  = aReceiveHook;
+    transfer.mBlockwiseHeaderLength = aMessage.GetLength();
+
+    // Without a request payload, a Block2 option tells the server the preferred block size (RFC 7959, 2.4).
+    error = SendRequestBlock(aMessage, aMessageInfo, transfer,
+                             (aTransmitHook != NULL) ? OT_COAP_OPTION_BLOCK1 : OT_COAP_OPTION_BLOCK2, 0, aBlockSize);
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendResponseBlockWise(Message &                   aMessage,
+                                        Message &                   aRequest,
+                                        const Ip6::MessageInfo &    aMessageInfo,
+                                        otCoapBlockSize             aBlockSize,
+                                        otCoapBlockwiseTransmitHook aTransmitHook,
+                                        void *                      aContext)
+{
+    otError         error;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize blockSize;
+
+    switch (error = aRequest.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, blockSize))
+    {
+    case OT_ERROR_NONE:
+        // Serve the requested position in the smaller of both block sizes (RFC 7959, 2.4).
+        if (blockSize > aBlockSize)
+        {
+            num <<= (blockSize - aBlockSize);
+        }
+        else
+        {
+            aBlockSize = blockSize;
+        }
+
+        break;
+
+    case OT_ERROR_NOT_FOUND:
+        num = 0;
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    SuccessOrExit(error = AppendBlock(aMessage, OT_COAP_OPTION_BLOCK2, num, aBlockSize, aTransmitHook, aContext));
+    error = SendMessage(aMessage, aMessageInfo);
+
+exit:
+    return error;
+}
+
+otError CoapBase::ReceiveRequestBlockWise(Message &                  aRequest,
+                                          const Ip6::MessageInfo &   aMessageInfo,
+                                          otCoapBlockwiseReceiveHook aReceiveHook,
+                                          void *                     aContext,
+                                          bool &                     aMore)
+{
+    otError         error;
+    uint32_t        num       = 0;
+    otCoapBlockSize blockSize = OT_COAP_BLOCK_SIZE_16;
+    uint16_t        length    = aRequest.GetLength() - aRequest.GetOffset();
+    Message *       response  = NULL;
+
+    aMore = false;
+
+    error = aRequest.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, aMore, blockSize);
+
+    if (error == OT_ERROR_NOT_FOUND)
+    {
+        error = OT_ERROR_NONE;
+    }
+
+    // Every block but the last one has the block size (RFC 7959, 2.2).
+    if (error != OT_ERROR_NONE || (aMore && length != Message::GetBlockLength(blockSize)))
+    {
+        SendHeaderResponse(OT_COAP_CODE_BAD_REQUEST, aRequest, aMessageInfo);
+        ExitNow(error = OT_ERROR_PARSE);
+    }
+
+    error = aReceiveHook(aContext, &aRequest, num * Message::GetBlockLength(blockSize), length, aMore);
+
+    if (error != OT_ERROR_NONE)
+    {
+        SendHeaderResponse((error == OT_ERROR_NO_BUFS) ? OT_COAP_CODE_REQUEST_TOO_LARGE
+                                                       : OT_COAP_CODE_REQUEST_INCOMPLETE,
+                           aRequest, aMessageInfo);
+        ExitNow();
+    }
+
+    VerifyOrExit(aMore);
+
+    // Acknowledge the block, the request handler responds once the last block is received.
+    VerifyOrExit((response = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = response->SetDefaultResponseHeader(aRequest));
+    response->SetCode(OT_COAP_CODE_CONTINUE);
+
+    if (aRequest.IsNonConfirmable())
+    {
+        response->SetType(OT_COAP_TYPE_NON_CONFIRMABLE);
+        response->SetMessageId(0);
+    }
+
+    SuccessOrExit(error = response->AppendBlockOption(OT_COAP_OPTION_BLOCK1, num, true, blockSize));
+    SuccessOrExit(error = SendMessage(*response, aMessageInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && response != NULL)
+    {
+        response->Free();
+    }
+
+    return error;
+}
+
+bool CoapBase::ProcessBlockwiseResponse(Message &           aRequest,
+                                        const CoapMetadata &aCoapMetadata,
+                                        Message &           aResponse,
+                                        otError &           aError)
+{
+    bool            sent = false;
+    uint32_t        requestNum;
+    bool            requestMore;
+    otCoapBlockSize requestBlockSize;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize blockSize;
+    uint32_t        position = 0;
+
+    aError = OT_ERROR_NONE;
+
+    // Drop the metadata so that the options of the request can be parsed, the request is dequeued afterwards.
+    aRequest.SetLength(aRequest.GetLength() - sizeof(CoapMetadata));
+
+    if (aRequest.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, requestNum, requestMore, requestBlockSize) ==
+            OT_ERROR_NONE &&
+        requestMore)
+    {
+        // Any other response than 2.31 (Continue) ends the transfer early.
+        VerifyOrExit(aResponse.GetCode() == OT_COAP_CODE_CONTINUE);
+
+        SuccessOrExit(aError = aResponse.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, blockSize));
+        VerifyOrExit(num == requestNum, aError = OT_ERROR_PARSE);
+
+        // Send the rest in smaller blocks if the server asks for them (RFC 7959, 2.5).
+        if (blockSize > requestBlockSize)
+        {
+            blockSize = requestBlockSize;
+        }
+
+        aError = SendNextRequestBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK1,
+                                      (requestNum + 1) << (requestBlockSize - blockSize), blockSize);
+        sent   = (aError == OT_ERROR_NONE);
+        ExitNow();
+    }
+
+    // Only successful responses carry the requested payload.
+    VerifyOrExit(aCoapMetadata.mBlockwiseReceiveHook != NULL);
+    VerifyOrExit(aResponse.GetCode() >= OT_COAP_CODE_RESPONSE_MIN && aResponse.GetCode() < OT_COAP_CODE_BAD_REQUEST);
+
+    if (aRequest.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, requestNum, requestMore, requestBlockSize) ==
+        OT_ERROR_NONE)
+    {
+        position = requestNum * Message::GetBlockLength(requestBlockSize);
+    }
+
+    switch (aError = aResponse.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, blockSize))
+    {
+    case OT_ERROR_NONE:
+        // The server may send a smaller block than requested, at the same position (RFC 7959, 2.4).
+        VerifyOrExit(num * Message::GetBlockLength(blockSize) == position, aError = OT_ERROR_PARSE);
+        break;
+
+    case OT_ERROR_NOT_FOUND:
+        // The server sent the whole payload at once.
+        VerifyOrExit(position == 0, aError = OT_ERROR_PARSE);
+        more   = false;
+        aError = OT_ERROR_NONE;
+        break;
+
+    default:
+        ExitNow();
+    }
+
+    SuccessOrExit(aError = aCoapMetadata.mBlockwiseReceiveHook(aCoapMetadata.mResponseContext, &aResponse, position,
+                                                               aResponse.GetLength() - aResponse.GetOffset(), more));
+    VerifyOrExit(more);
+
+    aError = SendNextRequestBlock(aRequest, aCoapMetadata, OT_COAP_OPTION_BLOCK2, num + 1, blockSize);
+    sent   = (aError == OT_ERROR_NONE);
+
+exit:
+    return sent;
+}
+
+otError CoapBase::SendNextRequestBlock(Message &           aRequest,
+                                       const CoapMetadata &aCoapMetadata,
+                                       uint16_t            aOption,
+                                       uint32_t            aNum,
+                                       otCoapBlockSize     aBlockSize)
+{
+    otError          error;
+    Message *        message = NULL;
+    Ip6::MessageInfo messageInfo;
+
+    // The next request carries the options of the first one, followed by the Block option.
+    VerifyOrExit((message = aRequest.Clone(aCoapMetadata.mBlockwiseHeaderLength)) != NULL, error = OT_ERROR_NO_BUFS);
+    message->SetOffset(0);
+    SuccessOrExit(error = message->ParseHeader());
+
+    messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+
+    error = SendRequestBlock(*message, messageInfo, aCoapMetadata, aOption, aNum, aBlockSize);
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError CoapBase::SendRequestBlock(Message &               aRequest,
+                                   const Ip6::MessageInfo &aMessageInfo,
+                                   const CoapMetadata &    aCoapMetadata,
+                                   uint16_t                aOption,
+                                   uint32_t                aNum,
+                                   otCoapBlockSize         aBlockSize)
+{
+    otError      error;
+    CoapMetadata coapMetadata(true, aMessageInfo, aCoapMetadata.mResponseHandler, aCoapMetadata.mResponseContext);
+    Message *    storedCopy = NULL;
+
+    coapMetadata.mBlockwiseTransmitHook = aCoapMetadata.mBlockwiseTransmitHook;
+    coapMetadata.mBlockwiseReceiveHook  = aCoapMetadata.mBlockwiseReceiveHook;
+    coapMetadata.mBlockwiseHeaderLength = aCoapMetadata.mBlockwiseHeaderLength;
+
+    if (aOption == OT_COAP_OPTION_BLOCK1)
+    {
+        SuccessOrExit(error = AppendBlock(aRequest, aOption, aNum, aBlockSize, aCoapMetadata.mBlockwiseTransmitHook,
+                                          aCoapMetadata.mResponseContext));
+    }
+    else
+    {
+        SuccessOrExit(error = aRequest.AppendBlockOption(aOption, aNum, false, aBlockSize));
+    }
+
+    // Each block is a separate request (RFC 7959, 2.3).
+    aRequest.SetMessageId(mMessageId++);
+    aRequest.Finish();
+
+    VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aRequest, aRequest.GetLength(), coapMetadata)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    if (coapMetadata.mDeferred)
+    {
+        aRequest.Free();
+        ExitNow();
+    }
+#endif
+
+    SuccessOrExit(error = Send(aRequest, aMessageInfo));
+
+exit:
+
+    if (error != OT_ERROR_NONE && storedCopy != NULL)
+    {
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        EndInteraction(coapMetadata, false);
+#endif
+        DequeueMessage(*storedCopy);
+    }
+
+    return error;
+}
+
+otError CoapBase::AppendBlock(Message &                   aMessage,
+                              uint16_t                    aOption,
+                              uint32_t                    aNum,
+                              otCoapBlockSize             aBlockSize,
+                              otCoapBlockwiseTransmitHook aTransmitHook,
+                              void *                      aContext)
+{
+    otError  error;
+    uint16_t blockLength = Message::GetBlockLength(aBlockSize);
+    uint16_t moreOffset;
+    uint16_t length;
+    bool     more = false;
+    uint8_t  value;
+
+    // The More flag is only known once the block is produced, it is cleared afterwards for the last block.
+    SuccessOrExit(error = aMessage.AppendBlockOption(aOption, aNum, true, aBlockSize));
+    moreOffset = aMessage.GetLength() - 1;
+
+    SuccessOrExit(error = aMessage.SetPayloadMarker());
+    SuccessOrExit(error = aTransmitHook(aContext, &aMessage, aNum * blockLength, blockLength, &more));
+
+    // Every block but the last one has the block size (RFC 7959, 2.2).
+    length = aMessage.GetLength() - aMessage.GetOffset();
+    VerifyOrExit(more ? (length == blockLength) : (length <= blockLength), error = OT_ERROR_INVALID_ARGS);
+
+    if (!more)
+    {
+        aMessage.Read(moreOffset, sizeof(value), &value);
+        value &= ~static_cast<uint8_t>(Message::kBlockMoreFlag);
+        aMessage.Write(moreOffset, sizeof(value), &value);
+    }
+
+    if (length == 0)
+    {
+        // A payload marker is not followed by an empty payload (RFC 7252, 3).
+        SuccessOrExit(error = aMessage.SetLength(aMessage.GetLength() - 1));
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 otError CoapBase::SendEmptyMessage(Message::Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
 {
     otError  error   = OT_ERROR_NONE;
@@ -266,13 +734,40 @@ void CoapBase::HandleRetransmissionTimer(void)
     Message *        message     = static_cast<Message *>(mPendingRequests.GetHead());
     Message *        nextMessage = NULL;
     Ip6::MessageInfo messageInfo;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    Peer *peer;
+#endif
 
     while (message != NULL)
     {
         nextMessage = static_cast<Message *>(message->GetNext());
         coapMetadata.ReadFrom(*message);
 
-        if (coapMetadata.IsLater(now))
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        if (coapMetadata.mDeferred)
+        {
+            // Deferred messages are sent in order, as their peers get fewer outstanding messages.
+            if (StartInteraction(coapMetadata))
+            {
+                coapMetadata.mDeferred = false;
+                mNumDeferredMessages--;
+                coapMetadata.UpdateIn(*message);
+
+                if (coapMetadata.mRetransmissionTimeout < nextDelta)
+                {
+                    nextDelta = coapMetadata.mRetransmissionTimeout;
+                }
+
+                messageInfo.SetPeerAddr(coapMetadata.mDestinationAddress);
+                messageInfo.SetPeerPort(coapMetadata.mDestinationPort);
+                messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
+
+                SendCopy(*message, messageInfo);
+            }
+        }
+        else
+#endif
+            if (coapMetadata.IsLater(now))
         {
             uint32_t diff = TimerMilli::Elapsed(now, coapMetadata.mNextTimerShot);
             // Calculate the next delay and choose the lowest.
@@ -285,7 +780,12 @@ void CoapBase::HandleRetransmissionTimer(void)
         {
             // Increment retransmission counter and timer.
             coapMetadata.mRetransmissionCount++;
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+            coapMetadata.mRetransmissionTimeout =
+                coapMetadata.mRetransmissionTimeout * coapMetadata.mBackoffFactor / Peer::kBackoffFactorUnit;
+#else
             coapMetadata.mRetransmissionTimeout *= 2;
+#endif
             coapMetadata.mNextTimerShot = now + coapMetadata.mRetransmissionTimeout;
             coapMetadata.UpdateIn(*message);
 
@@ -303,6 +803,13 @@ void CoapBase::HandleRetransmissionTimer(void)
                 messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
 
                 SendCopy(*message, messageInfo);
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+                if ((peer = FindPeer(coapMetadata.mDestinationAddress, coapMetadata.mDestinationPort)) != NULL)
+                {
+                    peer->mNumRetransmissions++;
+                }
+#endif
             }
         }
         else
@@ -321,14 +828,28 @@ void CoapBase::HandleRetransmissionTimer(void)
 }
 
 void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
-                                       const CoapMetadata &    aCoapMetadata,
+                                       CoapMetadata &          aCoapMetadata,
                                        Message *               aResponse,
                                        const Ip6::MessageInfo *aMessageInfo,
                                        otError                 aResult)
 {
+    bool completed = true;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    EndInteraction(aCoapMetadata, false);
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (aResponse != NULL && aCoapMetadata.mBlockwiseHeaderLength != 0)
+    {
+        // The transaction goes on with the request for the next block, if one was sent.
+        completed = !ProcessBlockwiseResponse(aRequest, aCoapMetadata, *aResponse, aResult);
+    }
+#endif
+
     DequeueMessage(aRequest);
 
-    if (aCoapMetadata.mResponseHandler != NULL)
+    if (completed && aCoapMetadata.mResponseHandler != NULL)
     {
         aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, aResponse, aMessageInfo, aResult);
     }
@@ -356,9 +877,7 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
     return error;
 }
 
-Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
-                                         uint16_t            aCopyLength,
-                                         const CoapMetadata &aCoapMetadata)
+Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, CoapMetadata &aCoapMetadata)
 {
     otError  error       = OT_ERROR_NONE;
     Message *messageCopy = NULL;
@@ -366,6 +885,16 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
     // Create a message copy of requested size.
     VerifyOrExit((messageCopy = aMessage.Clone(aCopyLength)) != NULL, error = OT_ERROR_NO_BUFS);
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // Confirmable messages beyond NSTART outstanding ones to their peer are deferred (RFC 7252, 4.7).
+    if (aCoapMetadata.mConfirmable && !aCoapMetadata.mDestinationAddress.IsMulticast() &&
+        !StartInteraction(aCoapMetadata))
+    {
+        aCoapMetadata.mDeferred = true;
+        mNumDeferredMessages++;
+    }
+#endif
+
     // Append the copy with retransmission data.
     SuccessOrExit(error = aCoapMetadata.AppendTo(*messageCopy));
 
@@ -390,10 +919,18 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
     // Enqueue the message.
     mPendingRequests.Enqueue(*messageCopy);
 
+    if (!IndexRequest(*messageCopy))
+    {
+        mNumUnindexedRequests++;
+    }
+
 exit:
 
     if (error != OT_ERROR_NONE && messageCopy != NULL)
     {
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        EndInteraction(aCoapMetadata, false);
+#endif
         messageCopy->Free();
         messageCopy = NULL;
     }
@@ -403,8 +940,24 @@ exit:
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+    bool indexed = mRequestsById.Remove(aMessage, aMessage.GetMessageId());
+
     mPendingRequests.Dequeue(aMessage);
 
+    if (indexed)
+    {
+        mRequestsByToken.Remove(aMessage, GetTokenKey(aMessage));
+
+        if (mNumUnindexedRequests > 0)
+        {
+            IndexNextRequest();
+        }
+    }
+    else
+    {
+        mNumUnindexedRequests--;
+    }
+
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == NULL))
     {
         // No more requests pending, stop the timer.
@@ -418,6 +971,185 @@ void CoapBase::DequeueMessage(Message &aMessage)
     // the timer would just shoot earlier and then it'd be setup again.
 }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+Peer *CoapBase::FindPeer(const Ip6::Address &aAddress, uint16_t aPort)
+{
+    Peer *peer;
+
+    for (peer = &mPeers[0]; peer < OT_ARRAY_END(mPeers); peer++)
+    {
+        if (peer->Matches(aAddress, aPort))
+        {
+            ExitNow();
+        }
+    }
+
+    peer = NULL;
+
+exit:
+    return peer;
+}
+
+Peer *CoapBase::GetPeer(const Ip6::Address &aAddress, uint16_t aPort)
+{
+    Peer *peer = FindPeer(aAddress, aPort);
+
+    if (peer == NULL)
+    {
+        // Take a free entry, or the least recently used peer without outstanding messages.
+        for (Peer *entry = &mPeers[0]; entry < OT_ARRAY_END(mPeers); entry++)
+        {
+            if (entry->IsFree())
+            {
+                peer = entry;
+                break;
+            }
+
+            if (entry->mNumInFlight == 0 &&
+                (peer == NULL || static_cast<int32_t>(entry->mLastUsed - peer->mLastUsed) < 0))
+            {
+                peer = entry;
+            }
+        }
+
+        VerifyOrExit(peer != NULL);
+        peer->Init(aAddress, aPort);
+    }
+
+    peer->mLastUsed = TimerMilli::GetNow();
+
+exit:
+    return peer;
+}
+
+bool CoapBase::StartInteraction(CoapMetadata &aCoapMetadata)
+{
+    bool  started = false;
+    Peer *peer;
+
+    VerifyOrExit((peer = GetPeer(aCoapMetadata.mDestinationAddress, aCoapMetadata.mDestinationPort)) != NULL);
+    VerifyOrExit(peer->mNumInFlight < kNStart);
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    peer->AgeRetransmissionTimeout();
+    aCoapMetadata.mBackoffFactor = peer->GetBackoffFactor();
+#endif
+
+    aCoapMetadata.SetRetransmissionTimeout(peer->GetRetransmissionTimeout());
+    aCoapMetadata.mTransmissionTime = TimerMilli::GetNow();
+    aCoapMetadata.mInFlight         = true;
+
+    peer->mNumInFlight++;
+    peer->mNumTransmissions++;
+    started = true;
+
+exit:
+    return started;
+}
+
+void CoapBase::EndInteraction(CoapMetadata &aCoapMetadata, bool aAcknowledged)
+{
+    Peer *peer;
+
+    if (aCoapMetadata.mDeferred)
+    {
+        aCoapMetadata.mDeferred = false;
+        mNumDeferredMessages--;
+    }
+
+    VerifyOrExit(aCoapMetadata.mInFlight);
+    aCoapMetadata.mInFlight = false;
+
+    // Peers with outstanding messages are never reused.
+    peer = FindPeer(aCoapMetadata.mDestinationAddress, aCoapMetadata.mDestinationPort);
+    assert(peer != NULL);
+    peer->mNumInFlight--;
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    if (aAcknowledged)
+    {
+        peer->UpdateRetransmissionTimeout(TimerMilli::Elapsed(aCoapMetadata.mTransmissionTime),
+                                          aCoapMetadata.mRetransmissionCount);
+    }
+#else
+    OT_UNUSED_VARIABLE(aAcknowledged);
+#endif
+
+    if (mNumDeferredMessages > 0)
+    {
+        // Deferred messages are started from the retransmission timer, once the current transaction is finalized.
+        mRetransmissionTimer.Start(0);
+    }
+
+exit:
+    return;
+}
+
+bool CoapBase::IsAcceptedReply(const Message &aResponse, const Message &aRequest)
+{
+    bool accepted = true;
+
+    switch (aResponse.GetType())
+    {
+    case OT_COAP_TYPE_RESET:
+        accepted = aResponse.IsEmpty();
+        break;
+
+    case OT_COAP_TYPE_ACKNOWLEDGMENT:
+        accepted = aResponse.IsEmpty() || (aResponse.IsResponse() && aResponse.IsTokenEqual(aRequest));
+        break;
+
+    default:
+        break;
+    }
+
+    return accepted;
+}
+
+otError CoapBase::GetNextPeerStats(otCoapPeerStatsIterator &aIterator, otCoapPeerStats &aStats) const
+{
+    otError      error = OT_ERROR_NOT_FOUND;
+    CoapMetadata coapMetadata;
+
+    for (; aIterator < kMaxPeers; aIterator++)
+    {
+        const Peer &peer = mPeers[aIterator];
+
+        if (peer.IsFree())
+        {
+            continue;
+        }
+
+        aStats.mPeerAddress           = peer.mAddress;
+        aStats.mPeerPort              = peer.mPort;
+        aStats.mNumInFlight           = peer.mNumInFlight;
+        aStats.mNumDeferred           = 0;
+        aStats.mRetransmissionTimeout = peer.mRetransmissionTimeout;
+        aStats.mNumTransmissions      = peer.mNumTransmissions;
+        aStats.mNumRetransmissions    = peer.mNumRetransmissions;
+
+        // Deferred messages are not counted per peer, as they may wait for a peer entry.
+        for (const Message *message = static_cast<const Message *>(mPendingRequests.GetHead()); message != NULL;
+             message                = static_cast<const Message *>(message->GetNext()))
+        {
+            coapMetadata.ReadFrom(*message);
+
+            if (coapMetadata.mDeferred &&
+                peer.Matches(coapMetadata.mDestinationAddress, coapMetadata.mDestinationPort))
+            {
+                aStats.mNumDeferred++;
+            }
+        }
+
+        aIterator++;
+        ExitNow(error = OT_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
 otError CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     otError  error;
@@ -440,40 +1172,140 @@ exit:
     return error;
 }
 
-Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
+bool CoapBase::IndexRequest(Message &aRequest)
+{
+    bool indexed = mRequestsById.Add(aRequest, aRequest.GetMessageId());
+
+    if (indexed)
+    {
+        // Both indexes have the same size and hold the same requests.
+        mRequestsByToken.Add(aRequest, GetTokenKey(aRequest));
+    }
+
+    return indexed;
+}
+
+void CoapBase::IndexNextRequest(void)
+{
+    Message *message;
+
+    for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL;
+         message = static_cast<Message *>(message->GetNext()))
+    {
+        if (!mRequestsById.Contains(*message, message->GetMessageId()))
+        {
+            IndexRequest(*message);
+            mNumUnindexedRequests--;
+            break;
+        }
+    }
+}
+
+uint16_t CoapBase::GetTokenKey(const Message &aMessage)
+{
+    const uint8_t *token = aMessage.GetToken();
+    uint16_t       key   = 0;
+
+    for (uint8_t i = 0; i < aMessage.GetTokenLength(); i++)
+    {
+        key = static_cast<uint16_t>((key << 5) | (key >> 11)) ^ token[i];
+    }
+
+    return key;
+}
+
+bool CoapBase::IsRelatedPeer(const CoapMetadata &aCoapMetadata, const Ip6::MessageInfo &aMessageInfo)
+{
+    return ((aCoapMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
+            aCoapMetadata.mDestinationAddress.IsMulticast() ||
+            aCoapMetadata.mDestinationAddress.IsAnycastRoutingLocator()) &&
+           (aCoapMetadata.mDestinationPort == aMessageInfo.GetPeerPort());
+}
+
+Message *CoapBase::FindIndexedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       CoapMetadata &          aCoapMetadata)
 {
-    Message *message = static_cast<Message *>(mPendingRequests.GetHead());
+    Message *                                         message = NULL;
+    HashIndex<Message, kMaxIndexedRequests>::Iterator iterator;
 
-    while (message != NULL)
+    switch (aResponse.GetType())
     {
-        aCoapMetadata.ReadFrom(*message);
+    case OT_COAP_TYPE_RESET:
+    case OT_COAP_TYPE_ACKNOWLEDGMENT:
+        for (message = mRequestsById.GetFirst(aResponse.GetMessageId(), iterator); message != NULL;
+             message = mRequestsById.GetNext(aResponse.GetMessageId(), iterator))
+        {
+            aCoapMetadata.ReadFrom(*message);
+
+            if (IsRelatedPeer(aCoapMetadata, aMessageInfo))
+            {
+                break;
+            }
+        }
+
+        break;
 
-        if (((aCoapMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aCoapMetadata.mDestinationAddress.IsMulticast() ||
-             aCoapMetadata.mDestinationAddress.IsAnycastRoutingLocator()) &&
-            (aCoapMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+    case OT_COAP_TYPE_CONFIRMABLE:
+    case OT_COAP_TYPE_NON_CONFIRMABLE:
+        for (message = mRequestsByToken.GetFirst(GetTokenKey(aResponse), iterator); message != NULL;
+             message = mRequestsByToken.GetNext(GetTokenKey(aResponse), iterator))
         {
-            switch (aResponse.GetType())
+            if (!aResponse.IsTokenEqual(*message))
             {
-            case OT_COAP_TYPE_RESET:
-            case OT_COAP_TYPE_ACKNOWLEDGMENT:
-                if (aResponse.GetMessageId() == message->GetMessageId())
-                {
-                    ExitNow();
-                }
+                continue;
+            }
 
+            aCoapMetadata.ReadFrom(*message);
+
+            if (IsRelatedPeer(aCoapMetadata, aMessageInfo))
+            {
                 break;
+            }
+        }
 
-            case OT_COAP_TYPE_CONFIRMABLE:
-            case OT_COAP_TYPE_NON_CONFIRMABLE:
-                if (aResponse.IsTokenEqual(*message))
-                {
-                    ExitNow();
-                }
+        break;
+    }
 
-                break;
+    return message;
+}
+
+Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      CoapMetadata &          aCoapMetadata)
+{
+    Message *message = FindIndexedRequest(aResponse, aMessageInfo, aCoapMetadata);
+
+    VerifyOrExit(message == NULL && mNumUnindexedRequests > 0);
+
+    // Some requests were sent while the index was full, fall back to scanning the whole queue.
+    message = static_cast<Message *>(mPendingRequests.GetHead());
+
+    while (message != NULL)
+    {
+        bool related = false;
+
+        switch (aResponse.GetType())
+        {
+        case OT_COAP_TYPE_RESET:
+        case OT_COAP_TYPE_ACKNOWLEDGMENT:
+            related = (aResponse.GetMessageId() == message->GetMessageId());
+            break;
+
+        case OT_COAP_TYPE_CONFIRMABLE:
+        case OT_COAP_TYPE_NON_CONFIRMABLE:
+            related = aResponse.IsTokenEqual(*message);
+            break;
+        }
+
+        // Only read the metadata of requests with a matching Message ID or Token.
+        if (related)
+        {
+            aCoapMetadata.ReadFrom(*message);
+
+            if (IsRelatedPeer(aCoapMetadata, aMessageInfo))
+            {
+                ExitNow();
             }
         }
 
@@ -515,6 +1347,23 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // Deferred messages were not sent yet, nothing can relate to them.
+    if (coapMetadata.mDeferred)
+    {
+        request = NULL;
+        ExitNow();
+    }
+
+    if (coapMetadata.mInFlight && IsAcceptedReply(aMessage, *request))
+    {
+        // Any accepted reply ends the outstanding interaction, even if a separate response is still expected
+        // (RFC 7252, 4.7). Messages silently ignored below neither end it nor give an RTT sample.
+        EndInteraction(coapMetadata, true);
+        coapMetadata.UpdateIn(*request);
+    }
+#endif
+
     switch (aMessage.GetType())
     {
     case OT_COAP_TYPE_RESET:
@@ -588,10 +1437,11 @@ exit:
 
 void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    char     uriPath[Resource::kMaxReceivedUriPath];
-    char *   curUriPath     = uriPath;
-    Message *cachedResponse = NULL;
-    otError  error          = OT_ERROR_NOT_FOUND;
+    char            uriPath[Resource::kMaxReceivedUriPath];
+    char *          curUriPath     = uriPath;
+    const Resource *resource;
+    Message *       cachedResponse = NULL;
+    otError         error          = OT_ERROR_NOT_FOUND;
 
     if (mInterceptor != NULL)
     {
@@ -636,14 +1486,11 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
 
     curUriPath[0] = '\0';
 
-    for (const Resource *resource = mResources; resource; resource = resource->GetNext())
+    if ((resource = FindResource(uriPath)) != NULL)
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
-        {
-            resource->HandleRequest(aMessage, aMessageInfo);
-            error = OT_ERROR_NONE;
-            ExitNow();
-        }
+        resource->HandleRequest(aMessage, aMessageInfo);
+        error = OT_ERROR_NONE;
+        ExitNow();
     }
 
     if (mDefaultHandler)
@@ -681,12 +1528,35 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
     mResponseHandler       = aHandler;
     mResponseContext       = aContext;
     mRetransmissionCount   = 0;
-    mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
-    mRetransmissionTimeout += Random::NonCrypto::GetUint32InRange(
-        0, TimerMilli::SecToMsec(kAckTimeout) * kAckRandomFactorNumerator / kAckRandomFactorDenominator -
-               TimerMilli::SecToMsec(kAckTimeout) + 1);
+    mAcknowledged          = false;
+    mConfirmable           = aConfirmable;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    mInFlight         = false;
+    mDeferred         = false;
+    mTransmissionTime = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    mBackoffFactor = 2 * Peer::kBackoffFactorUnit;
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    mBlockwiseTransmitHook = NULL;
+    mBlockwiseReceiveHook  = NULL;
+    mBlockwiseHeaderLength = 0;
+#endif
+
+    SetRetransmissionTimeout(TimerMilli::SecToMsec(kAckTimeout));
+}
+
+void CoapMetadata::SetRetransmissionTimeout(uint32_t aTimeout)
+{
+    mRetransmissionTimeout =
+        aTimeout + Random::NonCrypto::GetUint32InRange(
+                       0, aTimeout * kAckRandomFactorNumerator / kAckRandomFactorDenominator - aTimeout + 1);
 
-    if (aConfirmable)
+    if (mConfirmable)
     {
         // Set next retransmission timeout.
         mNextTimerShot = TimerMilli::GetNow() + mRetransmissionTimeout;
@@ -696,10 +1566,119 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
         // Set overall response timeout.
         mNextTimerShot = TimerMilli::GetNow() + kMaxTransmitWait;
     }
+}
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+void Peer::Init(const Ip6::Address &aAddress, uint16_t aPort)
+{
+    mAddress               = aAddress;
+    mPort                  = aPort;
+    mNumInFlight           = 0;
+    mLastUsed              = 0;
+    mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
+    mNumTransmissions      = 0;
+    mNumRetransmissions    = 0;
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    mStrongRoundTripTime = 0;
+    mStrongVariation     = 0;
+    mWeakRoundTripTime   = 0;
+    mWeakVariation       = 0;
+    mTimeoutUpdateTime   = TimerMilli::GetNow();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+void Peer::UpdateRetransmissionTimeout(uint32_t aRoundTripTime, uint8_t aRetransmissionCount)
+{
+    // It is unknown which transmission a reply after several retransmissions answers, those are not measured.
+    VerifyOrExit(aRetransmissionCount <= kMaxWeakRetransmissions);
+
+    // A zero round-trip time marks an estimator without measurements, the timer resolution is one millisecond.
+    if (aRoundTripTime == 0)
+    {
+        aRoundTripTime = 1;
+    }
+
+    if (aRetransmissionCount == 0)
+    {
+        mRetransmissionTimeout =
+            (mRetransmissionTimeout +
+             UpdateEstimator(mStrongRoundTripTime, mStrongVariation, aRoundTripTime, kStrongVariationFactor)) /
+            2;
+    }
+    else
+    {
+        mRetransmissionTimeout =
+            (3 * mRetransmissionTimeout +
+             UpdateEstimator(mWeakRoundTripTime, mWeakVariation, aRoundTripTime, kWeakVariationFactor)) /
+            4;
+    }
+
+    mTimeoutUpdateTime = TimerMilli::GetNow();
+
+exit:
+    return;
+}
+
+uint32_t Peer::UpdateEstimator(uint32_t &aRoundTripTime,
+                               uint32_t &aVariation,
+                               uint32_t  aSample,
+                               uint8_t   aVariationFactor)
+{
+    // Smoothed round-trip time and variation (RFC 6298, 2).
+    if (aRoundTripTime == 0)
+    {
+        aRoundTripTime = aSample;
+        aVariation     = aSample / 2;
+    }
+    else
+    {
+        uint32_t difference = (aRoundTripTime > aSample) ? (aRoundTripTime - aSample) : (aSample - aRoundTripTime);
+
+        aVariation     = (3 * aVariation + difference) / 4;
+        aRoundTripTime = (7 * aRoundTripTime + aSample) / 8;
+    }
+
+    return aRoundTripTime + aVariationFactor * aVariation;
+}
+
+void Peer::AgeRetransmissionTimeout(void)
+{
+    uint32_t now     = TimerMilli::GetNow();
+    uint32_t elapsed = TimerMilli::Elapsed(mTimeoutUpdateTime, now);
+
+    // Without fresh measurements, short timeouts grow and long ones move back toward the default one.
+    if (mRetransmissionTimeout < kShortTimeout && elapsed > kShortTimeoutAging * mRetransmissionTimeout)
+    {
+        mRetransmissionTimeout *= 2;
+        mTimeoutUpdateTime = now;
+    }
+    else if (mRetransmissionTimeout > kLongTimeout && elapsed > kLongTimeoutAging * mRetransmissionTimeout)
+    {
+        mRetransmissionTimeout = (mRetransmissionTimeout + TimerMilli::SecToMsec(kAckTimeout)) / 2;
+        mTimeoutUpdateTime     = now;
+    }
+}
+
+uint8_t Peer::GetBackoffFactor(void) const
+{
+    uint8_t factor = 2 * kBackoffFactorUnit;
+
+    // Short timeouts back off faster, long ones slower.
+    if (mRetransmissionTimeout < kShortTimeout)
+    {
+        factor = 3 * kBackoffFactorUnit;
+    }
+    else if (mRetransmissionTimeout > kLongTimeout)
+    {
+        factor = 3 * kBackoffFactorUnit / 2;
+    }
 
-    mAcknowledged = false;
-    mConfirmable  = aConfirmable;
+    return factor;
 }
+#endif // OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
     : mQueue()
@@ -711,13 +1690,14 @@ otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
                                                const Ip6::MessageInfo &aMessageInfo,
                                                Message **              aResponse)
 {
-    otError                error = OT_ERROR_NOT_FOUND;
-    Message *              message;
-    EnqueuedResponseHeader enqueuedResponseHeader;
-    Ip6::MessageInfo       messageInfo;
-
-    for (message = static_cast<Message *>(mQueue.GetHead()); message != NULL;
-         message = static_cast<Message *>(message->GetNext()))
+    otError                                           error = OT_ERROR_NOT_FOUND;
+    Message *                                         message;
+    HashIndex<Message, kMaxCachedResponses>::Iterator iterator;
+    EnqueuedResponseHeader                            enqueuedResponseHeader;
+    Ip6::MessageInfo                                  messageInfo;
+
+    for (message = mIndex.GetFirst(aRequest.GetMessageId(), iterator); message != NULL;
+         message = mIndex.GetNext(aRequest.GetMessageId(), iterator))
     {
         enqueuedResponseHeader.ReadFrom(*message);
         messageInfo = enqueuedResponseHeader.GetMessageInfo();
@@ -733,12 +1713,6 @@ otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
             continue;
         }
 
-        // Check Message Id
-        if (message->GetMessageId() != aRequest.GetMessageId())
-        {
-            continue;
-        }
-
         VerifyOrExit((*aResponse = message->Clone(message->GetLength() - sizeof(EnqueuedResponseHeader))) != NULL,
                      error = OT_ERROR_NO_BUFS);
 
@@ -787,6 +1761,9 @@ void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &
     SuccessOrExit(error = enqueuedResponseHeader.AppendTo(*responseCopy));
     mQueue.Enqueue(*responseCopy);
 
+    // The queue never holds more than `kMaxCachedResponses`, so the index always has room.
+    mIndex.Add(*responseCopy, responseCopy->GetMessageId());
+
     if (!mTimer.IsRunning())
     {
         mTimer.Start(TimerMilli::SecToMsec(kExchangeLifetime));
@@ -34,6 +34,7 @@
 #include <openthread/coap.h>
 
 #include "coap/coap_message.hpp"
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -68,7 +69,7 @@ enum
     kAckRandomFactorNumerator   = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR,
     kAckRandomFactorDenominator = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR,
     kMaxRetransmit              = OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT,
-    kNStart                     = 1,
+    kNStart                     = OPENTHREAD_CONFIG_COAP_NSTART,
     kDefaultLeisure             = 5,
     kProbingRate                = 1,
 
@@ -84,6 +85,194 @@ enum
     kNonLifetime      = kMaxTransmitSpan + kMaxLatency
 };
 
+/**
+ * This class implements an index of objects keyed on a 16-bit value.
+ *
+ * The index holds up to @p kSize objects, hashed into @p kSize buckets. Objects sharing a key are kept in the order
+ * they were added. The index does not own the objects; the owner adds and removes them along with its own list or
+ * queue.
+ *
+ */
+template <typename Type, uint8_t kSize> class HashIndex
+{
+public:
+    /**
+     * This type is used to iterate over the objects matching a key.
+     *
+     */
+    typedef uint8_t Iterator;
+
+    /**
+     * This constructor initializes the index as empty.
+     *
+     */
+    HashIndex(void) { Clear(); }
+
+    /**
+     * This method removes all objects from the index.
+     *
+     */
+    void Clear(void)
+    {
+        memset(mBuckets, kInvalidIndex, sizeof(mBuckets));
+
+        for (uint8_t i = 0; i < kSize; i++)
+        {
+            mEntries[i].mObject = NULL;
+            mEntries[i].mNext   = i + 1;
+        }
+
+        mEntries[kSize - 1].mNext = kInvalidIndex;
+        mFreeHead                 = 0;
+    }
+
+    /**
+     * This method adds an object to the index.
+     *
+     * @param[in]  aObject   A reference to the object.
+     * @param[in]  aKey      The key of @p aObject.
+     *
+     * @retval TRUE   Successfully added @p aObject.
+     * @retval FALSE  The index is full.
+     *
+     */
+    bool Add(Type &aObject, uint16_t aKey)
+    {
+        uint8_t *next  = &mBuckets[aKey % kSize];
+        uint8_t  index = mFreeHead;
+
+        VerifyOrExit(index != kInvalidIndex);
+
+        mFreeHead = mEntries[index].mNext;
+
+        while (*next != kInvalidIndex)
+        {
+            next = &mEntries[*next].mNext;
+        }
+
+        mEntries[index].mObject = &aObject;
+        mEntries[index].mKey    = aKey;
+        mEntries[index].mNext   = kInvalidIndex;
+        *next                   = index;
+
+    exit:
+        return (index != kInvalidIndex);
+    }
+
+    /**
+     * This method removes an object from the index.
+     *
+     * @param[in]  aObject   A reference to the object.
+     * @param[in]  aKey      The key @p aObject was added with.
+     *
+     * @retval TRUE   Successfully removed @p aObject.
+     * @retval FALSE  @p aObject was not in the index.
+     *
+     */
+    bool Remove(const Type &aObject, uint16_t aKey)
+    {
+        uint8_t *next = &mBuckets[aKey % kSize];
+        uint8_t  index;
+
+        while ((index = *next) != kInvalidIndex && mEntries[index].mObject != &aObject)
+        {
+            next = &mEntries[index].mNext;
+        }
+
+        VerifyOrExit(index != kInvalidIndex);
+
+        *next                   = mEntries[index].mNext;
+        mEntries[index].mObject = NULL;
+        mEntries[index].mNext   = mFreeHead;
+        mFreeHead               = index;
+
+    exit:
+        return (index != kInvalidIndex);
+    }
+
+    /**
+     * This method indicates whether an object is in the index.
+     *
+     * @param[in]  aObject   A reference to the object.
+     * @param[in]  aKey      The key of @p aObject.
+     *
+     * @retval TRUE   @p aObject is in the index.
+     * @retval FALSE  @p aObject is not in the index.
+     *
+     */
+    bool Contains(const Type &aObject, uint16_t aKey) const
+    {
+        Iterator iterator;
+        Type *   object;
+
+        for (object = GetFirst(aKey, iterator); object != NULL && object != &aObject; object = GetNext(aKey, iterator))
+        {
+        }
+
+        return (object != NULL);
+    }
+
+    /**
+     * This method returns the first object added with a given key.
+     *
+     * @param[in]   aKey       The key.
+     * @param[out]  aIterator  An iterator to pass to `GetNext()`.
+     *
+     * @returns A pointer to the first object with key @p aKey, or NULL if there is none.
+     *
+     */
+    Type *GetFirst(uint16_t aKey, Iterator &aIterator) const
+    {
+        aIterator = mBuckets[aKey % kSize];
+        return GetNext(aKey, aIterator);
+    }
+
+    /**
+     * This method returns the next object added with a given key.
+     *
+     * @param[in]     aKey       The key.
+     * @param[inout]  aIterator  The iterator returned from `GetFirst()` or a previous `GetNext()`.
+     *
+     * @returns A pointer to the next object with key @p aKey, or NULL if there is none.
+     *
+     */
+    Type *GetNext(uint16_t aKey, Iterator &aIterator) const
+    {
+        Type *object = NULL;
+
+        while (object == NULL && aIterator != kInvalidIndex)
+        {
+            const Entry &entry = mEntries[aIterator];
+
+            if (entry.mKey == aKey)
+            {
+                object = entry.mObject;
+            }
+
+            aIterator = entry.mNext;
+        }
+
+        return object;
+    }
+
+private:
+    enum
+    {
+        kInvalidIndex = 0xff,
+    };
+
+    struct Entry
+    {
+        Type *   mObject;
+        uint16_t mKey;
+        uint8_t  mNext; ///< Next entry in the same bucket, or in the free list.
+    };
+
+    Entry   mEntries[kSize];
+    uint8_t mBuckets[kSize];
+    uint8_t mFreeHead;
+};
+
 /**
  * This class implements metadata required for CoAP retransmission.
  *
@@ -106,7 +295,22 @@ public:
         , mRetransmissionTimeout(0)
         , mRetransmissionCount(0)
         , mAcknowledged(false)
-        , mConfirmable(false){};
+        , mConfirmable(false)
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        , mInFlight(false)
+        , mDeferred(false)
+        , mTransmissionTime(0)
+#endif
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+        , mBackoffFactor(0)
+#endif
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        , mBlockwiseTransmitHook(NULL)
+        , mBlockwiseReceiveHook(NULL)
+        , mBlockwiseHeaderLength(0)
+#endif
+    {
+    }
 
     /**
      * This constructor initializes the object with specific values.
@@ -179,6 +383,16 @@ public:
      */
     bool IsLater(uint32_t aTime) const { return (static_cast<int32_t>(aTime - mNextTimerShot) < 0); }
 
+    /**
+     * This method sets the delay before the first retransmission, randomized from a given timeout (RFC 7252, 4.2).
+     *
+     * The next timer shot is set from the delay for confirmable messages, from the overall response timeout otherwise.
+     *
+     * @param[in]  aTimeout  The retransmission timeout before randomization, in milliseconds.
+     *
+     */
+    void SetRetransmissionTimeout(uint32_t aTimeout);
+
 private:
     Ip6::Address          mSourceAddress;         ///< IPv6 address of the message source.
     Ip6::Address          mDestinationAddress;    ///< IPv6 address of the message destination.
@@ -190,8 +404,149 @@ private:
     uint8_t               mRetransmissionCount;   ///< Number of retransmissions.
     bool                  mAcknowledged : 1;      ///< Information that request was acknowledged.
     bool                  mConfirmable : 1;       ///< Information that message is confirmable.
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    bool     mInFlight : 1;     ///< Information that message counts toward the outstanding messages of its peer.
+    bool     mDeferred : 1;     ///< Information that message awaits fewer outstanding messages to its peer.
+    uint32_t mTransmissionTime; ///< Time of the first transmission of the message.
+#endif
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    uint8_t mBackoffFactor; ///< Retransmission timeout backoff factor, in units of `Peer::kBackoffFactorUnit`.
+#endif
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapBlockwiseTransmitHook mBlockwiseTransmitHook; ///< Producer of the request payload blocks.
+    otCoapBlockwiseReceiveHook  mBlockwiseReceiveHook;  ///< Consumer of the response payload blocks.
+    uint16_t                    mBlockwiseHeaderLength; ///< Request length without Block options, or zero.
+#endif
 } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+/**
+ * This class implements the congestion control state of a CoAP peer.
+ *
+ */
+class Peer
+{
+    friend class CoapBase;
+
+public:
+    enum
+    {
+        kBackoffFactorUnit = 2, ///< Backoff factors are in halves, for the 1.5 factor of long timeouts.
+    };
+
+    /**
+     * Default constructor for the object.
+     *
+     */
+    Peer(void)
+        : mPort(0)
+        , mNumInFlight(0)
+    {
+    }
+
+    /**
+     * This method initializes the state of a new peer.
+     *
+     * @param[in]  aAddress  A reference to the IPv6 address of the peer.
+     * @param[in]  aPort     The UDP port of the peer.
+     *
+     */
+    void Init(const Ip6::Address &aAddress, uint16_t aPort);
+
+    /**
+     * This method indicates whether the entry holds no peer.
+     *
+     * @retval TRUE   If the entry holds no peer.
+     * @retval FALSE  If the entry holds a peer.
+     *
+     */
+    bool IsFree(void) const { return mPort == 0; }
+
+    /**
+     * This method indicates whether the entry holds a given peer.
+     *
+     * @param[in]  aAddress  A reference to the IPv6 address of the peer.
+     * @param[in]  aPort     The UDP port of the peer.
+     *
+     * @retval TRUE   If the entry holds the peer.
+     * @retval FALSE  If the entry holds another peer, or none.
+     *
+     */
+    bool Matches(const Ip6::Address &aAddress, uint16_t aPort) const
+    {
+        return mPort == aPort && mAddress == aAddress;
+    }
+
+    /**
+     * This method returns the retransmission timeout of the next message to the peer, before randomization.
+     *
+     * @returns The retransmission timeout in milliseconds.
+     *
+     */
+    uint32_t GetRetransmissionTimeout(void) const { return mRetransmissionTimeout; }
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    /**
+     * This method updates the retransmission timeout from a measured round-trip time.
+     *
+     * @param[in]  aRoundTripTime         The time from the first transmission of a message to its acknowledgment, in
+     *                                    milliseconds.
+     * @param[in]  aRetransmissionCount   The number of retransmissions of the message.
+     *
+     */
+    void UpdateRetransmissionTimeout(uint32_t aRoundTripTime, uint8_t aRetransmissionCount);
+
+    /**
+     * This method moves the retransmission timeout back toward the default one when it was not updated for a while.
+     *
+     */
+    void AgeRetransmissionTimeout(void);
+
+    /**
+     * This method returns the factor the retransmission timeout of the next message to the peer backs off by.
+     *
+     * @returns The backoff factor, in units of `kBackoffFactorUnit`.
+     *
+     */
+    uint8_t GetBackoffFactor(void) const;
+#endif
+
+private:
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    enum
+    {
+        kStrongVariationFactor  = 4,    ///< K of the estimate from exchanges without retransmission.
+        kWeakVariationFactor    = 1,    ///< K of the estimate from exchanges with retransmissions.
+        kMaxWeakRetransmissions = 2,    ///< Exchanges with more retransmissions are not measured.
+        kShortTimeout           = 1000, ///< Timeouts below this one (ms) back off faster and age up.
+        kLongTimeout            = 3000, ///< Timeouts above this one (ms) back off slower and age down.
+        kShortTimeoutAging      = 16,   ///< Short timeouts age after this many times the timeout.
+        kLongTimeoutAging       = 4,    ///< Long timeouts age after this many times the timeout.
+    };
+
+    static uint32_t UpdateEstimator(uint32_t &aRoundTripTime,
+                                    uint32_t &aVariation,
+                                    uint32_t  aSample,
+                                    uint8_t   aVariationFactor);
+#endif
+
+    Ip6::Address mAddress;               ///< IPv6 address of the peer.
+    uint16_t     mPort;                  ///< UDP port of the peer, zero if the entry is free.
+    uint8_t      mNumInFlight;           ///< Number of outstanding confirmable messages.
+    uint32_t     mLastUsed;              ///< Time the peer was last sent to.
+    uint32_t     mRetransmissionTimeout; ///< Retransmission timeout before randomization (ms).
+    uint32_t     mNumTransmissions;      ///< Number of confirmable messages sent.
+    uint32_t     mNumRetransmissions;    ///< Number of retransmissions.
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    uint32_t mStrongRoundTripTime; ///< Smoothed round-trip time of exchanges without retransmission, or zero.
+    uint32_t mStrongVariation;     ///< Round-trip time variation of exchanges without retransmission.
+    uint32_t mWeakRoundTripTime;   ///< Smoothed round-trip time of exchanges with retransmissions, or zero.
+    uint32_t mWeakVariation;       ///< Round-trip time variation of exchanges with retransmissions.
+    uint32_t mTimeoutUpdateTime;   ///< Time the retransmission timeout was last updated.
+#endif
+};
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
 /**
  * This class implements CoAP resource handling.
  *
@@ -398,6 +753,7 @@ private:
 
     void DequeueResponse(Message &aMessage)
     {
+        mIndex.Remove(aMessage, aMessage.GetMessageId());
         mQueue.Dequeue(aMessage);
         aMessage.Free();
     }
@@ -405,8 +761,9 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    MessageQueue                            mQueue;
+    HashIndex<Message, kMaxCachedResponses> mIndex; ///< Cached responses by Message ID.
+    TimerMilliContext                       mTimer;
 };
 
 /**
@@ -463,6 +820,20 @@ public:
      */
     otError AddResource(Resource &aResource);
 
+    /**
+     * This method adds an array of resources to the CoAP server.
+     *
+     * Resources of @p aResources that were already added are skipped, the others are still added.
+     *
+     * @param[in]  aResources     A pointer to an array of resources.
+     * @param[in]  aNumResources  The number of resources in @p aResources.
+     *
+     * @retval OT_ERROR_NONE     Successfully added all of @p aResources.
+     * @retval OT_ERROR_ALREADY  One or more of @p aResources were already added.
+     *
+     */
+    otError AddResources(Resource *aResources, uint8_t aNumResources);
+
     /**
      * This method removes a resource from the CoAP server.
      *
@@ -512,6 +883,103 @@ public:
                         otCoapResponseHandler   aHandler = NULL,
                         void *                  aContext = NULL);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method sends a CoAP request whose request and/or response payload is transferred block-wise (RFC 7959).
+     *
+     * @p aMessage holds the request header only: it must not have a payload nor options numbered Block2 or higher.
+     * If @p aTransmitHook is not NULL, it produces the request payload, sent in Block1 blocks of @p aBlockSize. If
+     * @p aReceiveHook is not NULL, the payload of successful responses is passed to it, and responses carrying a
+     * Block2 option are followed by requests for the next block. @p aHandler is called once the transfer completes,
+     * with the last response, or if any block fails.
+     *
+     * @param[in]  aMessage       A reference to the confirmable request to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aBlockSize     The block size of the request payload, and the preferred one of the response payload.
+     * @param[in]  aTransmitHook  A function pointer that is called to produce the request payload, or NULL.
+     * @param[in]  aReceiveHook   A function pointer that is called with the response payload, or NULL.
+     * @param[in]  aHandler       A function pointer that shall be called once the transfer completes or fails.
+     * @param[in]  aContext       A pointer to arbitrary context information, passed to all of the above functions.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent the first block.
+     * @retval OT_ERROR_INVALID_ARGS  @p aMessage is not a confirmable request, or both hooks are NULL.
+     * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the first block.
+     *
+     */
+    otError SendRequestBlockWise(Message &                   aMessage,
+                                 const Ip6::MessageInfo &    aMessageInfo,
+                                 otCoapBlockSize             aBlockSize,
+                                 otCoapBlockwiseTransmitHook aTransmitHook,
+                                 otCoapBlockwiseReceiveHook  aReceiveHook,
+                                 otCoapResponseHandler       aHandler,
+                                 void *                      aContext);
+
+    /**
+     * This method sends the block of a CoAP response payload requested by the Block2 option of a request.
+     *
+     * @p aMessage holds the response header only: it must not have a payload nor options numbered Block2 or higher.
+     * The block is produced by @p aTransmitHook, in the smaller of @p aBlockSize and the block size of the request.
+     *
+     * @param[in]  aMessage       A reference to the response to send.
+     * @param[in]  aRequest       A reference to the request @p aMessage responds to.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aBlockSize     The largest block size to send.
+     * @param[in]  aTransmitHook  A function pointer that is called to produce the block.
+     * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+     *
+     * @retval OT_ERROR_NONE     Successfully enqueued the CoAP response message.
+     * @retval OT_ERROR_PARSE    The Block2 option of @p aRequest is malformed.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the CoAP response.
+     *
+     */
+    otError SendResponseBlockWise(Message &                   aMessage,
+                                  Message &                   aRequest,
+                                  const Ip6::MessageInfo &    aMessageInfo,
+                                  otCoapBlockSize             aBlockSize,
+                                  otCoapBlockwiseTransmitHook aTransmitHook,
+                                  void *                      aContext);
+
+    /**
+     * This method passes the payload of a received CoAP request to a block-wise consumer.
+     *
+     * A request without a Block1 option is passed as a single block. A block that is not the last one is acknowledged
+     * with a 2.31 (Continue) response. A block rejected by @p aReceiveHook is answered with a 4.13 (Request Entity
+     * Too Large) response if it returned OT_ERROR_NO_BUFS, 4.08 (Request Entity Incomplete) otherwise.
+     *
+     * @param[in]   aRequest      A reference to the received request.
+     * @param[in]   aMessageInfo  A reference to the message info associated with @p aRequest.
+     * @param[in]   aReceiveHook  A function pointer that is called with the block.
+     * @param[in]   aContext      A pointer to arbitrary context information passed to @p aReceiveHook.
+     * @param[out]  aMore         Set to TRUE if more blocks follow, FALSE if the whole payload was received.
+     *
+     * @retval OT_ERROR_NONE     Successfully passed the block to @p aReceiveHook.
+     * @retval OT_ERROR_PARSE    The Block1 option of @p aRequest is malformed, a 4.00 (Bad Request) response was sent.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to send the 2.31 (Continue) response.
+     * @retval ...               The error returned by @p aReceiveHook.
+     *
+     */
+    otError ReceiveRequestBlockWise(Message &                  aRequest,
+                                    const Ip6::MessageInfo &   aMessageInfo,
+                                    otCoapBlockwiseReceiveHook aReceiveHook,
+                                    void *                     aContext,
+                                    bool &                     aMore);
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    /**
+     * This method gets the congestion control state and statistics of the next peer.
+     *
+     * @param[inout]  aIterator  A reference to the iterator context. To get the first peer it should be set to
+     *                           OT_COAP_PEER_STATS_ITERATOR_INIT.
+     * @param[out]    aStats     A reference to where the peer state and statistics are placed.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the next peer.
+     * @retval OT_ERROR_NOT_FOUND  No subsequent peer exists.
+     *
+     */
+    otError GetNextPeerStats(otCoapPeerStatsIterator &aIterator, otCoapPeerStats &aStats) const;
+#endif
+
     /**
      * This method sends a CoAP reset message.
      *
@@ -655,23 +1123,76 @@ protected:
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum
+    {
+        kMaxIndexedRequests  = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS,
+        kMaxIndexedResources = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES,
+        kMaxPeers            = OPENTHREAD_CONFIG_COAP_MAX_PEERS,
+    };
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
-    Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const CoapMetadata &aCoapMetadata);
+    Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, CoapMetadata &aCoapMetadata);
     void     DequeueMessage(Message &aMessage);
+    bool     IndexRequest(Message &aRequest);
+    void     IndexNextRequest(void);
     Message *FindRelatedRequest(const Message &         aResponse,
                                 const Ip6::MessageInfo &aMessageInfo,
                                 CoapMetadata &          aCoapMetadata);
+    Message *FindIndexedRequest(const Message &         aResponse,
+                                const Ip6::MessageInfo &aMessageInfo,
+                                CoapMetadata &          aCoapMetadata);
     void     FinalizeCoapTransaction(Message &               aRequest,
-                                     const CoapMetadata &    aCoapMetadata,
+                                     CoapMetadata &          aCoapMetadata,
                                      Message *               aResponse,
                                      const Ip6::MessageInfo *aMessageInfo,
                                      otError                 aResult);
 
+    Resource *      FindIndexedResource(const char *aUriPath, uint16_t aKey) const;
+    const Resource *FindResource(const char *aUriPath) const;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    Peer *FindPeer(const Ip6::Address &aAddress, uint16_t aPort);
+    Peer *GetPeer(const Ip6::Address &aAddress, uint16_t aPort);
+    bool  StartInteraction(CoapMetadata &aCoapMetadata);
+    void  EndInteraction(CoapMetadata &aCoapMetadata, bool aAcknowledged);
+
+    static bool IsAcceptedReply(const Message &aResponse, const Message &aRequest);
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    bool    ProcessBlockwiseResponse(Message &           aRequest,
+                                     const CoapMetadata &aCoapMetadata,
+                                     Message &           aResponse,
+                                     otError &           aError);
+    otError SendNextRequestBlock(Message &           aRequest,
+                                 const CoapMetadata &aCoapMetadata,
+                                 uint16_t            aOption,
+                                 uint32_t            aNum,
+                                 otCoapBlockSize     aBlockSize);
+    otError SendRequestBlock(Message &               aRequest,
+                             const Ip6::MessageInfo &aMessageInfo,
+                             const CoapMetadata &    aCoapMetadata,
+                             uint16_t                aOption,
+                             uint32_t                aNum,
+                             otCoapBlockSize         aBlockSize);
+
+    static otError AppendBlock(Message &                   aMessage,
+                               uint16_t                    aOption,
+                               uint32_t                    aNum,
+                               otCoapBlockSize             aBlockSize,
+                               otCoapBlockwiseTransmitHook aTransmitHook,
+                               void *                      aContext);
+#endif
+
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    static uint16_t GetTokenKey(const Message &aMessage);
+    static bool     IsRelatedPeer(const CoapMetadata &aCoapMetadata, const Ip6::MessageInfo &aMessageInfo);
+    static uint16_t GetUriPathKey(const char *aUriPath);
+
     otError SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError SendEmptyMessage(Message::Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
 
@@ -690,11 +1211,21 @@ private:
         return mSender(*this, aMessage, aMessageInfo);
     }
 
-    MessageQueue      mPendingRequests;
-    uint16_t          mMessageId;
-    TimerMilliContext mRetransmissionTimer;
-
-    Resource *mResources;
+    MessageQueue                            mPendingRequests;
+    HashIndex<Message, kMaxIndexedRequests> mRequestsById;    ///< Pending requests by Message ID.
+    HashIndex<Message, kMaxIndexedRequests> mRequestsByToken; ///< Pending requests by `GetTokenKey()`.
+    uint16_t                                mNumUnindexedRequests;
+    uint16_t                                mMessageId;
+    TimerMilliContext                       mRetransmissionTimer;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    Peer     mPeers[kMaxPeers];
+    uint16_t mNumDeferredMessages;
+#endif
+
+    Resource *                                mResources;
+    HashIndex<Resource, kMaxIndexedResources> mResourceIndex; ///< Resources by `GetUriPathKey()`.
+    uint8_t                                   mNumUnindexedResources;
 
     void *         mContext;
     Interceptor    mInterceptor;
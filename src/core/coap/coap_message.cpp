@@ -207,6 +207,59 @@ otError Message::AppendUriQueryOption(const char *aUriQuery)
     return AppendStringOption(OT_COAP_OPTION_URI_QUERY, aUriQuery);
 }
 
+otError Message::AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aBlockSize)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t value = (aNum << kBlockNumOffset) | static_cast<uint32_t>(aBlockSize);
+
+    VerifyOrExit(aNumber == OT_COAP_OPTION_BLOCK1 || aNumber == OT_COAP_OPTION_BLOCK2, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aNum <= kMaxBlockNum && aBlockSize <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_INVALID_ARGS);
+
+    if (aMore)
+    {
+        value |= kBlockMoreFlag;
+    }
+
+    error = AppendUintOption(aNumber, value);
+
+exit:
+    return error;
+}
+
+otError Message::ReadBlockOptionValues(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aBlockSize)
+{
+    otError  error = OT_ERROR_NOT_FOUND;
+    uint8_t  buf[3];
+    uint32_t value = 0;
+
+    for (const otCoapOption *option = GetFirstOption(); option != NULL; option = GetNextOption())
+    {
+        if (option->mNumber != aNumber)
+        {
+            continue;
+        }
+
+        VerifyOrExit(option->mLength <= sizeof(buf), error = OT_ERROR_PARSE);
+        SuccessOrExit(error = GetOptionValue(buf));
+
+        for (uint16_t i = 0; i < option->mLength; i++)
+        {
+            value = (value << 8) | buf[i];
+        }
+
+        // Block size exponent 7 is reserved (RFC 7959, 2.2).
+        VerifyOrExit((value & kBlockSizeMask) <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_PARSE);
+
+        aNum       = value >> kBlockNumOffset;
+        aMore      = (value & kBlockMoreFlag) != 0;
+        aBlockSize = static_cast<otCoapBlockSize>(value & kBlockSizeMask);
+        break;
+    }
+
+exit:
+    return error;
+}
+
 const otCoapOption *Message::GetFirstOption(void)
 {
     const otCoapOption *option = NULL;
@@ -356,6 +409,7 @@ otError Message::ParseHeader(void)
     }
 
     VerifyOrExit(GetHelpData().mNextOptionOffset > 0, error = OT_ERROR_PARSE);
+    GetHelpData().mOptionLast   = GetHelpData().mOption.mNumber;
     GetHelpData().mHeaderLength = GetHelpData().mNextOptionOffset - GetHelpData().mHeaderOffset;
     MoveOffset(GetHelpData().mHeaderLength);
 
@@ -457,6 +511,9 @@ const char *Message::CodeToString(void) const
     case OT_COAP_CODE_CHANGED:
         codeString = "Changed";
         break;
+    case OT_COAP_CODE_CONTINUE:
+        codeString = "Continue";
+        break;
     case OT_COAP_CODE_BAD_REQUEST:
         codeString = "BadRequest";
         break;
@@ -472,6 +529,9 @@ const char *Message::CodeToString(void) const
     case OT_COAP_CODE_NOT_ACCEPTABLE:
         codeString = "NotAcceptable";
         break;
+    case OT_COAP_CODE_REQUEST_INCOMPLETE:
+        codeString = "RequestIncomplete";
+        break;
     case OT_COAP_CODE_PRECONDITION_FAILED:
         codeString = "PreconditionFailed";
         break;
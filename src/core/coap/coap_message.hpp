@@ -83,6 +83,18 @@ public:
         kTypeOffset         = 4,   ///< The type offset in the first byte of a coap header
     };
 
+    /**
+     * Block option value fields (RFC 7959).
+     *
+     */
+    enum
+    {
+        kBlockSizeMask  = 0x07,          ///< Block size exponent (SZX) mask.
+        kBlockMoreFlag  = 1 << 3,        ///< More blocks follow (M) flag.
+        kBlockNumOffset = 4,             ///< Block number (NUM) offset.
+        kMaxBlockNum    = (1 << 20) - 1, ///< Maximum block number.
+    };
+
     /**
      * CoAP Type values.
      *
@@ -379,6 +391,50 @@ public:
      */
     otError AppendUriQueryOption(const char *aUriQuery);
 
+    /**
+     * This method appends a Block1 or Block2 option.
+     *
+     * @param[in]  aNumber     The CoAP Option number, either `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum        The block number.
+     * @param[in]  aMore       TRUE if more blocks follow, FALSE otherwise.
+     * @param[in]  aBlockSize  The block size.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the option.
+     * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type, or the block
+     *                                number or size is out of range.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aBlockSize);
+
+    /**
+     * This method reads the values of a Block1 or Block2 option.
+     *
+     * @param[in]   aNumber     The CoAP Option number, either `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[out]  aNum        The block number.
+     * @param[out]  aMore       TRUE if more blocks follow, FALSE otherwise.
+     * @param[out]  aBlockSize  The block size.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option values.
+     * @retval OT_ERROR_NOT_FOUND  The message has no such option.
+     * @retval OT_ERROR_PARSE      The option is malformed.
+     *
+     */
+    otError ReadBlockOptionValues(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aBlockSize);
+
+    /**
+     * This static method returns the number of bytes of a block size.
+     *
+     * @param[in]  aBlockSize  The block size.
+     *
+     * @returns The number of bytes of @p aBlockSize.
+     *
+     */
+    static uint16_t GetBlockLength(otCoapBlockSize aBlockSize)
+    {
+        return static_cast<uint16_t>(16 << aBlockSize);
+    }
+
     /**
      * This method returns a pointer to the first option.
      *
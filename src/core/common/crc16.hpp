@@ -75,6 +75,15 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds a buffer into the CRC16 computation.
+     *
+     * @param[in]  aBuf     A pointer to the buffer.
+     * @param[in]  aLength  The number of bytes in @p aBuf.
+     *
+     */
+    void Update(const uint8_t *aBuf, uint16_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
@@ -84,8 +93,8 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
-    uint16_t mCrc;
+    const uint16_t *mTable;
+    uint16_t        mCrc;
 };
 
 } // namespace ot
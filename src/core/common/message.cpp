@@ -35,6 +35,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
@@ -44,6 +45,10 @@ namespace ot {
 
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mMaxUsedBuffers(0)
+    , mMaxUsedLargeBuffers(0)
+    , mNumFallbackAllocations(0)
+    , mNumFailedAllocations(0)
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     // Initialize Platform buffer pool management.
@@ -61,6 +66,20 @@ MessagePool::MessagePool(Instance &aInstance)
     mBuffers[kNumBuffers - 1].SetNextBuffer(NULL);
     mNumFreeBuffers = kNumBuffers;
 #endif
+
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    memset(mLargeBuffers, 0, sizeof(mLargeBuffers));
+
+    mFreeLargeBuffers = &mLargeBuffers[0].mBuffer;
+
+    for (uint16_t i = 0; i < kNumLargeBuffers - 1; i++)
+    {
+        mLargeBuffers[i].mBuffer.SetNextBuffer(&mLargeBuffers[i + 1].mBuffer);
+    }
+
+    mLargeBuffers[kNumLargeBuffers - 1].mBuffer.SetNextBuffer(NULL);
+    mNumFreeLargeBuffers = kNumLargeBuffers;
+#endif
 }
 
 Message *MessagePool::New(uint8_t aType, uint16_t aReserveHeader, uint8_t aPriority)
@@ -122,7 +141,7 @@ void MessagePool::Free(Message *aMessage)
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
-Buffer *MessagePool::NewBuffer(uint8_t aPriority)
+Buffer *MessagePool::NewBuffer(uint8_t aPriority, bool aPreferLarge)
 {
     Buffer *buffer = NULL;
 
@@ -130,11 +149,25 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
 
+    OT_UNUSED_VARIABLE(aPreferLarge);
+
     buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()));
 
 #else
 
-    if (mFreeBuffers != NULL)
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    if (mFreeLargeBuffers != NULL && (aPreferLarge || mFreeBuffers == NULL))
+    {
+        buffer            = mFreeLargeBuffers;
+        mFreeLargeBuffers = mFreeLargeBuffers->GetNextBuffer();
+        buffer->SetNextBuffer(NULL);
+        mNumFreeLargeBuffers--;
+    }
+#else
+    OT_UNUSED_VARIABLE(aPreferLarge);
+#endif
+
+    if (buffer == NULL && mFreeBuffers != NULL)
     {
         buffer       = mFreeBuffers;
         mFreeBuffers = mFreeBuffers->GetNextBuffer();
@@ -142,14 +175,30 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
         mNumFreeBuffers--;
     }
 
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    if (buffer != NULL && IsLargeBuffer(*buffer) != aPreferLarge)
+    {
+        mNumFallbackAllocations++;
+    }
 #endif
 
+#endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+
     if (buffer == NULL)
     {
         otLogInfoMem("No available message buffer");
     }
 
 exit:
+    if (buffer != NULL)
+    {
+        UpdateMaxUsed();
+    }
+    else if (mNumFailedAllocations < 0xffff)
+    {
+        mNumFailedAllocations++;
+    }
+
     return buffer;
 }
 
@@ -161,9 +210,20 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         otPlatMessagePoolFree(&GetInstance(), aBuffer);
 #else  // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-        aBuffer->SetNextBuffer(mFreeBuffers);
-        mFreeBuffers = aBuffer;
-        mNumFreeBuffers++;
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+        if (IsLargeBuffer(*aBuffer))
+        {
+            aBuffer->SetNextBuffer(mFreeLargeBuffers);
+            mFreeLargeBuffers = aBuffer;
+            mNumFreeLargeBuffers++;
+        }
+        else
+#endif
+        {
+            aBuffer->SetNextBuffer(mFreeBuffers);
+            mFreeBuffers = aBuffer;
+            mNumFreeBuffers++;
+        }
 #endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
         aBuffer = tmpBuffer;
     }
@@ -172,7 +232,7 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 otError MessagePool::ReclaimBuffers(int aNumBuffers, uint8_t aPriority)
 {
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-    while (aNumBuffers > GetFreeBufferCount())
+    while (aNumBuffers > GetFreeCapacity())
     {
         SuccessOrExit(Get<MeshForwarder>().EvictMessage(aPriority));
     }
@@ -185,7 +245,39 @@ exit:
     // First comparison is to get around issues with comparing
     // signed and unsigned numbers, if aNumBuffers is negative then
     // the second comparison wont be attempted.
-    return (aNumBuffers < 0 || aNumBuffers <= GetFreeBufferCount()) ? OT_ERROR_NONE : OT_ERROR_NO_BUFS;
+    return (aNumBuffers < 0 || aNumBuffers <= GetFreeCapacity()) ? OT_ERROR_NONE : OT_ERROR_NO_BUFS;
+}
+
+uint16_t MessagePool::GetFreeCapacity(void) const
+{
+    // The free capacity is expressed in (small) buffer units, a large
+    // buffer counts as the number of small buffers whose data it can hold.
+    uint16_t capacity = GetFreeBufferCount();
+
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    capacity += mNumFreeLargeBuffers * static_cast<uint16_t>(kLargeBufferDataSize / Buffer::kBufferDataSize);
+#endif
+
+    return capacity;
+}
+
+void MessagePool::UpdateMaxUsed(void)
+{
+    uint16_t used = kNumBuffers - GetFreeBufferCount();
+
+    if (used > mMaxUsedBuffers)
+    {
+        mMaxUsedBuffers = used;
+    }
+
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    used = kNumLargeBuffers - mNumFreeLargeBuffers;
+
+    if (used > mMaxUsedLargeBuffers)
+    {
+        mMaxUsedLargeBuffers = used;
+    }
+#endif
 }
 
 uint16_t MessagePool::GetFreeBufferCount(void) const
@@ -201,6 +293,15 @@ uint16_t MessagePool::GetFreeBufferCount(void) const
     return rval;
 }
 
+uint16_t MessagePool::GetFreeLargeBufferCount(void) const
+{
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    return mNumFreeLargeBuffers;
+#else
+    return 0;
+#endif
+}
+
 otError Message::ResizeMessage(uint16_t aLength)
 {
     otError error = OT_ERROR_NONE;
@@ -214,12 +315,15 @@ otError Message::ResizeMessage(uint16_t aLength)
     {
         if (curBuffer->GetNextBuffer() == NULL)
         {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
+            // Prefer a large buffer when the remaining data does not fit in a single small buffer.
+            bool preferLarge = (aLength - curLength > kBufferDataSize);
+
+            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority(), preferLarge));
             VerifyOrExit(curBuffer->GetNextBuffer() != NULL, error = OT_ERROR_NO_BUFS);
         }
 
         curBuffer = curBuffer->GetNextBuffer();
-        curLength += kBufferDataSize;
+        curLength += GetBufferDataSize(*curBuffer);
     }
 
     // remove buffers
@@ -233,6 +337,17 @@ exit:
     return error;
 }
 
+uint16_t Message::GetBufferDataSize(const Buffer &aBuffer) const
+{
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    return GetMessagePool()->IsLargeBuffer(aBuffer) ? static_cast<uint16_t>(MessagePool::kLargeBufferDataSize)
+                                                    : static_cast<uint16_t>(kBufferDataSize);
+#else
+    OT_UNUSED_VARIABLE(aBuffer);
+    return kBufferDataSize;
+#endif
+}
+
 void Message::Free(void)
 {
     GetMessagePool()->Free(this);
@@ -266,19 +381,21 @@ otError Message::SetLength(uint16_t aLength)
 {
     otError  error              = OT_ERROR_NONE;
     uint16_t totalLengthRequest = GetReserved() + aLength;
-    uint16_t totalLengthCurrent = GetReserved() + GetLength();
+    uint32_t capacity           = kHeadBufferDataSize;
     int      bufs               = 0;
 
     VerifyOrExit(totalLengthRequest >= GetReserved(), error = OT_ERROR_INVALID_ARGS);
 
-    if (totalLengthRequest > kHeadBufferDataSize)
+    // The current buffer chain may mix small and large buffers, so its capacity is summed over the actual buffers.
+    for (const Buffer *curBuffer = GetNextBuffer(); curBuffer; curBuffer = curBuffer->GetNextBuffer())
     {
-        bufs = (((totalLengthRequest - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
+        capacity += GetBufferDataSize(*curBuffer);
     }
 
-    if (totalLengthCurrent > kHeadBufferDataSize)
+    // The extra capacity is counted in (small) buffer units, as is the free capacity of the pool.
+    if (totalLengthRequest > capacity)
     {
-        bufs -= (((totalLengthCurrent - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
+        bufs = (((totalLengthRequest - capacity) - 1) / kBufferDataSize) + 1;
     }
 
     SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority()));
@@ -386,6 +503,28 @@ exit:
     return error;
 }
 
+void Message::UpdateDirectTransmission(bool aDirectTx)
+{
+    PriorityQueue *priorityQueue = GetPriorityQueue();
+
+    VerifyOrExit(mBuffer.mHead.mInfo.mDirectTx != aDirectTx);
+
+    if (priorityQueue != NULL)
+    {
+        priorityQueue->RemoveFromSubQueue(*this);
+    }
+
+    mBuffer.mHead.mInfo.mDirectTx = aDirectTx;
+
+    if (priorityQueue != NULL)
+    {
+        priorityQueue->AddToSubQueue(*this);
+    }
+
+exit:
+    return;
+}
+
 otError Message::Append(const void *aBuf, uint16_t aLength)
 {
     otError  error     = OT_ERROR_NONE;
@@ -409,8 +548,9 @@ otError Message::AppendTlv(const Tlv &aTlv)
 
 otError Message::Prepend(const void *aBuf, uint16_t aLength)
 {
-    otError error     = OT_ERROR_NONE;
-    Buffer *newBuffer = NULL;
+    otError  error     = OT_ERROR_NONE;
+    Buffer * newBuffer = NULL;
+    uint16_t dataSize;
 
     while (aLength > GetReserved())
     {
@@ -418,15 +558,16 @@ otError Message::Prepend(const void *aBuf, uint16_t aLength)
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
+        dataSize = GetBufferDataSize(*newBuffer);
 
         if (GetReserved() < sizeof(mBuffer.mHead.mData))
         {
-            // Copy payload from the first buffer.
-            memcpy(newBuffer->mBuffer.mHead.mData + GetReserved(), mBuffer.mHead.mData + GetReserved(),
-                   sizeof(mBuffer.mHead.mData) - GetReserved());
+            // Copy payload from the first buffer to the tail of the new buffer.
+            memcpy(newBuffer->GetData() + dataSize - kHeadBufferDataSize + GetReserved(),
+                   mBuffer.mHead.mData + GetReserved(), sizeof(mBuffer.mHead.mData) - GetReserved());
         }
 
-        SetReserved(GetReserved() + kBufferDataSize);
+        SetReserved(GetReserved() + dataSize);
     }
 
     SetReserved(GetReserved() - aLength);
@@ -459,16 +600,12 @@ void Message::RemoveHeader(uint16_t aLength)
     }
 }
 
-uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    aChunk.mLength = 0;
+    aChunk.mBuffer = this;
 
-    if (aOffset >= GetLength())
-    {
-        ExitNow();
-    }
+    VerifyOrExit(aOffset < GetLength(), aLength = 0);
 
     if (aOffset + aLength >= GetLength())
     {
@@ -477,135 +614,90 @@ uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
 
     aOffset += GetReserved();
 
-    // special case first buffer
     if (aOffset < kHeadBufferDataSize)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(aBuf, GetFirstData() + aOffset, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
+        aChunk.mData   = const_cast<uint8_t *>(GetFirstData()) + aOffset;
+        aChunk.mLength = kHeadBufferDataSize - aOffset;
     }
     else
     {
-        aOffset -= kHeadBufferDataSize;
-    }
+        uint16_t dataSize;
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
-
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
-
-    // begin copy
-    while (aLength > 0)
-    {
-        assert(curBuffer != NULL);
-
-        bytesToCopy = kBufferDataSize - aOffset;
+        aOffset -= kHeadBufferDataSize;
+        aChunk.mBuffer = GetNextBuffer();
+        assert(aChunk.mBuffer != NULL);
 
-        if (bytesToCopy > aLength)
+        while (aOffset >= (dataSize = GetBufferDataSize(*aChunk.mBuffer)))
         {
-            bytesToCopy = aLength;
+            aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+            aOffset -= dataSize;
+            assert(aChunk.mBuffer != NULL);
         }
 
-        memcpy(aBuf, curBuffer->GetData() + aOffset, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
+        aChunk.mData   = const_cast<uint8_t *>(aChunk.mBuffer->GetData()) + aOffset;
+        aChunk.mLength = dataSize - aOffset;
+    }
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    if (aChunk.mLength > aLength)
+    {
+        aChunk.mLength = aLength;
     }
 
+    aLength -= aChunk.mLength;
+
 exit:
-    return bytesCopied;
+    return;
 }
 
-int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk) const
 {
-    Buffer * curBuffer;
-    uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
+    aChunk.mLength = 0;
 
-    assert(aOffset + aLength <= GetLength());
+    VerifyOrExit(aLength > 0);
 
-    if (aOffset + aLength >= GetLength())
-    {
-        aLength = GetLength() - aOffset;
-    }
+    aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+    assert(aChunk.mBuffer != NULL);
 
-    aOffset += GetReserved();
+    aChunk.mData   = const_cast<uint8_t *>(aChunk.mBuffer->GetData());
+    aChunk.mLength = GetBufferDataSize(*aChunk.mBuffer);
 
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    if (aChunk.mLength > aLength)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
+        aChunk.mLength = aLength;
+    }
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
+    aLength -= aChunk.mLength;
 
-        memcpy(GetFirstData() + aOffset, aBuf, bytesToCopy);
+exit:
+    return;
+}
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
+{
+    uint16_t bytesCopied = 0;
+    Chunk    chunk;
 
-        aOffset = 0;
-    }
-    else
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
     {
-        aOffset -= kHeadBufferDataSize;
+        memcpy(static_cast<uint8_t *>(aBuf) + bytesCopied, chunk.GetData(), chunk.GetLength());
+        bytesCopied += chunk.GetLength();
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return bytesCopied;
+}
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
+{
+    uint16_t      bytesCopied = 0;
+    WritableChunk chunk;
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
-    }
+    assert(aOffset + aLength <= GetLength());
 
-    // begin copy
-    while (aLength > 0)
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
     {
-        assert(curBuffer != NULL);
-
-        bytesToCopy = kBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(curBuffer->GetData() + aOffset, aBuf, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+        // `memmove()` is used since `aBuf` may be part of this message (e.g., `CopyTo()` to the same message).
+        memmove(chunk.GetData(), static_cast<const uint8_t *>(aBuf) + bytesCopied, chunk.GetLength());
+        bytesCopied += chunk.GetLength();
     }
 
     return bytesCopied;
@@ -614,20 +706,15 @@ int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
     uint16_t bytesCopied = 0;
-    uint16_t bytesToCopy;
-    uint8_t  buf[16];
-
-    while (aLength > 0)
-    {
-        bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
+    Chunk    chunk;
 
-        Read(aSourceOffset, bytesToCopy, buf);
-        aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+    // Each source chunk is written directly from the source buffer, so the copy walks the source buffer chain once
+    // and the destination buffer chain once per source chunk.
 
-        aSourceOffset += bytesToCopy;
-        aDestinationOffset += bytesToCopy;
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
+    for (GetFirstChunk(aSourceOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
+    {
+        aMessage.Write(aDestinationOffset + bytesCopied, chunk.GetLength(), chunk.GetData());
+        bytesCopied += chunk.GetLength();
     }
 
     return bytesCopied;
@@ -707,78 +794,79 @@ uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
 
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
 {
+    // The one's complement sum is byte order independent (RFC 1071), so it is computed over 32-bit words in host byte
+    // order, accumulated into a 64-bit sum which defers all the end-around carries to the final fold.
+
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBuf);
+    uint64_t       sum   = 0;
+    uint32_t       words[4];
+    uint16_t       result;
 
-    for (int i = 0; i < aLength; i++)
+    for (; aLength >= sizeof(words); aLength -= sizeof(words), bytes += sizeof(words))
     {
-        aChecksum = UpdateChecksum(aChecksum, (i & 1) ? bytes[i] : static_cast<uint16_t>(bytes[i] << 8));
+        memcpy(words, bytes, sizeof(words));
+        sum += static_cast<uint64_t>(words[0]) + words[1] + words[2] + words[3];
     }
 
-    return aChecksum;
-}
-
-uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
-{
-    Buffer * curBuffer;
-    uint16_t bytesCovered = 0;
-    uint16_t bytesToCover;
-
-    assert(aOffset + aLength <= GetLength());
-
-    aOffset += GetReserved();
+    for (; aLength >= sizeof(words[0]); aLength -= sizeof(words[0]), bytes += sizeof(words[0]))
+    {
+        memcpy(&words[0], bytes, sizeof(words[0]));
+        sum += words[0];
+    }
 
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    if (aLength >= sizeof(uint16_t))
     {
-        bytesToCover = kHeadBufferDataSize - aOffset;
+        uint16_t value;
 
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
+        memcpy(&value, bytes, sizeof(value));
+        sum += value;
+        aLength -= sizeof(value);
+        bytes += sizeof(value);
+    }
 
-        aChecksum = Message::UpdateChecksum(aChecksum, GetFirstData() + aOffset, bytesToCover);
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
 
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
+    result = Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
 
-        aOffset = 0;
-    }
-    else
+    if (aLength > 0)
     {
-        aOffset -= kHeadBufferDataSize;
+        result = UpdateChecksum(result, static_cast<uint16_t>(bytes[0] << 8));
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return UpdateChecksum(aChecksum, result);
+}
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength, uint16_t aPosition)
+{
+    // A segment starting at an odd position has its bytes swapped within the 16-bit checksum words, which is the same
+    // as swapping the checksum before and after summing the segment.
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+    if (aPosition & 1)
+    {
+        aChecksum = Encoding::Swap16(UpdateChecksum(Encoding::Swap16(aChecksum), aBuf, aLength));
     }
-
-    // begin copy
-    while (aLength > 0)
+    else
     {
-        assert(curBuffer != NULL);
-
-        bytesToCover = kBufferDataSize - aOffset;
+        aChecksum = UpdateChecksum(aChecksum, aBuf, aLength);
+    }
 
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
+    return aChecksum;
+}
 
-        aChecksum = Message::UpdateChecksum(aChecksum, curBuffer->GetData() + aOffset, bytesToCover);
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
+{
+    uint16_t bytesCovered = 0;
+    Chunk    chunk;
 
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
+    assert(aOffset + aLength <= GetLength());
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset   = 0;
+    for (GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; GetNextChunk(aLength, chunk))
+    {
+        aChecksum = UpdateChecksum(aChecksum, chunk.GetData(), chunk.GetLength(), bytesCovered);
+        bytesCovered += chunk.GetLength();
     }
 
     return aChecksum;
@@ -885,31 +973,45 @@ void MessageQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) cons
     }
 }
 
+// Lowest and highest set bit for each bitmap of the (four) priority levels.
+static const uint8_t kLowestPriorityInMap[]  = {0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0};
+static const uint8_t kHighestPriorityInMap[] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3};
+
+OT_STATIC_ASSERT(sizeof(kLowestPriorityInMap) == (1 << Message::kNumPriorities), "priority map table size mismatch");
+
 PriorityQueue::PriorityQueue(void)
 {
     for (int priority = 0; priority < Message::kNumPriorities; priority++)
     {
         mTails[priority] = NULL;
+
+        for (int subQueue = 0; subQueue < kNumSubQueues; subQueue++)
+        {
+            mSubQueueTails[subQueue][priority] = NULL;
+        }
     }
+
+    mSubQueueMaps[kSubQueueDirect]   = 0;
+    mSubQueueMaps[kSubQueueIndirect] = 0;
 }
 
 Message *PriorityQueue::FindFirstNonNullTail(uint8_t aStartPriorityLevel) const
 {
     Message *tail = NULL;
-    uint8_t  priority;
+    uint8_t  map  = GetPriorityMap();
 
-    priority = aStartPriorityLevel;
+    // Look for the lowest non-empty priority level starting from
+    // `aStartPriorityLevel`, wrapping back to zero if there is none.
 
-    do
+    if ((map >> aStartPriorityLevel) != 0)
     {
-        if (mTails[priority] != NULL)
-        {
-            tail = mTails[priority];
-            break;
-        }
+        map &= static_cast<uint8_t>(0xff << aStartPriorityLevel);
+    }
 
-        priority = PrevPriority(priority);
-    } while (priority != aStartPriorityLevel);
+    if (map != 0)
+    {
+        tail = mTails[kLowestPriorityInMap[map]];
+    }
 
     return tail;
 }
@@ -949,6 +1051,105 @@ Message *PriorityQueue::GetTail(void) const
     return FindFirstNonNullTail(0);
 }
 
+Message *PriorityQueue::GetHeadForDirectTx(void) const
+{
+    uint8_t  map  = mSubQueueMaps[kSubQueueDirect];
+    Message *head = NULL;
+
+    if (map != 0)
+    {
+        head = mSubQueueTails[kSubQueueDirect][kHighestPriorityInMap[map]]->SubQueueNext();
+    }
+
+    return head;
+}
+
+Message *PriorityQueue::GetHeadForIndirectTx(uint8_t aMinPriority) const
+{
+    return GetSubQueueHead(kSubQueueIndirect, aMinPriority);
+}
+
+Message *PriorityQueue::GetNextForIndirectTx(const Message &aMessage) const
+{
+    uint8_t  priority = aMessage.GetPriority();
+    Message *next;
+
+    assert(aMessage.GetPriorityQueue() == this && !aMessage.GetDirectTransmission());
+
+    if (&aMessage != mSubQueueTails[kSubQueueIndirect][priority])
+    {
+        next = aMessage.SubQueueNext();
+    }
+    else
+    {
+        next = GetSubQueueHead(kSubQueueIndirect, priority + 1);
+    }
+
+    return next;
+}
+
+Message *PriorityQueue::GetSubQueueHead(SubQueue aSubQueue, uint8_t aMinPriority) const
+{
+    uint8_t  map  = mSubQueueMaps[aSubQueue] & static_cast<uint8_t>(0xff << aMinPriority);
+    Message *head = NULL;
+
+    if (map != 0)
+    {
+        head = mSubQueueTails[aSubQueue][kLowestPriorityInMap[map]]->SubQueueNext();
+    }
+
+    return head;
+}
+
+void PriorityQueue::AddToSubQueue(Message &aMessage)
+{
+    SubQueue  subQueue = GetSubQueue(aMessage);
+    uint8_t   priority = aMessage.GetPriority();
+    Message *&tail     = mSubQueueTails[subQueue][priority];
+
+    if (tail != NULL)
+    {
+        aMessage.SubQueueNext()              = tail->SubQueueNext();
+        aMessage.SubQueuePrev()              = tail;
+        tail->SubQueueNext()->SubQueuePrev() = &aMessage;
+        tail->SubQueueNext()                 = &aMessage;
+    }
+    else
+    {
+        aMessage.SubQueueNext() = &aMessage;
+        aMessage.SubQueuePrev() = &aMessage;
+        mSubQueueMaps[subQueue] |= (1 << priority);
+    }
+
+    tail = &aMessage;
+}
+
+void PriorityQueue::RemoveFromSubQueue(Message &aMessage)
+{
+    SubQueue  subQueue = GetSubQueue(aMessage);
+    uint8_t   priority = aMessage.GetPriority();
+    Message *&tail     = mSubQueueTails[subQueue][priority];
+
+    if (aMessage.SubQueueNext() == &aMessage)
+    {
+        tail = NULL;
+        mSubQueueMaps[subQueue] &= ~(1 << priority);
+    }
+    else
+    {
+        if (&aMessage == tail)
+        {
+            tail = aMessage.SubQueuePrev();
+        }
+
+        aMessage.SubQueueNext()->SubQueuePrev() = aMessage.SubQueuePrev();
+        aMessage.SubQueuePrev()->SubQueueNext() = aMessage.SubQueueNext();
+    }
+
+    aMessage.SubQueueNext() = NULL;
+    aMessage.SubQueuePrev() = NULL;
+}
+
 otError PriorityQueue::Enqueue(Message &aMessage)
 {
     otError  error = OT_ERROR_NONE;
@@ -981,6 +1182,8 @@ otError PriorityQueue::Enqueue(Message &aMessage)
 
     mTails[priority] = &aMessage;
 
+    AddToSubQueue(aMessage);
+
 exit:
     return error;
 }
@@ -1009,6 +1212,8 @@ otError PriorityQueue::Dequeue(Message &aMessage)
         mTails[priority] = tail;
     }
 
+    RemoveFromSubQueue(aMessage);
+
     aMessage.Next()->Prev() = aMessage.Prev();
     aMessage.Prev()->Next() = aMessage.Next();
     aMessage.Next()         = NULL;
@@ -48,6 +48,7 @@
 #include "common/tlvs.hpp"
 #include "mac/mac_frame.hpp"
 #include "thread/link_quality.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -63,8 +64,10 @@ namespace ot {
 
 enum
 {
-    kNumBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
-    kBufferSize = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+    kNumBuffers      = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+    kBufferSize      = OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+    kNumLargeBuffers = OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS,
+    kLargeBufferSize = OPENTHREAD_CONFIG_LARGE_MESSAGE_BUFFER_SIZE,
 };
 
 class Message;
@@ -78,9 +81,11 @@ class PriorityQueue;
  */
 struct MessageInfo
 {
-    Message *    mNext;        ///< A pointer to the next Message in a doubly linked list.
-    Message *    mPrev;        ///< A pointer to the previous Message in a doubly linked list.
-    MessagePool *mMessagePool; ///< Identifies the message pool for this message.
+    Message *    mNext;         ///< A pointer to the next Message in a doubly linked list.
+    Message *    mPrev;         ///< A pointer to the previous Message in a doubly linked list.
+    Message *    mSubQueueNext; ///< A pointer to the next Message in the priority queue direct/indirect sub-queue.
+    Message *    mSubQueuePrev; ///< A pointer to the previous Message in the priority queue direct/indirect sub-queue.
+    MessagePool *mMessagePool;  ///< Identifies the message pool for this message.
     union
     {
         MessageQueue * mMessage;  ///< Identifies the message queue (if any) where this message is queued.
@@ -123,6 +128,7 @@ struct MessageInfo
 class Buffer : public ::otMessage
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     /**
@@ -233,6 +239,56 @@ public:
         kNumPriorities = 4, ///< Number of priority levels.
     };
 
+    /**
+     * This class represents a contiguous chunk of message data, located within a single message buffer.
+     *
+     * A message is iterated as a sequence of chunks (scatter-gather) using `GetFirstChunk()` and `GetNextChunk()`,
+     * which walk the buffer chain only once, without copying the data.
+     *
+     */
+    class Chunk
+    {
+        friend class Message;
+
+    public:
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        const uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the number of bytes in the chunk.
+         *
+         * @returns The chunk length (zero indicates there are no more chunks).
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+    protected:
+        uint8_t *     mData;
+        uint16_t      mLength;
+        const Buffer *mBuffer;
+    };
+
+    /**
+     * This class represents a contiguous chunk of message data which can be modified in place.
+     *
+     */
+    class WritableChunk : public Chunk
+    {
+    public:
+        /**
+         * This method returns a pointer to the start of the chunk data.
+         *
+         * @returns A pointer to the chunk data.
+         *
+         */
+        uint8_t *GetData(void) const { return mData; }
+    };
+
     /**
      * This method frees this message buffer.
      *
@@ -436,6 +492,54 @@ public:
      */
     int Write(uint16_t aOffset, uint16_t aLength, const void *aBuf);
 
+    /**
+     * This method gets the first chunk of the message data starting at a given offset.
+     *
+     * @param[in]    aOffset  Byte offset within the message to start from.
+     * @param[inout] aLength  On input, the maximum number of bytes to iterate over. On output, the number of bytes
+     *                        remaining after @p aChunk (the length is limited to the end of the message).
+     * @param[out]   aChunk   A reference to a `Chunk` to output the first chunk.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the next chunk of the message data following a previous chunk.
+     *
+     * @param[inout] aLength  On input, the number of remaining bytes (as output by the previous call). On output, the
+     *                        number of bytes remaining after @p aChunk.
+     * @param[inout] aChunk   A reference to the previous chunk, updated to the next one (with zero length if none).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
+
+    /**
+     * This method gets the first writable chunk of the message data starting at a given offset.
+     *
+     * @param[in]    aOffset  Byte offset within the message to start from.
+     * @param[inout] aLength  On input, the maximum number of bytes to iterate over. On output, the number of bytes
+     *                        remaining after @p aChunk (the length is limited to the end of the message).
+     * @param[out]   aChunk   A reference to a `WritableChunk` to output the first chunk.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, WritableChunk &aChunk)
+    {
+        static_cast<const Message *>(this)->GetFirstChunk(aOffset, aLength, static_cast<Chunk &>(aChunk));
+    }
+
+    /**
+     * This method gets the next writable chunk of the message data following a previous chunk.
+     *
+     * @param[inout] aLength  On input, the number of remaining bytes (as output by the previous call). On output, the
+     *                        number of bytes remaining after @p aChunk.
+     * @param[inout] aChunk   A reference to the previous chunk, updated to the next one (with zero length if none).
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, WritableChunk &aChunk)
+    {
+        static_cast<const Message *>(this)->GetNextChunk(aLength, static_cast<Chunk &>(aChunk));
+    }
+
     /**
      * This method copies bytes from one message to another.
      *
@@ -602,13 +706,13 @@ public:
      * This method unschedules forwarding using direct transmission.
      *
      */
-    void ClearDirectTransmission(void) { mBuffer.mHead.mInfo.mDirectTx = false; }
+    void ClearDirectTransmission(void) { UpdateDirectTransmission(false); }
 
     /**
      * This method schedules forwarding using direct transmission.
      *
      */
-    void SetDirectTransmission(void) { mBuffer.mHead.mInfo.mDirectTx = true; }
+    void SetDirectTransmission(void) { UpdateDirectTransmission(true); }
 
     /**
      * This method indicates whether the direct transmission of message was successful.
@@ -805,6 +909,19 @@ private:
      */
     void SetMessagePool(MessagePool *aMessagePool) { mBuffer.mHead.mInfo.mMessagePool = aMessagePool; }
 
+    /**
+     * This static method updates a checksum with a buffer segment located at a given position within the data.
+     *
+     * @param[in]  aChecksum  The checksum value to update.
+     * @param[in]  aBuf       A pointer to the buffer segment.
+     * @param[in]  aLength    The number of bytes in @p aBuf.
+     * @param[in]  aPosition  The position of @p aBuf relative to the start of the checksummed data.
+     *
+     * @returns The updated checksum.
+     *
+     */
+    static uint16_t UpdateChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength, uint16_t aPosition);
+
     /**
      * This method returns `true` if the message is enqueued in any queue (`MessageQueue` or `PriorityQueue`).
      *
@@ -865,6 +982,39 @@ private:
      */
     Message *&Prev(void) { return mBuffer.mHead.mInfo.mPrev; }
 
+    /**
+     * This method returns a reference to the `mSubQueueNext` pointer.
+     *
+     * @returns A reference to the mSubQueueNext pointer.
+     *
+     */
+    Message *&SubQueueNext(void) { return mBuffer.mHead.mInfo.mSubQueueNext; }
+
+    /**
+     * This method returns a reference to the `mSubQueueNext` pointer (const pointer).
+     *
+     * @returns A reference to the mSubQueueNext pointer.
+     *
+     */
+    Message *const &SubQueueNext(void) const { return mBuffer.mHead.mInfo.mSubQueueNext; }
+
+    /**
+     * This method returns a reference to the `mSubQueuePrev` pointer.
+     *
+     * @returns A reference to the mSubQueuePrev pointer.
+     *
+     */
+    Message *&SubQueuePrev(void) { return mBuffer.mHead.mInfo.mSubQueuePrev; }
+
+    /**
+     * This method sets or clears the direct transmission flag, moving the message between the direct and indirect
+     * sub-queues if it is enqueued in a priority queue.
+     *
+     * @param[in]  aDirectTx  TRUE to schedule direct transmission, FALSE to unschedule it.
+     *
+     */
+    void UpdateDirectTransmission(bool aDirectTx);
+
     /**
      * This method returns the number of reserved header bytes.
      *
@@ -891,6 +1041,16 @@ private:
      *
      */
     otError ResizeMessage(uint16_t aLength);
+
+    /**
+     * This method returns the number of data bytes held by a (non-head) message buffer of this message.
+     *
+     * @param[in]  aBuffer  A reference to a message buffer in the buffer chain of this message.
+     *
+     * @returns The number of data bytes in @p aBuffer.
+     *
+     */
+    uint16_t GetBufferDataSize(const Buffer &aBuffer) const;
 };
 
 /**
@@ -1025,6 +1185,42 @@ public:
      */
     Message *GetHeadForPriority(uint8_t aPriority) const;
 
+    /**
+     * This method returns a pointer to the first message scheduled for direct transmission.
+     *
+     * Messages scheduled for direct transmission are kept in separate per-priority sub-queues, so the highest
+     * priority one is found without walking past the messages which are only pending indirect transmission.
+     *
+     * @returns A pointer to the oldest direct transmission message with the highest priority level, or NULL if
+     *          there is none.
+     *
+     */
+    Message *GetHeadForDirectTx(void) const;
+
+    /**
+     * This method returns a pointer to the first message not scheduled for direct transmission (e.g., a message only
+     * pending indirect transmission to sleepy children) with a priority level equal or higher than a given one.
+     *
+     * Messages are returned starting from the lowest priority level (oldest first within a priority level).
+     *
+     * @param[in] aMinPriority  The minimum priority level.
+     *
+     * @returns A pointer to the first message not scheduled for direct transmission, or NULL if there is none.
+     *
+     */
+    Message *GetHeadForIndirectTx(uint8_t aMinPriority) const;
+
+    /**
+     * This method returns a pointer to the next message not scheduled for direct transmission.
+     *
+     * @param[in] aMessage  A reference to a message in the queue which is not scheduled for direct transmission.
+     *
+     * @returns A pointer to the next message not scheduled for direct transmission (in the order described in
+     *          `GetHeadForIndirectTx()`), or NULL if there is none.
+     *
+     */
+    Message *GetNextForIndirectTx(const Message &aMessage) const;
+
     /**
      * This method adds a message to the queue.
      *
@@ -1065,6 +1261,13 @@ public:
     Message *GetTail(void) const;
 
 private:
+    enum SubQueue
+    {
+        kSubQueueDirect   = 0, ///< Messages scheduled for direct transmission.
+        kSubQueueIndirect = 1, ///< Messages not scheduled for direct transmission.
+        kNumSubQueues     = 2,
+    };
+
     /**
      * This method increases (moves forward) the given priority while ensuring to wrap from
      * priority value `kNumPriorities` -1 back to 0.
@@ -1078,6 +1281,42 @@ private:
         return (aPriority == Message::kNumPriorities - 1) ? 0 : (aPriority + 1);
     }
 
+    /**
+     * This method returns the bitmap of priority levels which have at least one message in the queue.
+     *
+     * @returns The bitmap of non-empty priority levels (bit `n` set for priority level `n`).
+     *
+     */
+    uint8_t GetPriorityMap(void) const { return mSubQueueMaps[kSubQueueDirect] | mSubQueueMaps[kSubQueueIndirect]; }
+
+    /**
+     * This static method returns the sub-queue for a given message.
+     *
+     * @param[in] aMessage  A reference to the message.
+     *
+     * @returns The sub-queue matching the direct transmission flag of @p aMessage.
+     *
+     */
+    static SubQueue GetSubQueue(const Message &aMessage)
+    {
+        return aMessage.GetDirectTransmission() ? kSubQueueDirect : kSubQueueIndirect;
+    }
+
+    /**
+     * This method returns the first message of the lowest non-empty priority level in a sub-queue, starting from a
+     * given priority level.
+     *
+     * @param[in] aSubQueue     The sub-queue.
+     * @param[in] aMinPriority  The minimum priority level.
+     *
+     * @returns A pointer to the first message, or NULL if the sub-queue has no message at or above @p aMinPriority.
+     *
+     */
+    Message *GetSubQueueHead(SubQueue aSubQueue, uint8_t aMinPriority) const;
+
+    void AddToSubQueue(Message &aMessage);
+    void RemoveFromSubQueue(Message &aMessage);
+
     /**
      * This private method finds the first non-NULL tail starting from the given priority level and moving forward.
      * It wraps from priority value `kNumPriorities` -1 back to 0.
@@ -1090,7 +1329,9 @@ private:
     Message *FindFirstNonNullTail(uint8_t aStartPriorityLevel) const;
 
 private:
-    Message *mTails[Message::kNumPriorities]; ///< Tail pointers associated with different priority levels.
+    Message *mTails[Message::kNumPriorities];                        ///< Tail pointers of the priority levels.
+    Message *mSubQueueTails[kNumSubQueues][Message::kNumPriorities]; ///< Tail pointers of the sub-queues.
+    uint8_t  mSubQueueMaps[kNumSubQueues];                           ///< Bitmaps of non-empty priority levels.
 };
 
 /**
@@ -1154,21 +1395,94 @@ public:
      */
     uint16_t GetFreeBufferCount(void) const;
 
+    /**
+     * This method returns the number of free large buffers.
+     *
+     * @returns The number of free large buffers (always zero when large buffers are not configured).
+     *
+     */
+    uint16_t GetFreeLargeBufferCount(void) const;
+
+    /**
+     * This method returns the largest number of (small) buffers that were in use at the same time.
+     *
+     * @returns The high-water mark of used buffers.
+     *
+     */
+    uint16_t GetMaxUsedBufferCount(void) const { return mMaxUsedBuffers; }
+
+    /**
+     * This method returns the largest number of large buffers that were in use at the same time.
+     *
+     * @returns The high-water mark of used large buffers.
+     *
+     */
+    uint16_t GetMaxUsedLargeBufferCount(void) const { return mMaxUsedLargeBuffers; }
+
+    /**
+     * This method returns the number of buffer allocations that could not be served from the preferred buffer class
+     * and were served from the other one instead.
+     *
+     * @returns The number of fallback buffer allocations.
+     *
+     */
+    uint16_t GetFallbackAllocationCount(void) const { return mNumFallbackAllocations; }
+
+    /**
+     * This method returns the number of buffer allocations that failed.
+     *
+     * @returns The number of failed buffer allocations.
+     *
+     */
+    uint16_t GetFailedAllocationCount(void) const { return mNumFailedAllocations; }
+
 private:
     enum
     {
         kDefaultMessagePriority = Message::kPriorityNormal,
+        kLargeBufferDataSize    = kLargeBufferSize - sizeof(struct otMessage),
     };
 
-    Buffer *NewBuffer(uint8_t aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
-    otError ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
+    Buffer * NewBuffer(uint8_t aPriority, bool aPreferLarge = false);
+    void     FreeBuffers(Buffer *aBuffer);
+    otError  ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
+    uint16_t GetFreeCapacity(void) const;
+    void     UpdateMaxUsed(void);
+
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    bool IsLargeBuffer(const Buffer &aBuffer) const
+    {
+        return (reinterpret_cast<const uint8_t *>(&aBuffer) >= reinterpret_cast<const uint8_t *>(&mLargeBuffers[0])) &&
+               (reinterpret_cast<const uint8_t *>(&aBuffer) <
+                reinterpret_cast<const uint8_t *>(&mLargeBuffers[kNumLargeBuffers]));
+    }
+#endif
+
+    uint16_t mMaxUsedBuffers;
+    uint16_t mMaxUsedLargeBuffers;
+    uint16_t mNumFallbackAllocations;
+    uint16_t mNumFailedAllocations;
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT == 0
     uint16_t mNumFreeBuffers;
     Buffer   mBuffers[kNumBuffers];
     Buffer * mFreeBuffers;
 #endif
+
+#if OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+    struct LargeBuffer
+    {
+        Buffer  mBuffer;
+        uint8_t mExtraData[kLargeBufferSize - kBufferSize];
+    };
+
+    OT_STATIC_ASSERT(OPENTHREAD_CONFIG_LARGE_MESSAGE_BUFFER_SIZE > OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+                     "large message buffers must be larger than message buffers");
+
+    uint16_t    mNumFreeLargeBuffers;
+    LargeBuffer mLargeBuffers[kNumLargeBuffers];
+    Buffer *    mFreeLargeBuffers;
+#endif
 };
 
 /**
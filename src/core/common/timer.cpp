@@ -80,6 +80,335 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+static uint8_t FindFirstSetBit(uint64_t aBits)
+{
+    uint8_t index = 0;
+
+    assert(aBits != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+    index = static_cast<uint8_t>(__builtin_ctzll(aBits));
+#else
+    while ((aBits & 1) == 0)
+    {
+        aBits >>= 1;
+        index++;
+    }
+#endif
+
+    return index;
+}
+
+static uint8_t FindLastSetBit(uint32_t aBits)
+{
+    uint8_t index = 0;
+
+    assert(aBits != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+    index = static_cast<uint8_t>(31 - __builtin_clz(aBits));
+#else
+    while (aBits >>= 1)
+    {
+        index++;
+    }
+#endif
+
+    return index;
+}
+
+void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    uint32_t now = aAlarmApi.AlarmGetNow();
+
+    Remove(aTimer, aAlarmApi);
+
+    if (mHead == NULL)
+    {
+        mWheelBase = now;
+    }
+    else
+    {
+        Advance(now);
+    }
+
+    if (IsStrictlyBefore(aTimer.mFireTime, now) && IsStrictlyBefore(aTimer.mFireTime, mWheelBase))
+    {
+        LinkEarly(aTimer, now);
+    }
+    else
+    {
+        Link(aTimer);
+    }
+
+    if ((mHead == NULL) || aTimer.DoesFireBefore(*mHead, now))
+    {
+        mHead = &aTimer;
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.mNext != &aTimer);
+
+    Unlink(aTimer);
+    aTimer.mNext = &aTimer;
+
+    if (mHead == &aTimer)
+    {
+        mHead = FindHead(aAlarmApi.AlarmGetNow());
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void TimerScheduler::Link(Timer &aTimer)
+{
+    Timer **list;
+
+    if (aTimer.mFireTime < mWheelBase)
+    {
+        list = &mOverflowList;
+    }
+    else
+    {
+        uint32_t diff  = aTimer.mFireTime ^ mWheelBase;
+        uint8_t  level = (diff == 0) ? 0 : (FindLastSetBit(diff) / kWheelSlotBits);
+        uint8_t  slot  = (aTimer.mFireTime >> (level * kWheelSlotBits)) & (kWheelSlots - 1);
+
+        list = &mWheel[level][slot];
+        mSlotMap[level] |= (static_cast<uint64_t>(1) << slot);
+        mLevelMap |= (1 << level);
+    }
+
+    // Append the timer at the tail of the list, so that timers with the same fire time keep their start order.
+
+    aTimer.mNext = NULL;
+    aTimer.mList = list;
+
+    if (*list == NULL)
+    {
+        aTimer.mPrev = &aTimer;
+        *list        = &aTimer;
+    }
+    else
+    {
+        aTimer.mPrev        = (*list)->mPrev;
+        aTimer.mPrev->mNext = &aTimer;
+        (*list)->mPrev      = &aTimer;
+    }
+}
+
+void TimerScheduler::LinkEarly(Timer &aTimer, uint32_t aNow)
+{
+    Timer *cur;
+
+    aTimer.mList = &mEarlyList;
+
+    for (cur = mEarlyList; cur; cur = cur->mNext)
+    {
+        if (aTimer.DoesFireBefore(*cur, aNow))
+        {
+            break;
+        }
+    }
+
+    aTimer.mNext = cur;
+
+    if (mEarlyList == NULL)
+    {
+        aTimer.mPrev = &aTimer;
+        mEarlyList   = &aTimer;
+    }
+    else if (cur == NULL)
+    {
+        aTimer.mPrev        = mEarlyList->mPrev;
+        aTimer.mPrev->mNext = &aTimer;
+        mEarlyList->mPrev   = &aTimer;
+    }
+    else
+    {
+        aTimer.mPrev = cur->mPrev;
+        cur->mPrev   = &aTimer;
+
+        if (cur == mEarlyList)
+        {
+            mEarlyList = &aTimer;
+        }
+        else
+        {
+            aTimer.mPrev->mNext = &aTimer;
+        }
+    }
+}
+
+void TimerScheduler::Unlink(Timer &aTimer)
+{
+    Timer *&list = *aTimer.mList;
+
+    if (&aTimer == list)
+    {
+        list = aTimer.mNext;
+
+        if (list != NULL)
+        {
+            list->mPrev = aTimer.mPrev;
+        }
+    }
+    else
+    {
+        aTimer.mPrev->mNext = aTimer.mNext;
+
+        if (aTimer.mNext != NULL)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+        else
+        {
+            list->mPrev = aTimer.mPrev;
+        }
+    }
+
+    if ((list == NULL) && IsInWheel(aTimer))
+    {
+        uint16_t index = static_cast<uint16_t>(aTimer.mList - &mWheel[0][0]);
+        uint8_t  level = static_cast<uint8_t>(index / kWheelSlots);
+
+        mSlotMap[level] &= ~(static_cast<uint64_t>(1) << (index % kWheelSlots));
+
+        if (mSlotMap[level] == 0)
+        {
+            mLevelMap &= ~(1 << level);
+        }
+    }
+}
+
+bool TimerScheduler::IsInWheel(const Timer &aTimer) const
+{
+    return (aTimer.mList != &mEarlyList) && (aTimer.mList != &mOverflowList);
+}
+
+void TimerScheduler::Cascade(Timer *&aList)
+{
+    Timer *timer = aList;
+
+    while (timer != NULL)
+    {
+        Timer *next = timer->mNext;
+
+        Unlink(*timer);
+        Link(*timer);
+        timer = next;
+    }
+}
+
+uint32_t TimerScheduler::GetSlotStart(uint8_t aLevel, uint8_t aSlot) const
+{
+    uint8_t  shift = aLevel * kWheelSlotBits;
+    uint32_t start = 0;
+
+    if (shift + kWheelSlotBits < 32)
+    {
+        start = mWheelBase & ~((1UL << (shift + kWheelSlotBits)) - 1);
+    }
+
+    return start | (static_cast<uint32_t>(aSlot) << shift);
+}
+
+void TimerScheduler::Advance(uint32_t aNow)
+{
+    // This method moves the wheel base time towards `aNow`. Any slot whose start time has been reached is cascaded
+    // down to the lower levels. The base time stops at the fire time of the earliest timer if it is already due.
+
+    while (true)
+    {
+        uint8_t  level;
+        uint8_t  slot;
+        uint32_t start;
+
+        if (mLevelMap == 0)
+        {
+            if ((mOverflowList != NULL) && (aNow < mWheelBase))
+            {
+                // The current time wrapped around, so the overflow timers are now placed relative to zero.
+                mWheelBase = 0;
+                Cascade(mOverflowList);
+                continue;
+            }
+
+            mWheelBase = aNow;
+            break;
+        }
+
+        level = FindFirstSetBit(mLevelMap);
+        slot  = FindFirstSetBit(mSlotMap[level]);
+        start = GetSlotStart(level, slot);
+
+        if (IsStrictlyBefore(aNow, start))
+        {
+            mWheelBase = aNow;
+            break;
+        }
+
+        mWheelBase = start;
+
+        if (level == 0)
+        {
+            break;
+        }
+
+        Cascade(mWheel[level][slot]);
+    }
+}
+
+Timer *TimerScheduler::FindEarliest(Timer *aList) const
+{
+    Timer *earliest = aList;
+
+    for (Timer *cur = aList; cur; cur = cur->mNext)
+    {
+        if ((cur->mFireTime - mWheelBase) < (earliest->mFireTime - mWheelBase))
+        {
+            earliest = cur;
+        }
+    }
+
+    return earliest;
+}
+
+Timer *TimerScheduler::FindHead(uint32_t aNow)
+{
+    Timer *head = NULL;
+
+    Advance(aNow);
+
+    if (mEarlyList != NULL)
+    {
+        head = mEarlyList;
+    }
+    else if (mLevelMap != 0)
+    {
+        uint8_t level = FindFirstSetBit(mLevelMap);
+        uint8_t slot  = FindFirstSetBit(mSlotMap[level]);
+
+        // All timers in a level zero slot have the same fire time.
+        head = (level == 0) ? mWheel[0][slot] : FindEarliest(mWheel[level][slot]);
+    }
+    else if (mOverflowList != NULL)
+    {
+        head = FindEarliest(mOverflowList);
+    }
+
+    return head;
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Remove(aTimer, aAlarmApi);
@@ -152,6 +481,8 @@ exit:
     return;
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
     if (mHead == NULL)
@@ -38,6 +38,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <openthread/platform/alarm-micro.h>
 #include <openthread/platform/alarm-milli.h>
@@ -95,6 +96,10 @@ public:
         , mHandler(aHandler)
         , mFireTime(0)
         , mNext(this)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        , mPrev(NULL)
+        , mList(NULL)
+#endif
     {
     }
 
@@ -133,6 +138,10 @@ protected:
     Handler  mHandler;
     uint32_t mFireTime;
     Timer *  mNext;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer * mPrev; // Previous timer in list (the first timer in a list points to the last one).
+    Timer **mList; // The head of the timing wheel list this timer is linked in.
+#endif
 };
 
 /**
@@ -328,7 +337,17 @@ protected:
     explicit TimerScheduler(Instance &aInstance)
         : InstanceLocator(aInstance)
         , mHead(NULL)
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        , mEarlyList(NULL)
+        , mOverflowList(NULL)
+        , mLevelMap(0)
+        , mWheelBase(0)
+#endif
     {
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        memset(mWheel, 0, sizeof(mWheel));
+        memset(mSlotMap, 0, sizeof(mSlotMap));
+#endif
     }
 
     /**
@@ -366,6 +385,40 @@ protected:
     void SetAlarm(const AlarmApi &aAlarmApi);
 
     Timer *mHead;
+
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+private:
+    /**
+     * The timing wheel has `kWheelLevels` levels of `kWheelSlots` slots each. A timer is placed at the level given by
+     * the highest bit in which its fire time differs from the wheel base time, and at the slot given by the fire time
+     * bits of that level. Timers in a level zero slot all have the same fire time, timers in higher level slots are
+     * cascaded down to lower levels once the wheel base time reaches the start of their slot.
+     *
+     */
+    enum
+    {
+        kWheelSlotBits = 6,
+        kWheelSlots    = (1 << kWheelSlotBits),
+        kWheelLevels   = ((32 + kWheelSlotBits - 1) / kWheelSlotBits),
+    };
+
+    void     Link(Timer &aTimer);
+    void     LinkEarly(Timer &aTimer, uint32_t aNow);
+    void     Unlink(Timer &aTimer);
+    void     Cascade(Timer *&aList);
+    void     Advance(uint32_t aNow);
+    Timer *  FindHead(uint32_t aNow);
+    Timer *  FindEarliest(Timer *aList) const;
+    uint32_t GetSlotStart(uint8_t aLevel, uint8_t aSlot) const;
+    bool     IsInWheel(const Timer &aTimer) const;
+
+    Timer *  mWheel[kWheelLevels][kWheelSlots]; // Timers (at or after `mWheelBase`) in wheel slots.
+    Timer *  mEarlyList;                        // Timers before `mWheelBase` (sorted by fire time).
+    Timer *  mOverflowList;                     // Timers after `mWheelBase` whose fire time wrapped around.
+    uint64_t mSlotMap[kWheelLevels];            // Bit map of non-empty slots per level.
+    uint8_t  mLevelMap;                         // Bit map of levels with non-empty slots.
+    uint32_t mWheelBase;
+#endif
 };
 
 /**
@@ -44,17 +44,22 @@ otError Tlv::Get(const Message &aMessage, uint8_t aType, uint16_t aMaxLength, Tl
     uint16_t offset;
 
     SuccessOrExit(error = GetOffset(aMessage, aType, offset));
-    aMessage.Read(offset, sizeof(Tlv), &aTlv);
+    Read(aMessage, offset, aMaxLength, aTlv);
+
+exit:
+    return error;
+}
+
+void Tlv::Read(const Message &aMessage, uint16_t aOffset, uint16_t aMaxLength, Tlv &aTlv)
+{
+    aMessage.Read(aOffset, sizeof(Tlv), &aTlv);
 
     if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
     {
         aMaxLength = sizeof(aTlv) + aTlv.GetLength();
     }
 
-    aMessage.Read(offset, aMaxLength, &aTlv);
-
-exit:
-    return error;
+    aMessage.Read(aOffset, aMaxLength, &aTlv);
 }
 
 otError Tlv::GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset)
@@ -136,4 +141,89 @@ exit:
     return error;
 }
 
+TlvIndex::TlvIndex(void)
+    : mMessage(NULL)
+    , mMessageOffset(0)
+    , mMessageLength(0)
+{
+}
+
+void TlvIndex::Init(const Message &aMessage)
+{
+    uint16_t offset = aMessage.GetOffset();
+    uint16_t end    = aMessage.GetLength();
+    Tlv      tlv;
+
+    mMessage       = &aMessage;
+    mMessageOffset = offset;
+    mMessageLength = end;
+
+    for (uint8_t i = 0; i < kNumTypes; i++)
+    {
+        mOffsets[i] = kNotPresent;
+    }
+
+    // Same traversal as `Tlv::GetOffset()`, which stops at the first malformed TLV.
+    while (offset + sizeof(tlv) <= end)
+    {
+        uint32_t length = sizeof(tlv);
+
+        aMessage.Read(offset, sizeof(tlv), &tlv);
+
+        if (tlv.GetLength() != Tlv::kExtendedLength)
+        {
+            length += tlv.GetLength();
+        }
+        else
+        {
+            uint16_t extLength;
+
+            VerifyOrExit(sizeof(extLength) == aMessage.Read(offset + sizeof(tlv), sizeof(extLength), &extLength));
+            length += sizeof(extLength) + HostSwap16(extLength);
+        }
+
+        VerifyOrExit(offset + length <= end);
+
+        if ((tlv.GetType() < kNumTypes) && (mOffsets[tlv.GetType()] == kNotPresent))
+        {
+            mOffsets[tlv.GetType()] = offset;
+        }
+
+        offset += static_cast<uint16_t>(length);
+    }
+
+exit:
+    return;
+}
+
+bool TlvIndex::IsIndexed(const Message &aMessage, uint8_t aType) const
+{
+    return (mMessage == &aMessage) && (aType < kNumTypes) && (aMessage.GetOffset() == mMessageOffset) &&
+           (aMessage.GetLength() == mMessageLength);
+}
+
+otError TlvIndex::Get(const Message &aMessage, uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t offset;
+
+    SuccessOrExit(error = GetOffset(aMessage, aType, offset));
+    Tlv::Read(aMessage, offset, aMaxLength, aTlv);
+
+exit:
+    return error;
+}
+
+otError TlvIndex::GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(IsIndexed(aMessage, aType), error = Tlv::GetOffset(aMessage, aType, aOffset));
+    VerifyOrExit(mOffsets[aType] != kNotPresent, error = OT_ERROR_NOT_FOUND);
+    aOffset = mOffsets[aType];
+
+exit:
+    return error;
+}
+
 } // namespace ot
@@ -185,6 +185,10 @@ protected:
     };
 
 private:
+    friend class TlvIndex;
+
+    static void Read(const Message &aMessage, uint16_t aOffset, uint16_t aMaxLength, Tlv &aTlv);
+
     uint8_t mType;
     uint8_t mLength;
 } OT_TOOL_PACKED_END;
@@ -215,6 +219,81 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements an index of the TLVs in a message.
+ *
+ * The index is built in a single pass over the message and records the offset of the first TLV of each type below
+ * `kNumTypes`. Lookups for other types, or for a message that is not (or no longer) the indexed one, fall back to
+ * scanning the message like `Tlv::Get()` and `Tlv::GetOffset()`.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor initializes the index as empty.
+     *
+     */
+    TlvIndex(void);
+
+    /**
+     * This method indexes the TLVs of @p aMessage, starting at the message offset.
+     *
+     * The message must not be modified while it is indexed.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     */
+    void Init(const Message &aMessage);
+
+    /**
+     * This method clears the index.
+     *
+     */
+    void Clear(void) { mMessage = NULL; }
+
+    /**
+     * This method reads the requested TLV out of @p aMessage.
+     *
+     * @param[in]   aMessage    A reference to the message.
+     * @param[in]   aType       The Type value to search for.
+     * @param[in]   aMaxLength  Maximum number of bytes to read.
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval OT_ERROR_NONE       Successfully copied the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV with Type @p aType.
+     *
+     */
+    otError Get(const Message &aMessage, uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const;
+
+    /**
+     * This method obtains the offset of a TLV within @p aMessage.
+     *
+     * @param[in]   aMessage    A reference to the message.
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     A reference to the offset of the TLV.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV with Type @p aType.
+     *
+     */
+    otError GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset) const;
+
+private:
+    enum
+    {
+        kNumTypes   = 32,     ///< TLV types [0, kNumTypes) are indexed.
+        kNotPresent = 0xffff, ///< Offset value for a TLV type that is not present.
+    };
+
+    bool IsIndexed(const Message &aMessage, uint8_t aType) const;
+
+    const Message *mMessage;
+    uint16_t       mMessageOffset;
+    uint16_t       mMessageLength;
+    uint16_t       mOffsets[kNumTypes];
+};
+
 } // namespace ot
 
 #endif // TLVS_HPP_
@@ -89,6 +89,32 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS
+ *
+ * Maximum number of pending CoAP requests indexed by Message ID and Token, per CoAP agent.
+ *
+ * Responses are matched to indexed requests without scanning the pending request queue. Requests sent while the
+ * index is full are still matched, by scanning the queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES
+ *
+ * Maximum number of CoAP resources indexed by URI path, per CoAP agent.
+ *
+ * Received requests are dispatched to indexed resources without comparing their URI path to every resource.
+ * Resources added while the index is full are still dispatched, by comparing them one after another.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES
+#define OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -109,4 +135,63 @@
 #define OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+ *
+ * Define to 1 to enable CoAP block-wise transfers (RFC 7959).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+ *
+ * Define to 1 to limit the outstanding confirmable messages to each peer and to keep statistics per peer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_NSTART
+ *
+ * Maximum number of outstanding confirmable messages to a peer (RFC7252 default value is 1).
+ *
+ * Confirmable messages sent beyond this limit are deferred until an outstanding one is acknowledged or times out.
+ * Only applies when `OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_NSTART
+#define OPENTHREAD_CONFIG_COAP_NSTART 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_PEERS
+ *
+ * Maximum number of peers with congestion control state, per CoAP agent.
+ *
+ * The state of the least recently used peer without outstanding messages is reused for new peers. Confirmable
+ * messages to a new peer are deferred while all peers have outstanding messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_PEERS
+#define OPENTHREAD_CONFIG_COAP_MAX_PEERS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+ *
+ * Define to 1 to adapt the retransmission timeout of each peer to the measured round-trip times (CoCoA, Congestion
+ * Control/Advanced for CoAP).
+ *
+ * Requires `OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+#define OPENTHREAD_CONFIG_COAP_COCOA_ENABLE 0
+#endif
+
 #endif // CONFIG_COAP_H_
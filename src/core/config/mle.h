@@ -78,6 +78,19 @@
 #define OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS
+ *
+ * The number of distinct multicast groups tracked in the child multicast subscription index.
+ *
+ * When children register more distinct groups than this, multicast fan-out to sleepy children falls back to
+ * checking the registered addresses of every child.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS
+#define OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_IP_ADDRS_TO_REGISTER
  *
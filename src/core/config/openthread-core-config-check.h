@@ -38,6 +38,39 @@
 #error "OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE and OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE must not both be set."
 #endif
 
+#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+#error \
+    "OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS is not supported with OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT."
+#endif
+
+#if OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE < 1
+#error "OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES < 1
+#error "OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS < 1
+#error "OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS must be at least 1."
+#endif
+
+#if OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES < 1 || OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES > 254
+#error "OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES must be between 1 and 254."
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS < 1 || OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS > 254
+#error "OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS must be between 1 and 254."
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES < 1 || OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES > 254
+#error "OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES must be between 1 and 254."
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES < 1 || OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES > 254
+#error "OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES must be between 1 and 254."
+#endif
+
 /*
  * Removed or replaced OPENTHREAD_CONFIG options.
  *
@@ -155,6 +155,20 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define to 1 to keep running timers in a hierarchical timing wheel instead of a sorted linked list.
+ *
+ * The timing wheel provides O(1) timer start and stop at the cost of additional RAM per timer scheduler (one list
+ * head per wheel slot) and two extra pointers per timer. It is intended for devices with many concurrently running
+ * timers (e.g., Border Routers with many children).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
  *
@@ -181,6 +195,32 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+ *
+ * The number of large message buffers in the buffer pool.
+ *
+ * When non-zero, the buffer pool is segregated into two buffer classes with separate free lists: the
+ * `OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS` small buffers hold message heads and short messages, and the large buffers
+ * are used for the bulk of long messages (e.g., full IPv6 datagrams), which shortens their buffer chains.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LARGE_MESSAGE_BUFFER_SIZE
+ *
+ * The size of a large message buffer in bytes (must be larger than `OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE`).
+ *
+ * Only used when `OPENTHREAD_CONFIG_NUM_LARGE_MESSAGE_BUFFERS` is non-zero.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LARGE_MESSAGE_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LARGE_MESSAGE_BUFFER_SIZE (OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE * 4)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -217,6 +257,16 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+ *
+ * The maximum number of 6LoWPAN datagrams that may be reassembled concurrently.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -260,6 +310,30 @@
 #define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+ *
+ * Define as 1 to build the builtin mbedTLS with AES-NI support (x86-64 only, selected at run time when the CPU
+ * supports it).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+#define OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+ *
+ * The number of expanded AES key schedules cached per instance by `KeyManager`, keyed by key material.
+ *
+ * Each entry holds an mbedTLS AES context. The MAC and MLE keys of the current key sequence plus the KEK or the keys
+ * of an adjacent key sequence fit in the default size.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE
+#define OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_SIZE
  *
@@ -349,6 +423,18 @@
 #define OPENTHREAD_CONFIG_DEFAULT_SED_BUFFER_SIZE 1280
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES
+ *
+ * The number of entries shared by the per-child indirect message queues. One entry is used for each (message,
+ * sleepy child) pair waiting for indirect transmission. When all entries are in use, the messages of a child are
+ * found by scanning the send queue.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES
+#define OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES (4 * OPENTHREAD_CONFIG_MLE_MAX_CHILDREN)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_SED_DATAGRAM_COUNT
  *
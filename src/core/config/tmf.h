@@ -45,6 +45,19 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT
+ *
+ * The timeout value (in seconds) blocking eviction of an address cache entry added through snooping (i.e., learned
+ * from the mesh source of a received/forwarded frame rather than from an address query).
+ *
+ * Default: 3 seconds
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT
+#define OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT 3
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT
  *
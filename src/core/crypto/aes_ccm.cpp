@@ -35,13 +35,109 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "utils/wrap_string.h"
 
 namespace ot {
 namespace Crypto {
 
-void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
+void KeyScheduleCacheBase::Clear(void)
 {
-    mEcb.SetKey(aKey, 8 * aKeyLength);
+    for (Entry *entry = &mEntries[0]; entry < &mEntries[mNumEntries]; entry++)
+    {
+        ClearEntry(*entry);
+    }
+}
+
+void KeyScheduleCacheBase::ClearEntry(Entry &aEntry)
+{
+    aEntry.mEcb.ClearKey();
+    memset(aEntry.mKey, 0, sizeof(aEntry.mKey));
+    aEntry.mKeyLength  = 0;
+    aEntry.mGeneration = 0;
+    aEntry.mLastUsed   = 0;
+}
+
+KeyScheduleCacheBase::Entry &KeyScheduleCacheBase::Load(const uint8_t *aKey, uint16_t aKeyLength)
+{
+    Entry *oldest = &mEntries[0];
+    Entry *entry;
+
+    for (entry = &mEntries[0]; entry < &mEntries[mNumEntries]; entry++)
+    {
+        if ((entry->mGeneration != 0) && (entry->mKeyLength == aKeyLength) &&
+            (memcmp(entry->mKey, aKey, aKeyLength) == 0))
+        {
+            ExitNow();
+        }
+
+        if (mUseCount - entry->mLastUsed > mUseCount - oldest->mLastUsed)
+        {
+            oldest = entry;
+        }
+    }
+
+    entry = oldest;
+
+    ClearEntry(*entry);
+    entry->mEcb.SetKey(aKey, 8 * aKeyLength);
+    memcpy(entry->mKey, aKey, aKeyLength);
+    entry->mKeyLength = aKeyLength;
+
+    // Generation zero marks an unused entry.
+    if (++mGeneration == 0)
+    {
+        mGeneration = 1;
+    }
+
+    entry->mGeneration = mGeneration;
+
+exit:
+    return *entry;
+}
+
+AesCcm::~AesCcm(void)
+{
+    memset(mKey, 0, sizeof(mKey));
+}
+
+void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength, KeyScheduleCacheBase &aKeyScheduleCache)
+{
+    assert(aKeyLength <= sizeof(mKey));
+
+    mKeyLength = (aKeyLength <= sizeof(mKey)) ? aKeyLength : static_cast<uint16_t>(sizeof(mKey));
+    memcpy(mKey, aKey, mKeyLength);
+    mKeyScheduleCache = &aKeyScheduleCache;
+    LoadKeySchedule();
+}
+
+void AesCcm::LoadKeySchedule(void)
+{
+    mKeySchedule           = &mKeyScheduleCache->Load(mKey, mKeyLength);
+    mKeyScheduleGeneration = mKeySchedule->mGeneration;
+}
+
+AesEcb &AesCcm::GetEcb(void)
+{
+    // Another `AesCcm` object may have reused the cache entry for a different key since `SetKey()`.
+    if (mKeySchedule->mGeneration != mKeyScheduleGeneration)
+    {
+        LoadKeySchedule();
+    }
+
+    mKeyScheduleCache->MarkUsed(*mKeySchedule);
+
+    return mKeySchedule->mEcb;
+}
+
+void AesCcm::IncrementCounter(void)
+{
+    for (int i = sizeof(mCtr) - 1; i > mNonceLength; i--)
+    {
+        if (++mCtr[i])
+        {
+            break;
+        }
+    }
 }
 
 otError AesCcm::Init(uint32_t    aHeaderLength,
@@ -120,7 +216,7 @@ otError AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    GetEcb().Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -171,29 +267,46 @@ exit:
 void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
 {
     const uint8_t *headerBytes = reinterpret_cast<const uint8_t *>(aHeader);
+    AesEcb &       ecb         = GetEcb();
 
     assert(mHeaderCur + aHeaderLength <= mHeaderLength);
 
+    mHeaderCur += aHeaderLength;
+
     // process header
-    for (unsigned i = 0; i < aHeaderLength; i++)
+    while (aHeaderLength > 0)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            ecb.Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
-        mBlock[mBlockLength++] ^= headerBytes[i];
-    }
+        if ((mBlockLength == 0) && (aHeaderLength >= sizeof(mBlock)))
+        {
+            // whole block
+            for (uint8_t i = 0; i < sizeof(mBlock); i++)
+            {
+                mBlock[i] ^= headerBytes[i];
+            }
 
-    mHeaderCur += aHeaderLength;
+            mBlockLength = sizeof(mBlock);
+            headerBytes += sizeof(mBlock);
+            aHeaderLength -= sizeof(mBlock);
+        }
+        else
+        {
+            mBlock[mBlockLength++] ^= *headerBytes++;
+            aHeaderLength--;
+        }
+    }
 
     if (mHeaderCur == mHeaderLength)
     {
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            ecb.Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -204,53 +317,71 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
 {
     uint8_t *plaintextBytes  = reinterpret_cast<uint8_t *>(aPlainText);
     uint8_t *ciphertextBytes = reinterpret_cast<uint8_t *>(aCipherText);
+    AesEcb & ecb             = GetEcb();
+    uint32_t length;
     uint8_t  byte;
 
     assert(mPlainTextCur + aLength <= mPlainTextLength);
 
-    for (unsigned i = 0; i < aLength; i++)
+    mPlainTextCur += aLength;
+
+    // The CTR pad and the CBC-MAC block advance in lockstep over the payload, so once both start on a block
+    // boundary whole blocks can be processed at once.
+    while (aLength > 0)
     {
-        if (mCtrLength == 16)
+        if (mCtrLength == sizeof(mCtrPad))
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
-            {
-                if (++mCtr[j])
-                {
-                    break;
-                }
-            }
-
-            mEcb.Encrypt(mCtr, mCtrPad);
+            IncrementCounter();
+            ecb.Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
-        if (aEncrypt)
+        if (mBlockLength == sizeof(mBlock))
         {
-            byte               = plaintextBytes[i];
-            ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength++];
+            ecb.Encrypt(mBlock, mBlock);
+            mBlockLength = 0;
         }
-        else
+
+        length = sizeof(mCtrPad) - mCtrLength;
+
+        if (length > static_cast<uint32_t>(sizeof(mBlock) - mBlockLength))
         {
-            byte              = ciphertextBytes[i] ^ mCtrPad[mCtrLength++];
-            plaintextBytes[i] = byte;
+            length = sizeof(mBlock) - mBlockLength;
         }
 
-        if (mBlockLength == sizeof(mBlock))
+        if (length > aLength)
         {
-            mEcb.Encrypt(mBlock, mBlock);
-            mBlockLength = 0;
+            length = aLength;
         }
 
-        mBlock[mBlockLength++] ^= byte;
-    }
+        for (uint32_t i = 0; i < length; i++)
+        {
+            if (aEncrypt)
+            {
+                byte               = plaintextBytes[i];
+                ciphertextBytes[i] = byte ^ mCtrPad[mCtrLength + i];
+            }
+            else
+            {
+                byte              = ciphertextBytes[i] ^ mCtrPad[mCtrLength + i];
+                plaintextBytes[i] = byte;
+            }
 
-    mPlainTextCur += aLength;
+            mBlock[mBlockLength + i] ^= byte;
+        }
+
+        mCtrLength += length;
+        mBlockLength += length;
+        plaintextBytes += length;
+        ciphertextBytes += length;
+        aLength -= length;
+    }
 
     if (mPlainTextCur >= mPlainTextLength)
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            ecb.Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -269,7 +400,7 @@ void AesCcm::Finalize(void *aTag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        GetEcb().Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
@@ -52,6 +52,88 @@ namespace Crypto {
  *
  */
 
+/**
+ * This class implements a cache of expanded AES key schedules, keyed by the key material.
+ *
+ * `AesCcm` objects using the same cache share its key schedules, so setting a key that was recently used with the
+ * cache does not run the AES key expansion again. The storage is provided by `KeyScheduleCache`.
+ *
+ */
+class KeyScheduleCacheBase
+{
+    friend class AesCcm;
+
+public:
+    /**
+     * This method clears all entries of the cache, zeroing their keys and expanded key schedules.
+     *
+     * `AesCcm` objects with a key set reload their key schedule when next used.
+     *
+     */
+    void Clear(void);
+
+protected:
+    enum
+    {
+        kKeyLengthMax = 32,
+    };
+
+    struct Entry
+    {
+        AesEcb   mEcb;
+        uint8_t  mKey[kKeyLengthMax];
+        uint16_t mKeyLength;
+        uint32_t mGeneration; ///< Changes whenever the entry is loaded with a new key.
+        uint32_t mLastUsed;   ///< Used to pick the least recently used entry for replacement.
+    };
+
+    KeyScheduleCacheBase(Entry *aEntries, uint8_t aNumEntries)
+        : mEntries(aEntries)
+        , mNumEntries(aNumEntries)
+        , mGeneration(0)
+        , mUseCount(0)
+    {
+    }
+
+private:
+    Entry &Load(const uint8_t *aKey, uint16_t aKeyLength);
+    void   MarkUsed(Entry &aEntry) { aEntry.mLastUsed = ++mUseCount; }
+
+    static void ClearEntry(Entry &aEntry);
+
+    Entry *  mEntries;
+    uint8_t  mNumEntries;
+    uint32_t mGeneration;
+    uint32_t mUseCount;
+};
+
+/**
+ * This class defines a cache of expanded AES key schedules with a fixed number of entries.
+ *
+ */
+template <uint8_t SIZE> class KeyScheduleCache : public KeyScheduleCacheBase
+{
+public:
+    /**
+     * This constructor initializes the cache with all entries unused.
+     *
+     */
+    KeyScheduleCache(void)
+        : KeyScheduleCacheBase(mEntries, SIZE)
+    {
+        Clear();
+    }
+
+    /**
+     * Destructor to zero the keys and expanded key schedules.
+     *
+     */
+    ~KeyScheduleCache(void) { Clear(); }
+
+private:
+    Entry mEntries[SIZE];
+};
+
 /**
  * This class implements AES CCM computation.
  *
@@ -59,14 +141,23 @@ namespace Crypto {
 class AesCcm
 {
 public:
+    /**
+     * Destructor to zero the copy of the key.
+     *
+     */
+    ~AesCcm(void);
+
     /**
      * This method sets the key.
      *
-     * @param[in]  aKey        A pointer to the key.
-     * @param[in]  aKeyLength  Length of the key in bytes.
+     * The expanded AES key schedule is taken from @p aKeyScheduleCache, which must outlive this object.
+     *
+     * @param[in]  aKey               A pointer to the key.
+     * @param[in]  aKeyLength         Length of the key in bytes.
+     * @param[in]  aKeyScheduleCache  The key schedule cache to use.
      *
      */
-    void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
+    void SetKey(const uint8_t *aKey, uint16_t aKeyLength, KeyScheduleCacheBase &aKeyScheduleCache);
 
     /**
      * This method initializes the AES CCM computation.
@@ -120,20 +211,29 @@ private:
     enum
     {
         kTagLengthMin = 4,
+        kKeyLengthMax = KeyScheduleCacheBase::kKeyLengthMax,
     };
 
-    AesEcb   mEcb;
-    uint8_t  mBlock[AesEcb::kBlockSize];
-    uint8_t  mCtr[AesEcb::kBlockSize];
-    uint8_t  mCtrPad[AesEcb::kBlockSize];
-    uint8_t  mNonceLength;
-    uint32_t mHeaderLength;
-    uint32_t mHeaderCur;
-    uint32_t mPlainTextLength;
-    uint32_t mPlainTextCur;
-    uint16_t mBlockLength;
-    uint16_t mCtrLength;
-    uint8_t  mTagLength;
+    AesEcb &GetEcb(void);
+    void    LoadKeySchedule(void);
+    void    IncrementCounter(void);
+
+    uint8_t                      mKey[kKeyLengthMax];
+    uint16_t                     mKeyLength;
+    KeyScheduleCacheBase *       mKeyScheduleCache;
+    KeyScheduleCacheBase::Entry *mKeySchedule;
+    uint32_t                     mKeyScheduleGeneration;
+    uint8_t                      mBlock[AesEcb::kBlockSize];
+    uint8_t                      mCtr[AesEcb::kBlockSize];
+    uint8_t                      mCtrPad[AesEcb::kBlockSize];
+    uint8_t                      mNonceLength;
+    uint32_t                     mHeaderLength;
+    uint32_t                     mHeaderCur;
+    uint32_t                     mPlainTextLength;
+    uint32_t                     mPlainTextCur;
+    uint16_t                     mBlockLength;
+    uint16_t                     mCtrLength;
+    uint8_t                      mTagLength;
 };
 
 /**
@@ -46,6 +46,12 @@ void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
     mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
 }
 
+void AesEcb::ClearKey(void)
+{
+    mbedtls_aes_free(&mContext);
+    mbedtls_aes_init(&mContext);
+}
+
 void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
 {
     mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
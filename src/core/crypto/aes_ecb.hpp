@@ -81,6 +81,12 @@ public:
      */
     void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method clears the key, zeroing the expanded key schedule.
+     *
+     */
+    void ClearKey(void);
+
     /**
      * This method encrypts data.
      *
@@ -909,7 +909,9 @@ exit:
     return shouldSend;
 }
 
-void Mac::ProcessTransmitAesCcm(TxFrame &aFrame, const ExtAddress *aExtAddress)
+void Mac::ProcessTransmitAesCcm(TxFrame &                     aFrame,
+                                const ExtAddress *            aExtAddress,
+                                Crypto::KeyScheduleCacheBase &aKeyScheduleCache)
 {
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -923,7 +925,7 @@ void Mac::ProcessTransmitAesCcm(TxFrame &aFrame, const ExtAddress *aExtAddress)
 
     GenerateNonce(*aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aFrame.GetAesKey(), 16);
+    aesCcm.SetKey(aFrame.GetAesKey(), 16, aKeyScheduleCache);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
     error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -996,7 +998,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame, bool aProcessAesCcm)
 
     if (aProcessAesCcm)
     {
-        ProcessTransmitAesCcm(aFrame, extAddress);
+        ProcessTransmitAesCcm(aFrame, extAddress, Get<KeyManager>().GetKeyScheduleCache());
     }
 
 exit:
@@ -1475,7 +1477,7 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    aesCcm.SetKey(macKey, 16);
+    aesCcm.SetKey(macKey, 16, keyManager.GetKeyScheduleCache());
 
     error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     VerifyOrExit(error == OT_ERROR_NONE, error = OT_ERROR_SECURITY);
@@ -602,12 +602,15 @@ public:
     /**
      * This method performs AES CCM on the frame which is going to be sent.
      *
-     * @param[in]  aFrame       A reference to the MAC frame buffer that is going to be sent.
-     * @param[in]  aExtAddress  A pointer to the extended address, which will be used to generate nonce
-     *                          for AES CCM computation.
+     * @param[in]  aFrame             A reference to the MAC frame buffer that is going to be sent.
+     * @param[in]  aExtAddress        A pointer to the extended address, which will be used to generate nonce
+     *                                for AES CCM computation.
+     * @param[in]  aKeyScheduleCache  The AES key schedule cache to use.
      *
      */
-    static void ProcessTransmitAesCcm(TxFrame &aFrame, const ExtAddress *aExtAddress);
+    static void ProcessTransmitAesCcm(TxFrame &                     aFrame,
+                                      const ExtAddress *            aExtAddress,
+                                      Crypto::KeyScheduleCacheBase &aKeyScheduleCache);
 
 private:
     enum
@@ -115,7 +115,10 @@ void SubMac::Callbacks::FrameUpdated(TxFrame &aFrame)
 
     if (aFrame.GetSecurityEnabled())
     {
-        Get<Mac>().ProcessTransmitAesCcm(aFrame, &Get<Mac>().GetExtAddress());
+        // Use a local key schedule cache, the one owned by `KeyManager` is OpenThread state.
+        Crypto::KeyScheduleCache<1> keyScheduleCache;
+
+        Get<Mac>().ProcessTransmitAesCcm(aFrame, &Get<Mac>().GetExtAddress(), keyScheduleCache);
     }
 }
 #endif
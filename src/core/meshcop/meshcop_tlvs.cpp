@@ -104,12 +104,8 @@ void SteeringDataTlv::ComputeBloomFilter(const otExtAddress &aJoinerId)
     Crc16 ccitt(Crc16::kCcitt);
     Crc16 ansi(Crc16::kAnsi);
 
-    for (size_t j = 0; j < sizeof(otExtAddress); j++)
-    {
-        uint8_t byte = aJoinerId.m8[j];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId.m8, sizeof(aJoinerId.m8));
+    ansi.Update(aJoinerId.m8, sizeof(aJoinerId.m8));
 
     SetBit(ccitt.Get() % GetNumBits());
     SetBit(ansi.Get() % GetNumBits());
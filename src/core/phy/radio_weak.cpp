@@ -32,6 +32,7 @@
 
 #include <openthread/platform/radio.h>
 
+#include "common/code_utils.hpp"
 #include "phy/phy.hpp"
 
 using namespace ot;
@@ -47,3 +48,35 @@ OT_TOOL_WEAK uint32_t otPlatRadioGetPreferredChannelMask(otInstance *aInstance)
 {
     return otPlatRadioGetSupportedChannelMask(aInstance);
 }
+
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                                        const otShortAddress *aShortAddresses,
+                                                        uint8_t               aNumEntries,
+                                                        uint8_t *             aNumAdded)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (*aNumAdded = 0; *aNumAdded < aNumEntries; (*aNumAdded)++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchShortEntry(aInstance, aShortAddresses[*aNumAdded]));
+    }
+
+exit:
+    return error;
+}
+
+OT_TOOL_WEAK otError otPlatRadioAddSrcMatchExtEntries(otInstance *        aInstance,
+                                                      const otExtAddress *aExtAddresses,
+                                                      uint8_t             aNumEntries,
+                                                      uint8_t *           aNumAdded)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (*aNumAdded = 0; *aNumAdded < aNumEntries; (*aNumAdded)++)
+    {
+        SuccessOrExit(error = otPlatRadioAddSrcMatchExtEntry(aInstance, &aExtAddresses[*aNumAdded]));
+    }
+
+exit:
+    return error;
+}
@@ -73,21 +73,32 @@ void AddressResolver::Clear(void)
 {
     memset(&mCache, 0, sizeof(mCache));
 
-    for (uint8_t i = 0; i < kCacheEntries; i++)
+    for (uint16_t i = 0; i < kHashTableSize; i++)
     {
-        mCache[i].mAge = i;
+        mHashTable[i] = kInvalidIndex;
+    }
+
+    mUnusedList.mHead     = mUnusedList.mTail = kInvalidIndex;
+    mCachedList.mHead     = mCachedList.mTail = kInvalidIndex;
+    mSnoopedList.mHead    = mSnoopedList.mTail = kInvalidIndex;
+    mQueryList.mHead      = mQueryList.mTail = kInvalidIndex;
+    mQueryRetryList.mHead = mQueryRetryList.mTail = kInvalidIndex;
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        AddToList(mUnusedList, mCache[i]);
     }
 }
 
-otError AddressResolver::GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const
+otError AddressResolver::GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const
 {
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aIndex < kCacheEntries, error = OT_ERROR_INVALID_ARGS);
     memcpy(&aEntry.mTarget, &mCache[aIndex].mTarget, sizeof(aEntry.mTarget));
     aEntry.mRloc16 = mCache[aIndex].mRloc16;
-    aEntry.mAge    = mCache[aIndex].mAge;
-    aEntry.mValid  = mCache[aIndex].mState == Cache::kStateCached;
+    aEntry.mAge    = GetCacheEntryAge(mCache[aIndex]);
+    aEntry.mValid  = mCache[aIndex].mState == Cache::kStateCached || mCache[aIndex].mState == Cache::kStateSnooped;
 
 exit:
     return error;
@@ -95,9 +106,9 @@ exit:
 
 void AddressResolver::Remove(uint8_t aRouterId)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    for (uint16_t i = 0; i < kCacheEntries; i++)
     {
-        if (Mle::Mle::GetRouterId(mCache[i].mRloc16) == aRouterId)
+        if (mCache[i].mState != Cache::kStateInvalid && Mle::Mle::GetRouterId(mCache[i].mRloc16) == aRouterId)
         {
             InvalidateCacheEntry(mCache[i], kReasonRemovingRouterId);
         }
@@ -106,51 +117,199 @@ void AddressResolver::Remove(uint8_t aRouterId)
 
 void AddressResolver::Remove(uint16_t aRloc16)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    for (uint16_t i = 0; i < kCacheEntries; i++)
     {
-        if (mCache[i].mRloc16 == aRloc16)
+        if (mCache[i].mState != Cache::kStateInvalid && mCache[i].mRloc16 == aRloc16)
         {
             InvalidateCacheEntry(mCache[i], kReasonRemovingRloc16);
         }
     }
 }
 
-AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
+uint16_t AddressResolver::GetHashTableIndex(const Ip6::Address &aEid)
 {
-    Cache *rval = NULL;
+    uint32_t hash = aEid.mFields.m32[0] ^ aEid.mFields.m32[1] ^ aEid.mFields.m32[2] ^ aEid.mFields.m32[3];
+
+    hash ^= hash >> 16;
+
+    return static_cast<uint16_t>(hash % kHashTableSize);
+}
+
+void AddressResolver::AddToHashTable(Cache &aEntry)
+{
+    uint16_t &head = mHashTable[GetHashTableIndex(aEntry.mTarget)];
+
+    aEntry.mHashNext = head;
+    head             = GetIndex(aEntry);
+}
+
+void AddressResolver::RemoveFromHashTable(Cache &aEntry)
+{
+    uint16_t  index = GetIndex(aEntry);
+    uint16_t *link  = &mHashTable[GetHashTableIndex(aEntry.mTarget)];
 
-    for (int i = 0; i < kCacheEntries; i++)
+    while (*link != kInvalidIndex)
     {
-        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
+        if (*link == index)
         {
-            continue;
+            *link = aEntry.mHashNext;
+            break;
         }
 
-        if (rval == NULL || rval->mAge < mCache[i].mAge)
+        link = &mCache[*link].mHashNext;
+    }
+
+    aEntry.mHashNext = kInvalidIndex;
+}
+
+void AddressResolver::AddToList(CacheList &aList, Cache &aEntry)
+{
+    uint16_t index = GetIndex(aEntry);
+
+    aEntry.mPrev = kInvalidIndex;
+    aEntry.mNext = aList.mHead;
+
+    if (aList.mHead != kInvalidIndex)
+    {
+        mCache[aList.mHead].mPrev = index;
+    }
+    else
+    {
+        aList.mTail = index;
+    }
+
+    aList.mHead = index;
+}
+
+void AddressResolver::RemoveFromList(CacheList &aList, Cache &aEntry)
+{
+    if (aEntry.mPrev != kInvalidIndex)
+    {
+        mCache[aEntry.mPrev].mNext = aEntry.mNext;
+    }
+    else
+    {
+        aList.mHead = aEntry.mNext;
+    }
+
+    if (aEntry.mNext != kInvalidIndex)
+    {
+        mCache[aEntry.mNext].mPrev = aEntry.mPrev;
+    }
+    else
+    {
+        aList.mTail = aEntry.mPrev;
+    }
+
+    aEntry.mPrev = kInvalidIndex;
+    aEntry.mNext = kInvalidIndex;
+}
+
+AddressResolver::CacheList &AddressResolver::GetCacheList(const Cache &aEntry)
+{
+    CacheList *list = &mUnusedList;
+
+    switch (aEntry.mState)
+    {
+    case Cache::kStateInvalid:
+        break;
+
+    case Cache::kStateQuery:
+        // Entries with an address query in progress (no failures yet) are kept separate from the ones in retry
+        // interval, since only the latter may be evicted.
+        list = (aEntry.mFailures == 0) ? &mQueryList : &mQueryRetryList;
+        break;
+
+    case Cache::kStateCached:
+        list = &mCachedList;
+        break;
+
+    case Cache::kStateSnooped:
+        list = &mSnoopedList;
+        break;
+    }
+
+    return *list;
+}
+
+uint16_t AddressResolver::GetCacheEntryAge(const Cache &aEntry) const
+{
+    uint16_t age = 0;
+
+    for (uint16_t index = aEntry.mPrev; index != kInvalidIndex; index = mCache[index].mPrev)
+    {
+        age++;
+    }
+
+    return age;
+}
+
+AddressResolver::Cache *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
+{
+    Cache *entry = NULL;
+
+    for (uint16_t index = mHashTable[GetHashTableIndex(aEid)]; index != kInvalidIndex; index = mCache[index].mHashNext)
+    {
+        if (mCache[index].mTarget == aEid)
         {
-            rval = &mCache[i];
+            entry = &mCache[index];
+            break;
         }
     }
 
+    return entry;
+}
+
+AddressResolver::Cache *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
+{
+    Cache *rval = NULL;
+
+    if (mUnusedList.mHead != kInvalidIndex)
+    {
+        ExitNow(rval = &mCache[mUnusedList.mHead]);
+    }
+
+    // The snooped list tail is the oldest snooped entry, so if its eviction block timeout has not yet expired, the
+    // same holds for all other snooped entries.
+
+    if (mSnoopedList.mTail != kInvalidIndex && mCache[mSnoopedList.mTail].mTimeout == 0)
+    {
+        rval = &mCache[mSnoopedList.mTail];
+    }
+    else if (aSnoopedEntry)
+    {
+        // A snooped entry never replaces a cached entry or an entry in address query.
+        ExitNow();
+    }
+    else if (mQueryRetryList.mTail != kInvalidIndex)
+    {
+        rval = &mCache[mQueryRetryList.mTail];
+    }
+    else if (mCachedList.mTail != kInvalidIndex)
+    {
+        rval = &mCache[mCachedList.mTail];
+    }
+
     if (rval != NULL)
     {
         InvalidateCacheEntry(*rval, kReasonEvictingForNewEntry);
     }
 
+exit:
     return rval;
 }
 
 void AddressResolver::MarkCacheEntryAsUsed(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    RemoveFromList(GetCacheList(aEntry), aEntry);
+
+    if (aEntry.mState == Cache::kStateSnooped)
     {
-        if (mCache[i].mAge < aEntry.mAge)
-        {
-            mCache[i].mAge++;
-        }
+        aEntry.mTimeout = 0;
+        aEntry.mState   = Cache::kStateCached;
     }
 
-    aEntry.mAge = 0;
+    AddToList(GetCacheList(aEntry), aEntry);
 }
 
 const char *AddressResolver::ConvertInvalidationReasonToString(InvalidationReason aReason)
@@ -183,90 +342,123 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry, InvalidationReason aRe
 {
     OT_UNUSED_VARIABLE(aReason);
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mAge > aEntry.mAge)
-        {
-            mCache[i].mAge--;
-        }
-    }
-
     switch (aEntry.mState)
     {
+    case Cache::kStateInvalid:
+        ExitNow();
+
     case Cache::kStateCached:
         otLogNoteArp("Cache entry removed: %s, 0x%04x - %s", aEntry.mTarget.ToString().AsCString(), aEntry.mRloc16,
                      ConvertInvalidationReasonToString(aReason));
         break;
 
+    case Cache::kStateSnooped:
+        otLogNoteArp("Cache entry (snoop) removed: %s, 0x%04x - %s", aEntry.mTarget.ToString().AsCString(),
+                     aEntry.mRloc16, ConvertInvalidationReasonToString(aReason));
+        break;
+
     case Cache::kStateQuery:
         otLogNoteArp("Cache entry (query mode) removed: %s, timeout:%d, retry:%d - %s",
                      aEntry.mTarget.ToString().AsCString(), aEntry.mTimeout, aEntry.mRetryTimeout,
                      ConvertInvalidationReasonToString(aReason));
         break;
-
-    default:
-        break;
     }
 
-    aEntry.mAge   = kCacheEntries - 1;
+    RemoveFromList(GetCacheList(aEntry), aEntry);
+    RemoveFromHashTable(aEntry);
+
     aEntry.mState = Cache::kStateInvalid;
+    AddToList(mUnusedList, aEntry);
+
+exit:
+    return;
 }
 
 void AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    Cache *entry = FindCacheEntry(aEid);
+
+    VerifyOrExit(entry != NULL);
+    UpdateCacheEntry(*entry, aRloc16);
+
+exit:
+    return;
+}
+
+void AddressResolver::AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
+{
+    Cache *entry = FindCacheEntry(aEid);
+
+    if (entry != NULL)
     {
-        if (mCache[i].mState == Cache::kStateInvalid || mCache[i].mTarget != aEid)
-        {
-            continue;
-        }
+        UpdateCacheEntry(*entry, aRloc16);
+        ExitNow();
+    }
 
-        if (mCache[i].mRloc16 != aRloc16)
-        {
-            // not updating the age here is intentional because this cache entry is not actually being used
-            mCache[i].mRloc16 = aRloc16;
+    VerifyOrExit(!aEid.IsMulticast() && !aEid.IsLinkLocal() && !aEid.IsRoutingLocator() &&
+                 !aEid.IsAnycastRoutingLocator());
+    VerifyOrExit((entry = NewCacheEntry(/* aSnoopedEntry */ true)) != NULL);
 
-            if (mCache[i].mState != Cache::kStateCached)
-            {
-                mCache[i].mRetryTimeout        = 0;
-                mCache[i].mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
-                mCache[i].mTimeout             = 0;
-                mCache[i].mFailures            = 0;
-                mCache[i].mState               = Cache::kStateCached;
+    RemoveFromList(mUnusedList, *entry);
 
-                Get<MeshForwarder>().HandleResolved(aEid, OT_ERROR_NONE);
-            }
+    entry->mTarget              = aEid;
+    entry->mRloc16              = aRloc16;
+    entry->mRetryTimeout        = 0;
+    entry->mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+    entry->mTimeout             = kSnoopBlockEvictionTimeout;
+    entry->mFailures            = 0;
+    entry->mState               = Cache::kStateSnooped;
 
-            otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
-        }
+    AddToList(mSnoopedList, *entry);
+    AddToHashTable(*entry);
 
-        ExitNow();
+    if (!mTimer.IsRunning())
+    {
+        mTimer.Start(kStateUpdatePeriod);
     }
 
+    otLogNoteArp("Cache entry added (snoop): %s, 0x%04x", aEid.ToString().AsCString(), aRloc16);
+
 exit:
     return;
 }
 
-otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
+void AddressResolver::UpdateCacheEntry(Cache &aEntry, Mac::ShortAddress aRloc16)
 {
-    otError error = OT_ERROR_NONE;
-    Cache * entry = NULL;
+    VerifyOrExit(aEntry.mRloc16 != aRloc16);
+
+    // not updating the age here is intentional because this cache entry is not actually being used
+    aEntry.mRloc16 = aRloc16;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    if (aEntry.mState == Cache::kStateQuery)
     {
-        if (mCache[i].mState != Cache::kStateInvalid)
-        {
-            if (mCache[i].mTarget == aEid)
-            {
-                entry = &mCache[i];
-                break;
-            }
-        }
+        RemoveFromList(GetCacheList(aEntry), aEntry);
+
+        aEntry.mRetryTimeout        = 0;
+        aEntry.mLastTransactionTime = static_cast<uint32_t>(kLastTransactionTimeInvalid);
+        aEntry.mTimeout             = 0;
+        aEntry.mFailures            = 0;
+        aEntry.mState               = Cache::kStateCached;
+
+        AddToList(mCachedList, aEntry);
+
+        Get<MeshForwarder>().HandleResolved(aEntry.mTarget, OT_ERROR_NONE);
     }
 
+    otLogNoteArp("Cache entry updated (snoop): %s, 0x%04x", aEntry.mTarget.ToString().AsCString(), aRloc16);
+
+exit:
+    return;
+}
+
+otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
+{
+    otError error = OT_ERROR_NONE;
+    Cache * entry = FindCacheEntry(aEid);
+
     if (entry == NULL)
     {
-        entry = NewCacheEntry();
+        entry = NewCacheEntry(/* aSnoopedEntry */ false);
     }
 
     VerifyOrExit(entry != NULL, error = OT_ERROR_NO_BUFS);
@@ -275,13 +467,16 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
     {
     case Cache::kStateInvalid:
         SuccessOrExit(error = SendAddressQuery(aEid));
+        RemoveFromList(mUnusedList, *entry);
         entry->mTarget       = aEid;
         entry->mRloc16       = Mac::kShortAddrInvalid;
         entry->mTimeout      = kAddressQueryTimeout;
         entry->mFailures     = 0;
         entry->mRetryTimeout = kAddressQueryInitialRetryDelay;
         entry->mState        = Cache::kStateQuery;
-        error                = OT_ERROR_ADDRESS_QUERY;
+        AddToList(mQueryList, *entry);
+        AddToHashTable(*entry);
+        error = OT_ERROR_ADDRESS_QUERY;
         break;
 
     case Cache::kStateQuery:
@@ -303,6 +498,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         break;
 
     case Cache::kStateCached:
+    case Cache::kStateSnooped:
         aRloc16 = entry->mRloc16;
         MarkCacheEntryAsUsed(*entry);
         break;
@@ -366,6 +562,7 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
     ThreadRloc16Tlv              rloc16Tlv;
     ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
     uint32_t                     lastTransactionTime;
+    Cache *                      entry;
 
     VerifyOrExit(aMessage.GetType() == OT_COAP_TYPE_CONFIRMABLE && aMessage.GetCode() == OT_COAP_CODE_POST);
 
@@ -393,56 +590,55 @@ void AddressResolver::HandleAddressNotification(Coap::Message &aMessage, const I
                  HostSwap16(aMessageInfo.GetPeerAddr().mFields.m16[7]), targetTlv.GetTarget().ToString().AsCString(),
                  rloc16Tlv.GetRloc16());
 
-    for (int i = 0; i < kCacheEntries; i++)
+    VerifyOrExit((entry = FindCacheEntry(targetTlv.GetTarget())) != NULL);
+
+    switch (entry->mState)
     {
-        if (mCache[i].mTarget != targetTlv.GetTarget())
-        {
-            continue;
-        }
+    case Cache::kStateInvalid:
+        break;
 
-        switch (mCache[i].mState)
+    case Cache::kStateCached:
+        if (entry->mLastTransactionTime != kLastTransactionTimeInvalid)
         {
-        case Cache::kStateInvalid:
-            break;
-
-        case Cache::kStateCached:
-            if (mCache[i].mLastTransactionTime != kLastTransactionTimeInvalid)
+            if (memcmp(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid)) != 0)
             {
-                if (memcmp(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid)) != 0)
-                {
-                    SendAddressError(targetTlv, mlIidTlv, NULL);
-                    ExitNow();
-                }
+                SendAddressError(targetTlv, mlIidTlv, NULL);
+                ExitNow();
+            }
 
-                if (lastTransactionTime >= mCache[i].mLastTransactionTime)
-                {
-                    ExitNow();
-                }
+            if (lastTransactionTime >= entry->mLastTransactionTime)
+            {
+                ExitNow();
             }
+        }
 
-            // fall through
+        // fall through
 
-        case Cache::kStateQuery:
-            memcpy(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid));
-            mCache[i].mRloc16              = rloc16Tlv.GetRloc16();
-            mCache[i].mRetryTimeout        = 0;
-            mCache[i].mLastTransactionTime = lastTransactionTime;
-            mCache[i].mTimeout             = 0;
-            mCache[i].mFailures            = 0;
-            mCache[i].mState               = Cache::kStateCached;
-            MarkCacheEntryAsUsed(mCache[i]);
+    case Cache::kStateSnooped:
+    case Cache::kStateQuery:
+        RemoveFromList(GetCacheList(*entry), *entry);
 
-            otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
-                         targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
+        memcpy(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid));
+        entry->mRloc16              = rloc16Tlv.GetRloc16();
+        entry->mRetryTimeout        = 0;
+        entry->mLastTransactionTime = lastTransactionTime;
+        entry->mTimeout             = 0;
+        entry->mFailures            = 0;
+        entry->mState               = Cache::kStateCached;
 
-            if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
-            {
-                otLogInfoArp("Sending address notification acknowledgment");
-            }
+        // Adding to the head of the cached list marks the entry as most recently used.
+        AddToList(mCachedList, *entry);
 
-            Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
-            break;
+        otLogNoteArp("Cache entry updated (notification): %s, 0x%04x, lastTrans:%d",
+                     targetTlv.GetTarget().ToString().AsCString(), rloc16Tlv.GetRloc16(), lastTransactionTime);
+
+        if (Get<Coap::Coap>().SendEmptyAck(aMessage, aMessageInfo) == OT_ERROR_NONE)
+        {
+            otLogInfoArp("Sending address notification acknowledgment");
         }
+
+        Get<MeshForwarder>().HandleResolved(targetTlv.GetTarget(), OT_ERROR_NONE);
+        break;
     }
 
 exit:
@@ -682,44 +878,62 @@ void AddressResolver::HandleTimer(Timer &aTimer)
 
 void AddressResolver::HandleTimer(void)
 {
-    bool continueTimer = false;
+    // The query retry list is processed first, so an entry moved to it on query timeout below is not updated twice.
+    CacheList *queryLists[]  = {&mQueryRetryList, &mQueryList};
+    bool       continueTimer = false;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(queryLists); i++)
     {
-        if (mCache[i].mState != Cache::kStateQuery)
-        {
-            continue;
-        }
-
-        continueTimer = true;
+        uint16_t next;
 
-        if (mCache[i].mTimeout > 0)
+        for (uint16_t index = queryLists[i]->mHead; index != kInvalidIndex; index = next)
         {
-            mCache[i].mTimeout--;
+            Cache &entry = mCache[index];
+
+            next          = entry.mNext;
+            continueTimer = true;
 
-            if (mCache[i].mTimeout == 0)
+            if (entry.mTimeout > 0)
             {
-                mCache[i].mRetryTimeout =
-                    static_cast<uint16_t>(kAddressQueryInitialRetryDelay * (1 << mCache[i].mFailures));
+                entry.mTimeout--;
 
-                if (mCache[i].mRetryTimeout < kAddressQueryMaxRetryDelay)
+                if (entry.mTimeout == 0)
                 {
-                    mCache[i].mFailures++;
-                }
-                else
-                {
-                    mCache[i].mRetryTimeout = kAddressQueryMaxRetryDelay;
-                }
+                    RemoveFromList(GetCacheList(entry), entry);
+
+                    entry.mRetryTimeout =
+                        static_cast<uint16_t>(kAddressQueryInitialRetryDelay * (1 << entry.mFailures));
+
+                    if (entry.mRetryTimeout < kAddressQueryMaxRetryDelay)
+                    {
+                        entry.mFailures++;
+                    }
+                    else
+                    {
+                        entry.mRetryTimeout = kAddressQueryMaxRetryDelay;
+                    }
+
+                    AddToList(GetCacheList(entry), entry);
 
-                otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
-                             mCache[i].mTarget.ToString().AsCString(), mCache[i].mRetryTimeout);
+                    otLogInfoArp("Timed out waiting for address notification for %s, retry: %d",
+                                 entry.mTarget.ToString().AsCString(), entry.mRetryTimeout);
 
-                Get<MeshForwarder>().HandleResolved(mCache[i].mTarget, OT_ERROR_DROP);
+                    Get<MeshForwarder>().HandleResolved(entry.mTarget, OT_ERROR_DROP);
+                }
+            }
+            else if (entry.mRetryTimeout > 0)
+            {
+                entry.mRetryTimeout--;
             }
         }
-        else if (mCache[i].mRetryTimeout > 0)
+    }
+
+    for (uint16_t index = mSnoopedList.mHead; index != kInvalidIndex; index = mCache[index].mNext)
+    {
+        if (mCache[index].mTimeout > 0)
         {
-            mCache[i].mRetryTimeout--;
+            mCache[index].mTimeout--;
+            continueTimer = true;
         }
     }
 
@@ -748,19 +962,16 @@ void AddressResolver::HandleIcmpReceive(Message &               aMessage,
     OT_UNUSED_VARIABLE(aMessageInfo);
 
     Ip6::Header ip6Header;
+    Cache *     entry;
 
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::IcmpHeader::kTypeDstUnreach);
     VerifyOrExit(aIcmpHeader.GetCode() == Ip6::IcmpHeader::kCodeDstUnreachNoRoute);
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header));
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid && mCache[i].mTarget == ip6Header.GetDestination())
-        {
-            InvalidateCacheEntry(mCache[i], kReasonReceivedIcmpDstUnreachNoRoute);
-            break;
-        }
-    }
+    entry = FindCacheEntry(ip6Header.GetDestination());
+    VerifyOrExit(entry != NULL);
+
+    InvalidateCacheEntry(*entry, kReasonReceivedIcmpDstUnreachNoRoute);
 
 exit:
     return;
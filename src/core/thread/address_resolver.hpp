@@ -43,6 +43,7 @@
 #include "net/icmp6.hpp"
 #include "net/udp6.hpp"
 #include "thread/thread_tlvs.hpp"
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -84,7 +85,7 @@ public:
      * @retval OT_ERROR_INVALID_ARGS  @p aIndex was out of bounds.
      *
      */
-    otError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
+    otError GetEntry(uint16_t aIndex, otEidCacheEntry &aEntry) const;
 
     /**
      * This method removes the EID-to-RLOC cache entries corresponding to an RLOC16.
@@ -103,7 +104,7 @@ public:
     void Remove(uint8_t aRouterId);
 
     /**
-     * This method updates an existing cache entry for the EID, if one exists.
+     * This method updates an existing cache entry for the EID from a snooped (received) frame.
      *
      * @param[in]  aEid     A reference to the EID.
      * @param[in]  aRloc16  The RLOC16 corresponding to @p aEid.
@@ -111,6 +112,18 @@ public:
      */
     void UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
 
+    /**
+     * This method updates the cache entry for the EID from a snooped frame destined to this device (or its child).
+     *
+     * If there is no cache entry for the EID, a new snooped entry is added if one can be allocated without evicting
+     * any cached (in use) entry or any entry with an active address query.
+     *
+     * @param[in]  aEid     A reference to the EID.
+     * @param[in]  aRloc16  The RLOC16 corresponding to @p aEid.
+     *
+     */
+    void AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
+
     /**
      * This method returns the RLOC16 for a given EID, or initiates an Address Query if the mapping is not known.
      *
@@ -129,6 +142,7 @@ private:
     enum
     {
         kCacheEntries      = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
+        kHashTableSize     = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
         kStateUpdatePeriod = 1000u, ///< State update period in milliseconds.
     };
 
@@ -141,6 +155,7 @@ private:
         kAddressQueryTimeout           = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_TIMEOUT,             // in seconds
         kAddressQueryInitialRetryDelay = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_INITIAL_RETRY_DELAY, // in seconds
         kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY,     // in seconds
+        kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT,         // in seconds
     };
 
     enum
@@ -148,6 +163,14 @@ private:
         kLastTransactionTimeInvalid = 0xffffffff, ///< Used when entry is populated using forwarded data message.
     };
 
+    enum
+    {
+        kInvalidIndex = 0xffff, ///< Used to indicate the end of a cache entry list.
+    };
+
+    OT_STATIC_ASSERT(OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES < 0xffff,
+                     "Address cache entry index cannot fit in 16 bits!");
+
     struct Cache
     {
         enum State
@@ -155,6 +178,7 @@ private:
             kStateInvalid,
             kStateQuery,
             kStateCached,
+            kStateSnooped,
         };
 
         Ip6::Address      mTarget;
@@ -162,12 +186,25 @@ private:
         uint32_t          mLastTransactionTime;
         Mac::ShortAddress mRloc16;
         uint16_t          mRetryTimeout;
-        uint8_t           mTimeout;
+        uint16_t          mPrev;     // Previous entry in the (LRU ordered) entry list.
+        uint16_t          mNext;     // Next entry in the (LRU ordered) entry list.
+        uint16_t          mHashNext; // Next entry in the same hash table bucket.
+        uint8_t           mTimeout;  // Query timeout, or eviction block timeout for a snooped entry.
         uint8_t           mFailures;
-        uint8_t           mAge;
         State             mState;
     };
 
+    /**
+     * This structure represents a doubly linked list of cache entries, ordered from the most recently used entry
+     * (head) to the least recently used entry (tail).
+     *
+     */
+    struct CacheList
+    {
+        uint16_t mHead;
+        uint16_t mTail;
+    };
+
     enum InvalidationReason
     {
         kReasonRemovingRouterId,
@@ -178,9 +215,21 @@ private:
 
     static const char *ConvertInvalidationReasonToString(InvalidationReason aReason);
 
-    Cache *NewCacheEntry(void);
-    void   MarkCacheEntryAsUsed(Cache &aEntry);
-    void   InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason);
+    Cache *    FindCacheEntry(const Ip6::Address &aEid);
+    Cache *    NewCacheEntry(bool aSnoopedEntry);
+    void       MarkCacheEntryAsUsed(Cache &aEntry);
+    void       UpdateCacheEntry(Cache &aEntry, Mac::ShortAddress aRloc16);
+    void       InvalidateCacheEntry(Cache &aEntry, InvalidationReason aReason);
+    CacheList &GetCacheList(const Cache &aEntry);
+    uint16_t   GetCacheEntryAge(const Cache &aEntry) const;
+    uint16_t   GetIndex(const Cache &aEntry) const { return static_cast<uint16_t>(&aEntry - mCache); }
+
+    void AddToList(CacheList &aList, Cache &aEntry);
+    void RemoveFromList(CacheList &aList, Cache &aEntry);
+    void AddToHashTable(Cache &aEntry);
+    void RemoveFromHashTable(Cache &aEntry);
+
+    static uint16_t GetHashTableIndex(const Ip6::Address &aEid);
 
     otError SendAddressQuery(const Ip6::Address &aEid);
     otError SendAddressError(const ThreadTargetTlv &      aTarget,
@@ -215,6 +264,12 @@ private:
     Coap::Resource   mAddressQuery;
     Coap::Resource   mAddressNotification;
     Cache            mCache[kCacheEntries];
+    uint16_t         mHashTable[kHashTableSize];
+    CacheList        mUnusedList;
+    CacheList        mCachedList;
+    CacheList        mSnoopedList;
+    CacheList        mQueryList;
+    CacheList        mQueryRetryList;
     Ip6::IcmpHandler mIcmpHandler;
     TimerMilli       mTimer;
 };
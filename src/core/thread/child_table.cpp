@@ -36,11 +36,25 @@
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
+#include "thread/mle_constants.hpp"
 
 namespace ot {
 
 #if OPENTHREAD_FTD
 
+bool ChildMask::IsEmpty(void) const
+{
+    bool rval = true;
+
+    for (uint8_t i = 0; i < sizeof(mMask); i++)
+    {
+        VerifyOrExit(mMask[i] == 0, rval = false);
+    }
+
+exit:
+    return rval;
+}
+
 ChildTable::Iterator::Iterator(Instance &aInstance, StateFilter aFilter)
     : InstanceLocator(aInstance)
     , mFilter(aFilter)
@@ -101,8 +115,14 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+{
+    Clear();
+}
+
+void ChildTable::Clear(void)
 {
     memset(mChildren, 0, sizeof(mChildren));
+    ClearIndexes();
 }
 
 Child *ChildTable::GetChildAtIndex(uint8_t aChildIndex)
@@ -124,7 +144,7 @@ Child *ChildTable::GetNewChild(void)
     {
         if (child->GetState() == Child::kStateInvalid)
         {
-            memset(child, 0, sizeof(Child));
+            ClearChild(*child);
             ExitNow();
         }
     }
@@ -135,13 +155,51 @@ exit:
     return child;
 }
 
+void ChildTable::ClearChild(Child &aChild)
+{
+    RemoveFromIndex(kIndexRloc16, aChild);
+    RemoveFromIndex(kIndexExtAddress, aChild);
+    memset(&aChild, 0, sizeof(Child));
+}
+
+void ChildTable::SetChildRloc16(Child &aChild, uint16_t aRloc16)
+{
+    RemoveFromIndex(kIndexRloc16, aChild);
+    aChild.SetRloc16(aRloc16);
+    AddToIndex(kIndexRloc16, aChild);
+}
+
+void ChildTable::SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aExtAddress)
+{
+    RemoveFromIndex(kIndexExtAddress, aChild);
+    aChild.SetExtAddress(aExtAddress);
+    AddToIndex(kIndexExtAddress, aChild);
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, StateFilter aFilter)
 {
     Child *child = mChildren;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    if (aFilter == kInStateAnyExceptValidOrRestoring)
     {
-        if (MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
+        // This filter also accepts unused (invalid) entries, which are not indexed.
+
+        for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+        {
+            if (MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
+            {
+                ExitNow();
+            }
+        }
+
+        ExitNow(child = NULL);
+    }
+
+    for (uint16_t slot = HashRloc16(aRloc16); mRloc16Index[slot] != kIndexEmpty; slot = GetNextSlot(slot))
+    {
+        child = &mChildren[mRloc16Index[slot]];
+
+        if ((child->GetRloc16() == aRloc16) && MatchesFilter(*child, aFilter))
         {
             ExitNow();
         }
@@ -157,9 +215,26 @@ Child *ChildTable::FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilte
 {
     Child *child = mChildren;
 
-    for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+    if (aFilter == kInStateAnyExceptValidOrRestoring)
     {
-        if (MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
+        // This filter also accepts unused (invalid) entries, which are not indexed.
+
+        for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
+        {
+            if (MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
+            {
+                ExitNow();
+            }
+        }
+
+        ExitNow(child = NULL);
+    }
+
+    for (uint16_t slot = HashExtAddress(aAddress); mExtAddressIndex[slot] != kIndexEmpty; slot = GetNextSlot(slot))
+    {
+        child = &mChildren[mExtAddressIndex[slot]];
+
+        if ((child->GetExtAddress() == aAddress) && MatchesFilter(*child, aFilter))
         {
             ExitNow();
         }
@@ -272,6 +347,90 @@ bool ChildTable::MatchesFilter(const Child &aChild, StateFilter aFilter)
     return rval;
 }
 
+uint16_t ChildTable::HashRloc16(uint16_t aRloc16)
+{
+    // Child IDs are allocated sequentially, so the child ID maps children to distinct slots.
+    return (aRloc16 & Mle::kMaxChildId) % kIndexSize;
+}
+
+uint16_t ChildTable::HashExtAddress(const Mac::ExtAddress &aExtAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aExtAddress.m8); i++)
+    {
+        hash = static_cast<uint16_t>((hash << 5) + hash + aExtAddress.m8[i]);
+    }
+
+    return hash % kIndexSize;
+}
+
+uint16_t ChildTable::GetHomeSlot(IndexType aType, const Child &aChild) const
+{
+    return (aType == kIndexRloc16) ? HashRloc16(aChild.GetRloc16()) : HashExtAddress(aChild.GetExtAddress());
+}
+
+void ChildTable::AddToIndex(IndexType aType, const Child &aChild)
+{
+    uint8_t *index = GetIndex(aType);
+    uint16_t slot  = GetHomeSlot(aType, aChild);
+
+    // An index holds at most `kMaxChildren` entries in `kIndexSize` slots, so an empty slot is always found.
+
+    while (index[slot] != kIndexEmpty)
+    {
+        slot = GetNextSlot(slot);
+    }
+
+    index[slot] = GetChildIndex(aChild);
+}
+
+void ChildTable::RemoveFromIndex(IndexType aType, const Child &aChild)
+{
+    uint8_t *index      = GetIndex(aType);
+    uint8_t  childIndex = GetChildIndex(aChild);
+    uint16_t slot;
+    uint16_t next;
+
+    // The slot is searched by child index (and not by key) so that the entry is found even if the
+    // child entry was changed directly.
+
+    for (slot = 0; slot < kIndexSize; slot++)
+    {
+        if (index[slot] == childIndex)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(slot < kIndexSize);
+
+    // Shift back the entries following the removed one in its probe sequence, so that every
+    // indexed entry stays reachable from its home slot without gaps.
+
+    for (next = GetNextSlot(slot); index[next] != kIndexEmpty; next = GetNextSlot(next))
+    {
+        uint16_t home = GetHomeSlot(aType, mChildren[index[next]]);
+
+        if ((slot <= next) ? (home <= slot || home > next) : (home <= slot && home > next))
+        {
+            index[slot] = index[next];
+            slot        = next;
+        }
+    }
+
+    index[slot] = kIndexEmpty;
+
+exit:
+    return;
+}
+
+void ChildTable::ClearIndexes(void)
+{
+    memset(mRloc16Index, kIndexEmpty, sizeof(mRloc16Index));
+    memset(mExtAddressIndex, kIndexEmpty, sizeof(mExtAddressIndex));
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
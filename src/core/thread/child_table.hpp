@@ -36,6 +36,9 @@
 
 #include "openthread-core-config.h"
 
+#include "utils/wrap_string.h"
+
+#include "common/encoding.hpp"
 #include "common/locator.hpp"
 #include "thread/topology.hpp"
 
@@ -43,6 +46,67 @@ namespace ot {
 
 #if OPENTHREAD_FTD
 
+/**
+ * This class represents a set of children, as a bit vector indexed by child table index.
+ *
+ */
+class ChildMask
+{
+public:
+    /**
+     * This constructor initializes an empty child mask.
+     *
+     */
+    ChildMask(void) { Clear(); }
+
+    /**
+     * This method removes all children from the mask.
+     *
+     */
+    void Clear(void) { memset(mMask, 0, sizeof(mMask)); }
+
+    /**
+     * This method indicates whether the mask is empty.
+     *
+     * @retval TRUE   If no child is in the mask.
+     * @retval FALSE  If at least one child is in the mask.
+     *
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * This method indicates whether a child is in the mask.
+     *
+     * @param[in]  aChildIndex  The child table index.
+     *
+     * @retval TRUE   If the child is in the mask.
+     * @retval FALSE  If the child is not in the mask.
+     *
+     */
+    bool Has(uint8_t aChildIndex) const { return (mMask[aChildIndex / CHAR_BIT] & GetBit(aChildIndex)) != 0; }
+
+    /**
+     * This method adds a child to the mask.
+     *
+     * @param[in]  aChildIndex  The child table index.
+     *
+     */
+    void Add(uint8_t aChildIndex) { mMask[aChildIndex / CHAR_BIT] |= GetBit(aChildIndex); }
+
+    /**
+     * This method removes a child from the mask.
+     *
+     * @param[in]  aChildIndex  The child table index.
+     *
+     */
+    void Remove(uint8_t aChildIndex) { mMask[aChildIndex / CHAR_BIT] &= ~GetBit(aChildIndex); }
+
+private:
+    static uint8_t GetBit(uint8_t aChildIndex) { return static_cast<uint8_t>(0x80 >> (aChildIndex % CHAR_BIT)); }
+
+    uint8_t mMask[BitVectorBytes(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN)];
+};
+
 /**
  * This class represents the Thread child table.
  *
@@ -170,7 +234,7 @@ public:
      * This method clears the child table.
      *
      */
-    void Clear(void) { memset(mChildren, 0, sizeof(mChildren)); }
+    void Clear(void);
 
     /**
      * This method returns the child table index for a given `Child` instance.
@@ -193,6 +257,38 @@ public:
      */
     Child *GetChildAtIndex(uint8_t aChildIndex);
 
+    /**
+     * This method clears a `Child` entry (`memset` to zero) and removes it from the child table lookup indexes.
+     *
+     * @param[in]  aChild  A reference to a `Child` entry in the child table.
+     *
+     */
+    void ClearChild(Child &aChild);
+
+    /**
+     * This method sets the RLOC16 of a `Child` entry and updates the child table lookup index.
+     *
+     * The RLOC16 of a child in the table MUST be changed through this method (and not directly using
+     * `Child::SetRloc16()`) for `FindChild()` to find the child by its RLOC16.
+     *
+     * @param[in]  aChild   A reference to a `Child` entry in the child table.
+     * @param[in]  aRloc16  The RLOC16 to assign to the child.
+     *
+     */
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16);
+
+    /**
+     * This method sets the extended address of a `Child` entry and updates the child table lookup index.
+     *
+     * The extended address of a child in the table MUST be changed through this method (and not directly using
+     * `Child::SetExtAddress()`) for `FindChild()` to find the child by its extended address.
+     *
+     * @param[in]  aChild       A reference to a `Child` entry in the child table.
+     * @param[in]  aExtAddress  The extended address to assign to the child.
+     *
+     */
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aExtAddress);
+
     /**
      * This method gets a new/unused `Child` entry from the child table.
      *
@@ -295,12 +391,31 @@ private:
     enum
     {
         kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kIndexSize   = 2 * kMaxChildren, // Keeps the open-addressed indexes at most half full.
+        kIndexEmpty  = 0xff,             // Marks an unused index slot.
     };
 
-    static bool MatchesFilter(const Child &aChild, StateFilter aFilter);
+    enum IndexType
+    {
+        kIndexRloc16,     // Index on child ID of the RLOC16.
+        kIndexExtAddress, // Index on hash of the extended address.
+    };
+
+    static bool     MatchesFilter(const Child &aChild, StateFilter aFilter);
+    static uint16_t HashRloc16(uint16_t aRloc16);
+    static uint16_t HashExtAddress(const Mac::ExtAddress &aExtAddress);
+    static uint16_t GetNextSlot(uint16_t aSlot) { return (aSlot + 1 < kIndexSize) ? aSlot + 1 : 0; }
+
+    uint8_t *GetIndex(IndexType aType) { return (aType == kIndexRloc16) ? mRloc16Index : mExtAddressIndex; }
+    uint16_t GetHomeSlot(IndexType aType, const Child &aChild) const;
+    void     AddToIndex(IndexType aType, const Child &aChild);
+    void     RemoveFromIndex(IndexType aType, const Child &aChild);
+    void     ClearIndexes(void);
 
     uint8_t mMaxChildrenAllowed;
     Child   mChildren[kMaxChildren];
+    uint8_t mRloc16Index[kIndexSize];
+    uint8_t mExtAddressIndex[kIndexSize];
 };
 
 #endif // OPENTHREAD_FTD
@@ -341,6 +456,10 @@ public:
     uint8_t GetChildIndex(const Child &) const { return 0; }
     Child * GetChildAtIndex(uint8_t) { return NULL; }
 
+    void ClearChild(Child &) {}
+    void SetChildRloc16(Child &, uint16_t) {}
+    void SetChildExtAddress(Child &, const Mac::ExtAddress &) {}
+
     Child *GetNewChild(void) { return NULL; }
 
     Child *FindChild(uint16_t, StateFilter) { return NULL; }
@@ -63,9 +63,11 @@ const Mac::Address &IndirectSender::ChildInfo::GetMacAddress(Mac::Address &aMacA
 IndirectSender::IndirectSender(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(false)
+    , mFreeQueueEntries(NULL)
     , mSourceMatchController(aInstance)
     , mDataPollHandler(aInstance)
 {
+    ClearQueues();
 }
 
 void IndirectSender::Stop(void)
@@ -81,6 +83,8 @@ void IndirectSender::Stop(void)
     mDataPollHandler.Clear();
 
 exit:
+    // The send queue is emptied when stopping, so all child queues are released.
+    ClearQueues();
     mEnabled = false;
 }
 
@@ -95,6 +99,7 @@ otError IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChil
     VerifyOrExit(!aMessage.GetChildMask(childIndex), error = OT_ERROR_ALREADY);
 
     aMessage.SetChildMask(childIndex);
+    AddToQueue(aMessage, childIndex);
     mSourceMatchController.IncrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -111,6 +116,7 @@ otError IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &a
     VerifyOrExit(aMessage.GetChildMask(childIndex), error = OT_ERROR_NOT_FOUND);
 
     aMessage.ClearChildMask(childIndex);
+    RemoveFromQueue(aMessage, childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
 
     RequestMessageUpdate(aChild);
@@ -121,16 +127,15 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint8_t  childIndex = Get<ChildTable>().GetChildIndex(aChild);
     Message *message;
-    Message *nextMessage;
 
     VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    while ((message = GetQueueHead(childIndex)) != NULL)
     {
-        nextMessage = message->GetNext();
-
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        message->ClearChildMask(childIndex);
+        RemoveFromQueue(*message, childIndex);
 
         if (!message->IsChildPending() && !message->GetDirectTransmission())
         {
@@ -175,15 +180,14 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
-        uint8_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        uint8_t  childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        Message *message;
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        while ((message = GetQueueHead(childIndex)) != NULL)
         {
-            if (message->GetChildMask(childIndex))
-            {
-                message->ClearChildMask(childIndex);
-                message->SetDirectTransmission();
-            }
+            message->ClearChildMask(childIndex);
+            RemoveFromQueue(*message, childIndex);
+            message->SetDirectTransmission();
         }
 
         aChild.SetIndirectMessage(NULL);
@@ -203,29 +207,24 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 Message *IndirectSender::FindIndirectMessage(Child &aChild)
 {
     Message *message;
-    Message *next;
     uint8_t  childIndex = Get<ChildTable>().GetChildIndex(aChild);
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = next)
+    while ((message = GetQueueHead(childIndex)) != NULL)
     {
-        next = message->GetNext();
+        // Skip and remove the supervision message if there are
+        // other messages queued for the child.
 
-        if (message->GetChildMask(childIndex))
+        if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
         {
-            // Skip and remove the supervision message if there are
-            // other messages queued for the child.
-
-            if ((message->GetType() == Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
-            {
-                message->ClearChildMask(childIndex);
-                mSourceMatchController.DecrementMessageCount(aChild);
-                Get<MeshForwarder>().mSendQueue.Dequeue(*message);
-                message->Free();
-                continue;
-            }
-
-            break;
+            message->ClearChildMask(childIndex);
+            RemoveFromQueue(*message, childIndex);
+            mSourceMatchController.DecrementMessageCount(aChild);
+            Get<MeshForwarder>().mSendQueue.Dequeue(*message);
+            message->Free();
+            continue;
         }
+
+        break;
     }
 
     return message;
@@ -533,6 +532,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         if (message->GetChildMask(childIndex))
         {
             message->ClearChildMask(childIndex);
+            RemoveFromQueue(*message, childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
@@ -566,6 +566,155 @@ void IndirectSender::ClearMessagesForRemovedChildren(void)
     }
 }
 
+Message *IndirectSender::GetQueueHead(uint8_t aChildIndex)
+{
+    ChildQueue &queue   = mChildQueues[aChildIndex];
+    Message *   message = NULL;
+
+    if (!queue.mOverflow)
+    {
+        ExitNow(message = (queue.mHead != NULL) ? queue.mHead->mMessage : NULL);
+    }
+
+    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+    {
+        if (message->GetChildMask(aChildIndex))
+        {
+            ExitNow();
+        }
+    }
+
+    // No message is left for the child, so its queue can be used again.
+    queue.mOverflow = false;
+
+exit:
+    return message;
+}
+
+void IndirectSender::AddToQueue(Message &aMessage, uint8_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *entry;
+    QueueEntry *prev;
+
+    VerifyOrExit(!queue.mOverflow);
+
+    if (mFreeQueueEntries == NULL)
+    {
+        otLogInfoMac("Indirect queue entries exhausted, scanning send queue for child index %d", aChildIndex);
+        FreeQueue(queue);
+        queue.mOverflow = true;
+        ExitNow();
+    }
+
+    entry             = mFreeQueueEntries;
+    mFreeQueueEntries = entry->mNext;
+    entry->mMessage   = &aMessage;
+
+    // Keep the queue in the same order as the send queue (by priority
+    // level, then FIFO), i.e., insert the entry after the last entry
+    // with the same or a higher priority.
+
+    if ((queue.mTail == NULL) || (queue.mTail->mMessage->GetPriority() >= aMessage.GetPriority()))
+    {
+        entry->mNext = NULL;
+
+        if (queue.mTail == NULL)
+        {
+            queue.mHead = entry;
+        }
+        else
+        {
+            queue.mTail->mNext = entry;
+        }
+
+        queue.mTail = entry;
+        ExitNow();
+    }
+
+    prev = NULL;
+
+    for (QueueEntry *cur = queue.mHead; cur->mMessage->GetPriority() >= aMessage.GetPriority(); cur = cur->mNext)
+    {
+        prev = cur;
+    }
+
+    if (prev == NULL)
+    {
+        entry->mNext = queue.mHead;
+        queue.mHead  = entry;
+    }
+    else
+    {
+        entry->mNext = prev->mNext;
+        prev->mNext  = entry;
+    }
+
+exit:
+    return;
+}
+
+void IndirectSender::RemoveFromQueue(Message &aMessage, uint8_t aChildIndex)
+{
+    ChildQueue &queue = mChildQueues[aChildIndex];
+    QueueEntry *prev  = NULL;
+    QueueEntry *entry;
+
+    for (entry = queue.mHead; entry != NULL; prev = entry, entry = entry->mNext)
+    {
+        if (entry->mMessage == &aMessage)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(entry != NULL);
+
+    if (prev == NULL)
+    {
+        queue.mHead = entry->mNext;
+    }
+    else
+    {
+        prev->mNext = entry->mNext;
+    }
+
+    if (queue.mTail == entry)
+    {
+        queue.mTail = prev;
+    }
+
+    entry->mNext      = mFreeQueueEntries;
+    mFreeQueueEntries = entry;
+
+exit:
+    return;
+}
+
+void IndirectSender::FreeQueue(ChildQueue &aQueue)
+{
+    if (aQueue.mTail != NULL)
+    {
+        aQueue.mTail->mNext = mFreeQueueEntries;
+        mFreeQueueEntries   = aQueue.mHead;
+    }
+
+    aQueue.mHead = NULL;
+    aQueue.mTail = NULL;
+}
+
+void IndirectSender::ClearQueues(void)
+{
+    memset(mChildQueues, 0, sizeof(mChildQueues));
+    mFreeQueueEntries = NULL;
+
+    for (uint16_t i = kNumQueueEntries; i > 0; i--)
+    {
+        mQueueEntries[i - 1].mNext = mFreeQueueEntries;
+        mFreeQueueEntries          = &mQueueEntries[i - 1];
+    }
+}
+
 } // namespace ot
 
 #endif // #if OPENTHREAD_FTD
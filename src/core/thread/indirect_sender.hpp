@@ -205,6 +205,27 @@ private:
          *
          */
         kSupervisionMsgAckRequest = (OPENTHREAD_CONFIG_CHILD_SUPERVISION_MSG_NO_ACK_REQUEST == 0) ? true : false,
+
+        kMaxChildren     = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kNumQueueEntries = OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES,
+    };
+
+    // An entry in the per-child FIFO of indirect messages. A message destined to several sleepy children is
+    // referenced from an entry in the queue of each child (mirroring the message's child mask).
+    struct QueueEntry
+    {
+        Message *   mMessage;
+        QueueEntry *mNext;
+    };
+
+    // The indirect message queue of a child, indexed by child table index. When no free entry is left, the queue
+    // is marked as overflowed and the child's messages are found from the send queue using the child mask, until
+    // the child has no more indirect messages.
+    struct ChildQueue
+    {
+        QueueEntry *mHead;
+        QueueEntry *mTail;
+        bool        mOverflow;
     };
 
     // Callbacks from DataPollHandler
@@ -222,7 +243,16 @@ private:
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
 
+    Message *GetQueueHead(uint8_t aChildIndex);
+    void     AddToQueue(Message &aMessage, uint8_t aChildIndex);
+    void     RemoveFromQueue(Message &aMessage, uint8_t aChildIndex);
+    void     FreeQueue(ChildQueue &aQueue);
+    void     ClearQueues(void);
+
     bool                  mEnabled;
+    ChildQueue            mChildQueues[kMaxChildren];
+    QueueEntry            mQueueEntries[kNumQueueEntries];
+    QueueEntry *          mFreeQueueEntries;
     SourceMatchController mSourceMatchController;
     DataPollHandler       mDataPollHandler;
 };
@@ -70,6 +70,8 @@ KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMasterKey(kDefaultMasterKey)
     , mKeySequence(0)
+    , mKeyCacheHitCount(0)
+    , mKeyCacheMissCount(0)
     , mMacFrameCounter(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
@@ -84,7 +86,7 @@ KeyManager::KeyManager(Instance &aInstance)
     , mIsPSKcSet(false)
 {
     memset(&mPSKc, 0, sizeof(mPSKc));
-    ComputeKey(mKeySequence, mKey);
+    ComputeKeys();
 }
 
 void KeyManager::Start(void)
@@ -96,6 +98,7 @@ void KeyManager::Start(void)
 void KeyManager::Stop(void)
 {
     mKeyRotationTimer.Stop();
+    mKeyScheduleCache.Clear();
 }
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -125,7 +128,8 @@ otError KeyManager::SetMasterKey(const otMasterKey &aKey)
 
     mMasterKey   = aKey;
     mKeySequence = 0;
-    ComputeKey(mKeySequence, mKey);
+    ComputeKeys();
+    mKeyScheduleCache.Clear();
 
     // reset parent frame counters
     routers = Get<Mle::MleRouter>().GetParent();
@@ -172,6 +176,13 @@ void KeyManager::ComputeKey(uint32_t aKeySequence, uint8_t *aKey)
     hmac.Finish(aKey);
 }
 
+void KeyManager::ComputeKeys(void)
+{
+    ComputeKey(mKeySequence - 1, mPrevKey);
+    ComputeKey(mKeySequence, mKey);
+    ComputeKey(mKeySequence + 1, mNextKey);
+}
+
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 {
     VerifyOrExit(aKeySequence != mKeySequence, Get<Notifier>().SignalIfFirst(OT_CHANGED_THREAD_KEY_SEQUENCE_COUNTER));
@@ -183,8 +194,19 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
         VerifyOrExit(mHoursSinceKeyRotation >= mKeySwitchGuardTime);
     }
 
-    mKeySequence = aKeySequence;
-    ComputeKey(mKeySequence, mKey);
+    if (aKeySequence == mKeySequence + 1)
+    {
+        // Regular key rotation, shift the cached keys and only derive the new next key.
+        memcpy(mPrevKey, mKey, sizeof(mPrevKey));
+        memcpy(mKey, mNextKey, sizeof(mKey));
+        mKeySequence = aKeySequence;
+        ComputeKey(mKeySequence + 1, mNextKey);
+    }
+    else
+    {
+        mKeySequence = aKeySequence;
+        ComputeKeys();
+    }
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -201,16 +223,43 @@ exit:
     return;
 }
 
+const uint8_t *KeyManager::GetTemporaryKey(uint32_t aKeySequence)
+{
+    const uint8_t *key;
+
+    if (aKeySequence == mKeySequence - 1)
+    {
+        key = mPrevKey;
+    }
+    else if (aKeySequence == mKeySequence + 1)
+    {
+        key = mNextKey;
+    }
+    else if (aKeySequence == mKeySequence)
+    {
+        key = mKey;
+    }
+    else
+    {
+        ComputeKey(aKeySequence, mTemporaryKey);
+        mKeyCacheMissCount++;
+        ExitNow(key = mTemporaryKey);
+    }
+
+    mKeyCacheHitCount++;
+
+exit:
+    return key;
+}
+
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey + kMacKeyOffset;
+    return GetTemporaryKey(aKeySequence) + kMacKeyOffset;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey;
+    return GetTemporaryKey(aKeySequence);
 }
 
 void KeyManager::IncrementMacFrameCounter(void)
@@ -42,6 +42,7 @@
 
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ccm.hpp"
 #include "crypto/hmac_sha256.hpp"
 
 namespace ot {
@@ -166,6 +167,9 @@ public:
     /**
      * This method returns a pointer to a temporary MAC key computed from the given key sequence.
      *
+     * Keys for the previous and next key sequence are served from a cache that is kept up to date on key
+     * rotation, any other key sequence is computed on demand.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MAC key.
@@ -176,6 +180,9 @@ public:
     /**
      * This method returns a pointer to a temporary MLE key computed from the given key sequence.
      *
+     * Keys for the previous and next key sequence are served from a cache that is kept up to date on key
+     * rotation, any other key sequence is computed on demand.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MLE key.
@@ -183,6 +190,30 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the number of temporary key lookups served from the derived key cache.
+     *
+     * @returns The number of derived key cache hits.
+     *
+     */
+    uint32_t GetKeyCacheHitCount(void) const { return mKeyCacheHitCount; }
+
+    /**
+     * This method returns the number of temporary key lookups that required a key derivation.
+     *
+     * @returns The number of derived key cache misses.
+     *
+     */
+    uint32_t GetKeyCacheMissCount(void) const { return mKeyCacheMissCount; }
+
+    /**
+     * This method returns the AES key schedule cache used when securing MAC and MLE frames.
+     *
+     * @returns A reference to the AES key schedule cache.
+     *
+     */
+    Crypto::KeyScheduleCacheBase &GetKeyScheduleCache(void) { return mKeyScheduleCache; }
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -348,7 +379,9 @@ private:
         kOneHourIntervalInMsec     = 3600u * 1000u,
     };
 
-    void ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    void           ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    void           ComputeKeys(void);
+    const uint8_t *GetTemporaryKey(uint32_t aKeySequence);
 
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
@@ -358,8 +391,14 @@ private:
 
     uint32_t mKeySequence;
     uint8_t  mKey[Crypto::HmacSha256::kHashSize];
+    uint8_t  mPrevKey[Crypto::HmacSha256::kHashSize]; ///< Key for `mKeySequence - 1`.
+    uint8_t  mNextKey[Crypto::HmacSha256::kHashSize]; ///< Key for `mKeySequence + 1`.
+
+    uint8_t  mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    uint32_t mKeyCacheHitCount;
+    uint32_t mKeyCacheMissCount;
 
-    uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    Crypto::KeyScheduleCache<OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE> mKeyScheduleCache;
 
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
@@ -45,6 +45,8 @@
 
 using ot::Encoding::BigEndian::HostSwap16;
 using ot::Encoding::BigEndian::ReadUint16;
+using ot::Encoding::BigEndian::ReadUint32;
+using ot::Encoding::BigEndian::WriteUint16;
 
 namespace ot {
 namespace Lowpan {
@@ -247,18 +249,222 @@ exit:
     return error;
 }
 
+uint8_t Lowpan::CompressIid(const Mac::Address &aMacAddr,
+                            const Ip6::Address &aIpAddr,
+                            const Context &     aContext,
+                            uint8_t *&          aCursor)
+{
+    static const uint8_t kShortIidPrefix[] = {0x00, 0x00, 0x00, 0xff, 0xfe, 0x00};
+
+    Ip6::Address ipaddr;
+    uint8_t      mode;
+
+    if (ComputeIid(aMacAddr, aContext, ipaddr) == OT_ERROR_NONE &&
+        memcmp(ipaddr.GetIid(), aIpAddr.GetIid(), Ip6::Address::kInterfaceIdentifierSize) == 0)
+    {
+        mode = 3;
+    }
+    else if (memcmp(aIpAddr.GetIid(), kShortIidPrefix, sizeof(kShortIidPrefix)) == 0)
+    {
+        mode = 2;
+        memcpy(aCursor, aIpAddr.mFields.m8 + 14, 2);
+        aCursor += 2;
+    }
+    else
+    {
+        mode = 1;
+        memcpy(aCursor, aIpAddr.GetIid(), Ip6::Address::kInterfaceIdentifierSize);
+        aCursor += Ip6::Address::kInterfaceIdentifierSize;
+    }
+
+    return mode;
+}
+
+bool Lowpan::GetFastPathContext(const Ip6::Address &aAddress, Context &aContext, bool &aStateful)
+{
+    NetworkData::Leader &networkData = Get<NetworkData::Leader>();
+    bool                 rval        = false;
+
+    // Resolve the context exactly as `CompressGeneric()` does, so both paths emit the same header.
+    if (networkData.GetContext(aAddress, aContext) == OT_ERROR_NONE && aContext.mCompressFlag)
+    {
+        aStateful = !aAddress.IsLinkLocal();
+    }
+    else
+    {
+        VerifyOrExit(aAddress.IsLinkLocal() && networkData.GetContext(0, aContext) == OT_ERROR_NONE);
+        aStateful = false;
+    }
+
+    // Context bits extending into the IID are left to the generic path.
+    rval = (aContext.mPrefixLength <= 64);
+
+exit:
+    return rval;
+}
+
+bool Lowpan::CompressUdpFastPath(Message &           aMessage,
+                                 const Mac::Address &aMacSource,
+                                 const Mac::Address &aMacDest,
+                                 UdpDatagramHeader & aHeader,
+                                 BufferWriter &      aBuf)
+{
+    bool            rval      = false;
+    Ip6::Header &   ip6Header = aHeader.mIp6Header;
+    Ip6::UdpHeader &udpHeader = aHeader.mUdpHeader;
+    uint8_t *       start     = aBuf.GetWritePointer();
+    uint8_t *       cursor    = start + sizeof(uint16_t);
+    uint16_t        hcCtl     = kFastPathHcCtl;
+    Context         srcContext, dstContext;
+    bool            srcStateful, dstStateful;
+    uint16_t        source;
+    uint16_t        destination;
+
+    VerifyOrExit(aBuf.CanWrite(kFastPathMaxHeaderSize));
+
+    // Traffic Class and Flow Label are both zero and UDP immediately follows the IPv6 header.
+    VerifyOrExit(ReadUint32(reinterpret_cast<uint8_t *>(&ip6Header)) == 0x60000000 &&
+                 ip6Header.GetNextHeader() == Ip6::kProtoUdp);
+
+    // Multicast and unspecified addresses take the generic path, reject them before any context lookup.
+    VerifyOrExit(!ip6Header.GetSource().IsUnspecified() && !ip6Header.GetDestination().IsMulticast());
+
+    VerifyOrExit(GetFastPathContext(ip6Header.GetSource(), srcContext, srcStateful));
+    VerifyOrExit(GetFastPathContext(ip6Header.GetDestination(), dstContext, dstStateful));
+
+    if (srcContext.mContextId != 0 || dstContext.mContextId != 0)
+    {
+        hcCtl |= kHcContextId;
+        *cursor++ = ((srcContext.mContextId << 4) | dstContext.mContextId) & 0xff;
+    }
+
+    switch (ip6Header.GetHopLimit())
+    {
+    case 1:
+        hcCtl |= kHcHopLimit1;
+        break;
+
+    case 64:
+        hcCtl |= kHcHopLimit64;
+        break;
+
+    case 255:
+        hcCtl |= kHcHopLimit255;
+        break;
+
+    default:
+        *cursor++ = ip6Header.GetHopLimit();
+        break;
+    }
+
+    if (srcStateful)
+    {
+        hcCtl |= kHcSrcAddrContext;
+    }
+
+    hcCtl |= CompressIid(aMacSource, ip6Header.GetSource(), srcContext, cursor) << 4;
+
+    if (dstStateful)
+    {
+        hcCtl |= kHcDstAddrContext;
+    }
+
+    hcCtl |= CompressIid(aMacDest, ip6Header.GetDestination(), dstContext, cursor);
+
+    WriteUint16(hcCtl, start);
+
+    // LOWPAN_NHC UDP header, ports as in `CompressUdp()`.
+    source      = udpHeader.GetSourcePort();
+    destination = udpHeader.GetDestinationPort();
+
+    if ((source & 0xfff0) == 0xf0b0 && (destination & 0xfff0) == 0xf0b0)
+    {
+        *cursor++ = kUdpDispatch | 3;
+        *cursor++ = (((source & 0xf) << 4) | (destination & 0xf)) & 0xff;
+    }
+    else if ((source & 0xff00) == 0xf000)
+    {
+        *cursor++ = kUdpDispatch | 2;
+        *cursor++ = source & 0xff;
+        WriteUint16(destination, cursor);
+        cursor += sizeof(uint16_t);
+    }
+    else if ((destination & 0xff00) == 0xf000)
+    {
+        *cursor++ = kUdpDispatch | 1;
+        WriteUint16(source, cursor);
+        cursor += sizeof(uint16_t);
+        *cursor++ = destination & 0xff;
+    }
+    else
+    {
+        // Both ports inline, e.g. MLE and CoAP.
+        *cursor++ = kUdpDispatch;
+        memcpy(cursor, &udpHeader, Ip6::UdpHeader::GetLengthOffset());
+        cursor += Ip6::UdpHeader::GetLengthOffset();
+    }
+
+    memcpy(cursor, reinterpret_cast<uint8_t *>(&udpHeader) + Ip6::UdpHeader::GetChecksumOffset(), sizeof(uint16_t));
+    cursor += sizeof(uint16_t);
+
+    IgnoreReturnValue(aBuf.Advance(static_cast<uint8_t>(cursor - start)));
+    aMessage.MoveOffset(sizeof(aHeader));
+    rval = true;
+
+exit:
+    return rval;
+}
+
 otError Lowpan::Compress(Message &           aMessage,
                          const Mac::Address &aMacSource,
                          const Mac::Address &aMacDest,
                          BufferWriter &      aBuf)
+{
+    otError                error  = OT_ERROR_NONE;
+    uint16_t               length = sizeof(UdpDatagramHeader);
+    UdpDatagramHeader *    header;
+    UdpDatagramHeader      headerCopy;
+    Message::WritableChunk chunk;
+
+    // The IPv6 header and a possible UDP header are parsed in place when the first chunk holds both of them (or the
+    // whole message), they are only copied out when they straddle a buffer boundary.
+    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
+
+    if (length == 0)
+    {
+        header = reinterpret_cast<UdpDatagramHeader *>(chunk.GetData());
+        length = chunk.GetLength();
+    }
+    else
+    {
+        header = &headerCopy;
+        length = aMessage.Read(aMessage.GetOffset(), sizeof(headerCopy), &headerCopy);
+    }
+
+    VerifyOrExit(length >= sizeof(header->mIp6Header), error = OT_ERROR_PARSE);
+
+    // Unicast UDP between link-local or context-compressible addresses dominates Thread traffic (MLE, CoAP).
+    if (length < sizeof(*header) || !CompressUdpFastPath(aMessage, aMacSource, aMacDest, *header, aBuf))
+    {
+        error = CompressGeneric(aMessage, aMacSource, aMacDest, header->mIp6Header, aBuf);
+    }
+
+exit:
+    return error;
+}
+
+otError Lowpan::CompressGeneric(Message &           aMessage,
+                                const Mac::Address &aMacSource,
+                                const Mac::Address &aMacDest,
+                                Ip6::Header &       aIp6Header,
+                                BufferWriter &      aBuf)
 {
     otError              error       = OT_ERROR_NONE;
     NetworkData::Leader &networkData = Get<NetworkData::Leader>();
     uint16_t             startOffset = aMessage.GetOffset();
     BufferWriter         buf         = aBuf;
     uint16_t             hcCtl;
-    Ip6::Header          ip6Header;
-    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&aIp6Header);
     Context              srcContext, dstContext;
     bool                 srcContextValid, dstContextValid;
     uint8_t              nextHeader;
@@ -272,11 +478,8 @@ compress:
     headerDepth = 0;
     hcCtl       = kHcDispatch;
 
-    VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header),
-                 error = OT_ERROR_PARSE);
-
     srcContextValid =
-        (networkData.GetContext(ip6Header.GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
+        (networkData.GetContext(aIp6Header.GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
 
     if (!srcContextValid)
     {
@@ -284,7 +487,7 @@ compress:
     }
 
     dstContextValid =
-        (networkData.GetContext(ip6Header.GetDestination(), dstContext) == OT_ERROR_NONE && dstContext.mCompressFlag);
+        (networkData.GetContext(aIp6Header.GetDestination(), dstContext) == OT_ERROR_NONE && dstContext.mCompressFlag);
 
     if (!dstContextValid)
     {
@@ -337,7 +540,7 @@ compress:
     }
 
     // Next Header
-    switch (ip6Header.GetNextHeader())
+    switch (aIp6Header.GetNextHeader())
     {
     case Ip6::kProtoHopOpts:
     case Ip6::kProtoUdp:
@@ -350,12 +553,12 @@ compress:
         // fall through
 
     default:
-        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(ip6Header.GetNextHeader())));
+        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(aIp6Header.GetNextHeader())));
         break;
     }
 
     // Hop Limit
-    switch (ip6Header.GetHopLimit())
+    switch (aIp6Header.GetHopLimit())
     {
     case 1:
         hcCtl |= kHcHopLimit1;
@@ -370,53 +573,53 @@ compress:
         break;
 
     default:
-        SuccessOrExit(error = buf.Write(ip6Header.GetHopLimit()));
+        SuccessOrExit(error = buf.Write(aIp6Header.GetHopLimit()));
         break;
     }
 
     // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
+    if (aIp6Header.GetSource().IsUnspecified())
     {
         hcCtl |= kHcSrcAddrContext;
     }
-    else if (ip6Header.GetSource().IsLinkLocal())
+    else if (aIp6Header.GetSource().IsLinkLocal())
     {
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
+        SuccessOrExit(error = CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
     }
     else if (srcContextValid)
     {
         hcCtl |= kHcSrcAddrContext;
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
+        SuccessOrExit(error = CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
     }
     else
     {
-        SuccessOrExit(error = buf.Write(ip6Header.GetSource().mFields.m8, sizeof(ip6Header.GetSource())));
+        SuccessOrExit(error = buf.Write(aIp6Header.GetSource().mFields.m8, sizeof(aIp6Header.GetSource())));
     }
 
     // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
+    if (aIp6Header.GetDestination().IsMulticast())
     {
-        SuccessOrExit(error = CompressMulticast(ip6Header.GetDestination(), hcCtl, buf));
+        SuccessOrExit(error = CompressMulticast(aIp6Header.GetDestination(), hcCtl, buf));
     }
-    else if (ip6Header.GetDestination().IsLinkLocal())
+    else if (aIp6Header.GetDestination().IsLinkLocal())
     {
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
     }
     else if (dstContextValid)
     {
         hcCtl |= kHcDstAddrContext;
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
     }
     else
     {
-        SuccessOrExit(error = buf.Write(&ip6Header.GetDestination(), sizeof(ip6Header.GetDestination())));
+        SuccessOrExit(error = buf.Write(&aIp6Header.GetDestination(), sizeof(aIp6Header.GetDestination())));
     }
 
     headerDepth++;
 
-    aMessage.MoveOffset(sizeof(ip6Header));
+    aMessage.MoveOffset(sizeof(aIp6Header));
 
-    nextHeader = static_cast<uint8_t>(ip6Header.GetNextHeader());
+    nextHeader = static_cast<uint8_t>(aIp6Header.GetNextHeader());
 
     while (headerDepth < headerMaxDepth)
     {
@@ -361,8 +361,29 @@ private:
         kUdpDispatchMask = 0xf8,
         kUdpChecksum     = 1 << 2,
         kUdpPortMask     = 3 << 0,
+
+        kFastPathHcCtl         = kHcDispatch | kHcTrafficFlow | kHcNextHeader,
+        kFastPathMaxHeaderSize = 27, ///< IPHC, CID, Hop Limit, two 64-bit IIDs and a UDP header with inline ports.
     };
 
+    OT_TOOL_PACKED_BEGIN
+    struct UdpDatagramHeader
+    {
+        Ip6::Header    mIp6Header;
+        Ip6::UdpHeader mUdpHeader;
+    } OT_TOOL_PACKED_END;
+
+    bool    CompressUdpFastPath(Message &           aMessage,
+                                const Mac::Address &aMacSource,
+                                const Mac::Address &aMacDest,
+                                UdpDatagramHeader & aHeader,
+                                BufferWriter &      aBuf);
+    bool    GetFastPathContext(const Ip6::Address &aAddress, Context &aContext, bool &aStateful);
+    otError CompressGeneric(Message &           aMessage,
+                            const Mac::Address &aMacSource,
+                            const Mac::Address &aMacDest,
+                            Ip6::Header &       aIp6Header,
+                            BufferWriter &      aBuf);
     otError CompressExtensionHeader(Message &aMessage, BufferWriter &aBuf, uint8_t &aNextHeader);
     otError CompressSourceIid(const Mac::Address &aMacAddr,
                               const Ip6::Address &aIpAddr,
@@ -383,6 +404,10 @@ private:
 
     static void    CopyContext(const Context &aContext, Ip6::Address &aAddress);
     static otError ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+    static uint8_t CompressIid(const Mac::Address &aMacAddr,
+                               const Ip6::Address &aIpAddr,
+                               const Context &     aContext,
+                               uint8_t *&          aCursor);
 };
 
 /**
@@ -59,6 +59,7 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mDiscoverTimer(aInstance, &MeshForwarder::HandleDiscoverTimer, this)
     , mUpdateTimer(aInstance, &MeshForwarder::HandleUpdateTimer, this)
+    , mReassemblyTimer(aInstance, &MeshForwarder::HandleReassemblyTimer, this)
     , mMessageNextOffset(0)
     , mSendMessage(NULL)
     , mMeshSource()
@@ -84,6 +85,8 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     mIpCounters.mTxFailure = 0;
     mIpCounters.mRxFailure = 0;
 
+    ResetReassemblyEntries();
+
 #if OPENTHREAD_FTD
     memset(mFragmentEntries, 0, sizeof(mFragmentEntries));
 #endif
@@ -128,6 +131,9 @@ void MeshForwarder::Stop(void)
         message->Free();
     }
 
+    ResetReassemblyEntries();
+    mReassemblyTimer.Stop();
+
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     memset(mFragmentEntries, 0, sizeof(mFragmentEntries));
@@ -208,17 +214,14 @@ exit:
 
 Message *MeshForwarder::GetDirectTransmission(void)
 {
-    Message *curMessage, *nextMessage;
+    Message *curMessage;
     otError  error = OT_ERROR_NONE;
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    // Messages which are dropped or moved to another queue are removed
+    // from the send queue, so the head of the direct transmission
+    // sub-queue is always the next message to process.
+    while ((curMessage = mSendQueue.GetHeadForDirectTx()) != NULL)
     {
-        if (!curMessage->GetDirectTransmission())
-        {
-            nextMessage = curMessage->GetNext();
-            continue;
-        }
-
         curMessage->SetDoNotEvict(true);
 
         switch (curMessage->GetType())
@@ -248,9 +251,6 @@ Message *MeshForwarder::GetDirectTransmission(void)
 
         curMessage->SetDoNotEvict(false);
 
-        // the next message may have been evicted during processing (e.g. due to Address Solicit)
-        nextMessage = curMessage->GetNext();
-
         switch (error)
         {
         case OT_ERROR_NONE:
@@ -563,14 +563,16 @@ uint16_t MeshForwarder::PrepareDataFrame(Mac::TxFrame &      aFrame,
                                          uint16_t            aMeshSource,
                                          uint16_t            aMeshDest)
 {
-    uint16_t fcf;
-    uint8_t *payload;
-    uint8_t  headerLength;
-    uint16_t payloadLength;
-    uint16_t fragmentLength;
-    uint16_t dstpan;
-    uint8_t  secCtl;
-    uint16_t nextOffset;
+    uint16_t       fcf;
+    uint8_t *      payload;
+    uint8_t        headerLength;
+    uint16_t       payloadOffset;
+    uint16_t       payloadLength;
+    uint16_t       fragmentLength;
+    uint16_t       dstpan;
+    uint8_t        secCtl;
+    uint16_t       nextOffset;
+    Message::Chunk chunk;
 
 start:
 
@@ -807,11 +809,7 @@ start:
 
         payload += hcLength;
 
-        // copy IPv6 Payload
-        aMessage.Read(aMessage.GetOffset(), payloadLength, payload);
-        aFrame.SetPayloadLength(static_cast<uint8_t>(headerLength + payloadLength));
-
-        nextOffset = aMessage.GetOffset() + payloadLength;
+        payloadOffset = aMessage.GetOffset();
         aMessage.SetOffset(0);
     }
     else
@@ -837,11 +835,18 @@ start:
             payloadLength = fragmentLength;
         }
 
-        // Copy IPv6 Payload
-        aMessage.Read(aMessage.GetOffset(), payloadLength, payload);
-        aFrame.SetPayloadLength(static_cast<uint8_t>(headerLength + payloadLength));
+        payloadOffset = aMessage.GetOffset();
+    }
+
+    aFrame.SetPayloadLength(static_cast<uint8_t>(headerLength + payloadLength));
+    nextOffset = payloadOffset + payloadLength;
 
-        nextOffset = aMessage.GetOffset() + payloadLength;
+    // Copy IPv6 Payload, chunk by chunk from the message buffers straight into the frame.
+    for (aMessage.GetFirstChunk(payloadOffset, payloadLength, chunk); chunk.GetLength() > 0;
+         aMessage.GetNextChunk(payloadLength, chunk))
+    {
+        memcpy(payload, chunk.GetData(), chunk.GetLength());
+        payload += chunk.GetLength();
     }
 
     if (nextOffset < aMessage.GetLength())
@@ -1138,6 +1143,7 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
     otError                error = OT_ERROR_NONE;
     Lowpan::FragmentHeader fragmentHeader;
     Message *              message = NULL;
+    ReassemblyEntry *      entry;
     int                    headerLength;
 
     // Check the fragment header
@@ -1145,10 +1151,29 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
     aFrame += fragmentHeader.GetHeaderLength();
     aFrameLength -= fragmentHeader.GetHeaderLength();
 
+    entry = FindReassemblyEntry(aMacSource, fragmentHeader.GetDatagramTag());
+
     if (fragmentHeader.GetDatagramOffset() == 0)
     {
         uint8_t priority;
 
+        if (entry != NULL)
+        {
+            // A repeated first fragment of a datagram being reassembled is a duplicate, otherwise the sender
+            // reused the tag and the stale datagram is dropped.
+            VerifyOrExit(entry->GetMessage()->GetLength() != fragmentHeader.GetDatagramSize() ||
+                             entry->GetMessage()->IsLinkSecurityEnabled() != aLinkInfo.mLinkSecurity,
+                         error = OT_ERROR_DUPLICATED);
+
+            message = entry->GetMessage();
+            RemoveReassemblyEntry(*entry);
+            mReassemblyList.Dequeue(*message);
+            LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_DROP);
+            mIpCounters.mRxFailure++;
+            message->Free();
+            message = NULL;
+        }
+
         SuccessOrExit(error = GetFramePriority(aFrame, aFrameLength, aMacSource, aMacDest, priority));
         VerifyOrExit((message = Get<MessagePool>().New(Message::kTypeIp6, 0, priority)) != NULL,
                      error = OT_ERROR_NO_BUFS);
@@ -1171,7 +1196,6 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
         SuccessOrExit(error = message->SetLength(fragmentHeader.GetDatagramSize()));
 
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
-        message->SetTimeout(kReassemblyTimeout);
 
         // copy Fragment
         message->Write(message->GetOffset(), aFrameLength, aFrame);
@@ -1189,58 +1213,58 @@ void MeshForwarder::HandleFragment(uint8_t *               aFrame,
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
+        VerifyOrExit((entry = NewReassemblyEntry(*message, aMacSource, fragmentHeader.GetDatagramTag())) != NULL,
+                     error = OT_ERROR_NO_BUFS);
+        IgnoreReturnValue(entry->MarkReceived(0, message->GetOffset()));
 
-        if (!mUpdateTimer.IsRunning())
-        {
-            mUpdateTimer.Start(kStateUpdatePeriod);
-        }
+        mReassemblyList.Enqueue(*message);
+        UpdateReassemblyEntry(*entry);
     }
     else
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if (entry != NULL && (entry->GetMessage()->GetLength() != fragmentHeader.GetDatagramSize() ||
+                              entry->GetMessage()->IsLinkSecurityEnabled() != aLinkInfo.mLinkSecurity ||
+                              fragmentHeader.GetDatagramOffset() + aFrameLength > fragmentHeader.GetDatagramSize()))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.mLinkSecurity)
-            {
-                break;
-            }
+            entry = NULL;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
-        // with a non-matching fragmentation offset or tag, it indicates that
-        // we have either missed a fragment, or the parent has moved to a new
-        // message with a new tag. In either case, we can safely clear any
-        // remaining fragments stored in the reassembly list.
+        // with a non-matching fragmentation tag, it indicates that we have
+        // missed a fragment, or the parent has moved to a new message with a
+        // new tag. In either case, we can safely clear any remaining fragments
+        // stored in the reassembly list.
 
         if (!GetRxOnWhenIdle())
         {
-            if ((message == NULL) && (aLinkInfo.mLinkSecurity))
+            if ((entry == NULL) && (aLinkInfo.mLinkSecurity))
             {
                 ClearReassemblyList();
             }
         }
 
-        VerifyOrExit(message != NULL, error = OT_ERROR_DROP);
+        VerifyOrExit(entry != NULL, error = OT_ERROR_DROP);
+
+        // Duplicate and overlapping fragments are rejected before touching the message.
+        SuccessOrExit(error = entry->MarkReceived(fragmentHeader.GetDatagramOffset(), aFrameLength));
 
         // copy Fragment
-        message->Write(message->GetOffset(), aFrameLength, aFrame);
-        message->MoveOffset(aFrameLength);
+        message = entry->GetMessage();
+        message->Write(fragmentHeader.GetDatagramOffset(), aFrameLength, aFrame);
         message->AddRss(aLinkInfo.mRss);
-        message->SetTimeout(kReassemblyTimeout);
+        UpdateReassemblyEntry(*entry);
     }
 
 exit:
 
     if (error == OT_ERROR_NONE)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if (entry->IsComplete())
         {
+            RemoveReassemblyEntry(*entry);
             mReassemblyList.Dequeue(*message);
+            message->SetOffset(message->GetLength());
             HandleDatagram(*message, aLinkInfo, aMacSource);
         }
     }
@@ -1248,13 +1272,70 @@ exit:
     {
         LogFragmentFrameDrop(error, aFrameLength, aMacSource, aMacDest, fragmentHeader, aLinkInfo.mLinkSecurity);
 
-        if (message != NULL)
+        // Only a first fragment owns a message that is not yet in the reassembly list.
+        if (message != NULL && fragmentHeader.GetDatagramOffset() == 0)
         {
             message->Free();
         }
     }
 }
 
+void ReassemblyEntry::Init(Message &aMessage, const Mac::Address &aMacSource, uint16_t aDatagramTag)
+{
+    mMessage        = &aMessage;
+    mMacSource      = aMacSource;
+    mDatagramTag    = aDatagramTag;
+    mReceivedLength = 0;
+    memset(mReceived, 0, sizeof(mReceived));
+}
+
+bool ReassemblyEntry::Matches(const Mac::Address &aMacSource, uint16_t aDatagramTag) const
+{
+    bool rval = false;
+
+    VerifyOrExit(mMessage != NULL && mDatagramTag == aDatagramTag && mMacSource.GetType() == aMacSource.GetType());
+
+    switch (aMacSource.GetType())
+    {
+    case Mac::Address::kTypeShort:
+        rval = (mMacSource.GetShort() == aMacSource.GetShort());
+        break;
+
+    case Mac::Address::kTypeExtended:
+        rval = (mMacSource.GetExtended() == aMacSource.GetExtended());
+        break;
+
+    default:
+        rval = true;
+        break;
+    }
+
+exit:
+    return rval;
+}
+
+otError ReassemblyEntry::MarkReceived(uint16_t aOffset, uint16_t aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first = aOffset / kOffsetUnit;
+    uint16_t end   = (aOffset + aLength + kOffsetUnit - 1) / kOffsetUnit;
+
+    for (uint16_t unit = first; unit < end; unit++)
+    {
+        VerifyOrExit((mReceived[unit / CHAR_BIT] & (0x80 >> (unit % CHAR_BIT))) == 0, error = OT_ERROR_DUPLICATED);
+    }
+
+    for (uint16_t unit = first; unit < end; unit++)
+    {
+        mReceived[unit / CHAR_BIT] |= 0x80 >> (unit % CHAR_BIT);
+    }
+
+    mReceivedLength += aLength;
+
+exit:
+    return error;
+}
+
 void MeshForwarder::ClearReassemblyList(void)
 {
     Message *message;
@@ -1274,54 +1355,192 @@ void MeshForwarder::ClearReassemblyList(void)
 
         message->Free();
     }
+
+    ResetReassemblyEntries();
+    mReassemblyTimer.Stop();
 }
 
-void MeshForwarder::HandleUpdateTimer(Timer &aTimer)
+void MeshForwarder::ResetReassemblyEntries(void)
 {
-    aTimer.GetOwner<MeshForwarder>().HandleUpdateTimer();
+    for (uint8_t i = 0; i < kNumReassemblyEntries; i++)
+    {
+        mReassemblyEntries[i].Clear();
+        mReassemblyBuckets[i] = kInvalidReassemblyIndex;
+    }
 }
 
-void MeshForwarder::HandleUpdateTimer(void)
+uint8_t MeshForwarder::GetReassemblyBucket(const Mac::Address &aMacSource, uint16_t aDatagramTag) const
 {
-    bool shouldRun = false;
+    uint16_t hash = aDatagramTag;
 
-#if OPENTHREAD_FTD
-    shouldRun = UpdateFragmentLifetime();
-#endif
+    if (aMacSource.IsShort())
+    {
+        hash ^= aMacSource.GetShort();
+    }
+    else if (aMacSource.IsExtended())
+    {
+        for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i += sizeof(uint16_t))
+        {
+            hash ^= Encoding::BigEndian::ReadUint16(aMacSource.GetExtended().m8 + i);
+        }
+    }
 
-    if (UpdateReassemblyList() || shouldRun)
+    return static_cast<uint8_t>(hash % kNumReassemblyEntries);
+}
+
+ReassemblyEntry *MeshForwarder::FindReassemblyEntry(const Mac::Address &aMacSource, uint16_t aDatagramTag)
+{
+    ReassemblyEntry *entry = NULL;
+
+    for (uint8_t index = mReassemblyBuckets[GetReassemblyBucket(aMacSource, aDatagramTag)];
+         index != kInvalidReassemblyIndex; index = mReassemblyEntries[index].GetNext())
     {
-        mUpdateTimer.Start(kStateUpdatePeriod);
+        if (mReassemblyEntries[index].Matches(aMacSource, aDatagramTag))
+        {
+            ExitNow(entry = &mReassemblyEntries[index]);
+        }
     }
+
+exit:
+    return entry;
 }
 
-bool MeshForwarder::UpdateReassemblyList(void)
+ReassemblyEntry *MeshForwarder::FindReassemblyEntry(const Message &aMessage)
 {
-    Message *next = NULL;
+    ReassemblyEntry *entry = NULL;
 
-    for (Message *message = mReassemblyList.GetHead(); message; message = next)
+    for (uint8_t i = 0; i < kNumReassemblyEntries; i++)
     {
-        next = message->GetNext();
+        if (mReassemblyEntries[i].GetMessage() == &aMessage)
+        {
+            ExitNow(entry = &mReassemblyEntries[i]);
+        }
+    }
+
+exit:
+    return entry;
+}
 
-        if (message->GetTimeout() > 0)
+ReassemblyEntry *MeshForwarder::NewReassemblyEntry(Message &           aMessage,
+                                                   const Mac::Address &aMacSource,
+                                                   uint16_t            aDatagramTag)
+{
+    ReassemblyEntry *entry = NULL;
+    uint8_t          bucket;
+
+    for (uint8_t i = 0; i < kNumReassemblyEntries; i++)
+    {
+        if (mReassemblyEntries[i].GetMessage() == NULL)
         {
-            message->DecrementTimeout();
+            bucket = GetReassemblyBucket(aMacSource, aDatagramTag);
+            entry  = &mReassemblyEntries[i];
+            entry->Init(aMessage, aMacSource, aDatagramTag);
+            entry->SetNext(mReassemblyBuckets[bucket]);
+            mReassemblyBuckets[bucket] = i;
+            break;
         }
-        else
+    }
+
+    return entry;
+}
+
+void MeshForwarder::RemoveReassemblyEntry(ReassemblyEntry &aEntry)
+{
+    uint8_t  index = static_cast<uint8_t>(&aEntry - mReassemblyEntries);
+    uint8_t *prev  = &mReassemblyBuckets[GetReassemblyBucket(aEntry.mMacSource, aEntry.mDatagramTag)];
+
+    while (*prev != index)
+    {
+        prev = &mReassemblyEntries[*prev].mNext;
+    }
+
+    *prev = aEntry.GetNext();
+    aEntry.Clear();
+}
+
+void MeshForwarder::UpdateReassemblyEntry(ReassemblyEntry &aEntry)
+{
+    Message *message = aEntry.GetMessage();
+
+    // Every datagram has the same timeout, so moving the datagram to the tail keeps the list in expiry order.
+    aEntry.SetUpdateTime(TimerMilli::GetNow());
+
+    if (message->GetNext() != NULL)
+    {
+        mReassemblyList.Dequeue(*message);
+        mReassemblyList.Enqueue(*message);
+    }
+
+    if (!mReassemblyTimer.IsRunning())
+    {
+        StartReassemblyTimer();
+    }
+}
+
+void MeshForwarder::StartReassemblyTimer(void)
+{
+    Message *        message = mReassemblyList.GetHead();
+    ReassemblyEntry *entry;
+
+    VerifyOrExit(message != NULL);
+    entry = FindReassemblyEntry(*message);
+    assert(entry != NULL);
+
+    mReassemblyTimer.StartAt(entry->GetUpdateTime(), TimerMilli::SecToMsec(kReassemblyTimeout));
+
+exit:
+    return;
+}
+
+void MeshForwarder::HandleReassemblyTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MeshForwarder>().HandleReassemblyTimer();
+}
+
+void MeshForwarder::HandleReassemblyTimer(void)
+{
+    uint32_t         now = TimerMilli::GetNow();
+    Message *        message;
+    ReassemblyEntry *entry;
+
+    while ((message = mReassemblyList.GetHead()) != NULL)
+    {
+        entry = FindReassemblyEntry(*message);
+        assert(entry != NULL);
+
+        if (TimerMilli::Elapsed(entry->GetUpdateTime(), now) < TimerMilli::SecToMsec(kReassemblyTimeout))
         {
-            mReassemblyList.Dequeue(*message);
+            break;
+        }
 
-            LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_REASSEMBLY_TIMEOUT);
-            if (message->GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
+        RemoveReassemblyEntry(*entry);
+        mReassemblyList.Dequeue(*message);
 
-            message->Free();
+        LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_REASSEMBLY_TIMEOUT);
+        if (message->GetType() == Message::kTypeIp6)
+        {
+            mIpCounters.mRxFailure++;
         }
+
+        message->Free();
     }
 
-    return mReassemblyList.GetHead() != NULL;
+    StartReassemblyTimer();
+}
+
+void MeshForwarder::HandleUpdateTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MeshForwarder>().HandleUpdateTimer();
+}
+
+void MeshForwarder::HandleUpdateTimer(void)
+{
+#if OPENTHREAD_FTD
+    if (UpdateFragmentLifetime())
+    {
+        mUpdateTimer.Start(kStateUpdatePeriod);
+    }
+#endif
 }
 
 void MeshForwarder::HandleLowpanHC(uint8_t *               aFrame,
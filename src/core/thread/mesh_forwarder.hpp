@@ -161,6 +161,123 @@ private:
     uint8_t  mLifetime : 3; ///< The lifetime of the entry (in seconds). 0 means the entry is invalid.
 };
 
+/**
+ * This class represents a 6LoWPAN reassembly entry.
+ *
+ * The entry indexes a message in the reassembly list by its (MAC source, datagram tag) and tracks which 8-octet
+ * units of the datagram have been received.
+ *
+ */
+class ReassemblyEntry
+{
+    friend class MeshForwarder;
+
+public:
+    /**
+     * This method initializes the entry for a datagram whose first fragment has been received.
+     *
+     * @param[in]  aMessage      A reference to the message holding the datagram.
+     * @param[in]  aMacSource    The MAC source address of the datagram.
+     * @param[in]  aDatagramTag  The datagram tag of the fragment header.
+     *
+     */
+    void Init(Message &aMessage, const Mac::Address &aMacSource, uint16_t aDatagramTag);
+
+    /**
+     * This method returns the message holding the datagram.
+     *
+     * @returns A pointer to the message, or NULL if the entry is unused.
+     *
+     */
+    Message *GetMessage(void) const { return mMessage; }
+
+    /**
+     * This method clears the entry.
+     *
+     */
+    void Clear(void) { mMessage = NULL; }
+
+    /**
+     * This method indicates whether the entry matches a given MAC source and datagram tag.
+     *
+     * @param[in]  aMacSource    The MAC source address.
+     * @param[in]  aDatagramTag  The datagram tag.
+     *
+     * @retval TRUE   If the entry matches.
+     * @retval FALSE  If the entry does not match.
+     *
+     */
+    bool Matches(const Mac::Address &aMacSource, uint16_t aDatagramTag) const;
+
+    /**
+     * This method marks a range of the datagram as received.
+     *
+     * @param[in]  aOffset  The datagram offset of the range in octets, a multiple of 8.
+     * @param[in]  aLength  The length of the range in octets.
+     *
+     * @retval OT_ERROR_NONE        Successfully marked the range.
+     * @retval OT_ERROR_DUPLICATED  The range overlaps a range received before, nothing was marked.
+     *
+     */
+    otError MarkReceived(uint16_t aOffset, uint16_t aLength);
+
+    /**
+     * This method indicates whether the whole datagram has been received.
+     *
+     * @retval TRUE   If all fragments have been received.
+     * @retval FALSE  If some fragments are still missing.
+     *
+     */
+    bool IsComplete(void) const { return mReceivedLength >= mMessage->GetLength(); }
+
+    /**
+     * This method returns the time the last fragment of the datagram was received.
+     *
+     * @returns The time the last fragment was received.
+     *
+     */
+    uint32_t GetUpdateTime(void) const { return mUpdateTime; }
+
+    /**
+     * This method sets the time the last fragment of the datagram was received.
+     *
+     * @param[in]  aUpdateTime  The time the last fragment was received.
+     *
+     */
+    void SetUpdateTime(uint32_t aUpdateTime) { mUpdateTime = aUpdateTime; }
+
+    /**
+     * This method returns the index of the next entry in the same hash bucket.
+     *
+     * @returns The index of the next entry in the bucket.
+     *
+     */
+    uint8_t GetNext(void) const { return mNext; }
+
+    /**
+     * This method sets the index of the next entry in the same hash bucket.
+     *
+     * @param[in]  aNext  The index of the next entry in the bucket.
+     *
+     */
+    void SetNext(uint8_t aNext) { mNext = aNext; }
+
+private:
+    enum
+    {
+        kOffsetUnit      = 8,    ///< The unit of the fragment header datagram offset (in octets).
+        kMaxDatagramSize = 2048, ///< The datagram size field in the fragment header is 11 bits.
+    };
+
+    Message *    mMessage;        ///< The message holding the datagram, NULL if unused.
+    Mac::Address mMacSource;      ///< The MAC source address of the datagram.
+    uint16_t     mDatagramTag;    ///< The datagram tag of the fragment header.
+    uint16_t     mReceivedLength; ///< The number of datagram octets received.
+    uint32_t     mUpdateTime;     ///< The time the last fragment was received.
+    uint8_t      mNext;           ///< The index of the next entry in the hash bucket.
+    uint8_t      mReceived[BitVectorBytes(kMaxDatagramSize / kOffsetUnit)]; ///< Received 8-octet units.
+};
+
 /**
  * This class implements mesh forwarding within Thread.
  *
@@ -318,6 +435,9 @@ private:
          *
          */
         kNumFragmentPriorityEntries = OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES,
+
+        kNumReassemblyEntries   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES, ///< Also the number of hash buckets.
+        kInvalidReassemblyIndex = 0xff,
     };
 
     enum MessageAction ///< Defines the action parameter in `LogMessageInfo()` method.
@@ -388,7 +508,6 @@ private:
     otError UpdateIp6Route(Message &aMessage);
     otError UpdateIp6RouteFtd(Ip6::Header &ip6Header);
     otError UpdateMeshRoute(Message &aMessage);
-    bool    UpdateReassemblyList(void);
     bool    UpdateFragmentLifetime(void);
     void    UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                    uint16_t                aFragmentLength,
@@ -396,6 +515,15 @@ private:
                                    uint8_t                 aPriority);
     otError HandleDatagram(Message &aMessage, const otThreadLinkInfo &aLinkInfo, const Mac::Address &aMacSource);
     void    ClearReassemblyList(void);
+    void    ResetReassemblyEntries(void);
+    uint8_t GetReassemblyBucket(const Mac::Address &aMacSource, uint16_t aDatagramTag) const;
+
+    ReassemblyEntry *FindReassemblyEntry(const Mac::Address &aMacSource, uint16_t aDatagramTag);
+    ReassemblyEntry *FindReassemblyEntry(const Message &aMessage);
+    ReassemblyEntry *NewReassemblyEntry(Message &aMessage, const Mac::Address &aMacSource, uint16_t aDatagramTag);
+    void             RemoveReassemblyEntry(ReassemblyEntry &aEntry);
+    void             UpdateReassemblyEntry(ReassemblyEntry &aEntry);
+    void             StartReassemblyTimer(void);
     void    RemoveMessage(Message &aMessage);
     void    HandleDiscoverComplete(void);
 
@@ -408,6 +536,8 @@ private:
     void        HandleDiscoverTimer(void);
     static void HandleUpdateTimer(Timer &aTimer);
     void        HandleUpdateTimer(void);
+    static void HandleReassemblyTimer(Timer &aTimer);
+    void        HandleReassemblyTimer(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
     void        ScheduleTransmissionTask(void);
 
@@ -492,11 +622,14 @@ private:
 
     TimerMilli mDiscoverTimer;
     TimerMilli mUpdateTimer;
-
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mFragTag;
-    uint16_t      mMessageNextOffset;
+    TimerMilli mReassemblyTimer;
+
+    PriorityQueue   mSendQueue;
+    MessageQueue    mReassemblyList; ///< Ordered by the time the last fragment was received, oldest first.
+    ReassemblyEntry mReassemblyEntries[kNumReassemblyEntries];
+    uint8_t         mReassemblyBuckets[kNumReassemblyEntries];
+    uint16_t        mFragTag;
+    uint16_t        mMessageNextOffset;
 
     Message *mSendMessage;
 
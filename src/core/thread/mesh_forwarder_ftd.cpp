@@ -94,14 +94,16 @@ otError MeshForwarder::SendMessage(Message &aMessage)
                 else
                 {
                     // destined for some sleepy children which subscribed the multicast address.
-                    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone();
-                         iter++)
-                    {
-                        Child &child = *iter.GetChild();
+                    ChildTable &childTable = Get<ChildTable>();
+                    ChildMask   childMask;
 
-                        if (mle.IsSleepyChildSubscribed(ip6Header.GetDestination(), child))
+                    mle.GetSleepyChildrenSubscribed(ip6Header.GetDestination(), childMask);
+
+                    for (uint8_t index = 0; index < childTable.GetMaxChildrenAllowed(); index++)
+                    {
+                        if (childMask.Has(index))
                         {
-                            mIndirectSender.AddMessageForSleepyChild(aMessage, child);
+                            mIndirectSender.AddMessageForSleepyChild(aMessage, *childTable.GetChildAtIndex(index));
                         }
                     }
                 }
@@ -197,19 +199,16 @@ otError MeshForwarder::EvictMessage(uint8_t aPriority)
     }
     else
     {
-        while (aPriority <= Message::kPriorityNet)
+        // Only messages not scheduled for direct transmission are
+        // considered, starting from the lowest priority level.
+        for (message = mSendQueue.GetHeadForIndirectTx(aPriority); message != NULL;
+             message = mSendQueue.GetNextForIndirectTx(*message))
         {
-            for (message = mSendQueue.GetHeadForPriority(aPriority); message && (message->GetPriority() == aPriority);
-                 message = message->GetNext())
+            if (message->IsChildPending())
             {
-                if (message->IsChildPending())
-                {
-                    RemoveMessage(*message);
-                    ExitNow(error = OT_ERROR_NONE);
-                }
+                RemoveMessage(*message);
+                ExitNow(error = OT_ERROR_NONE);
             }
-
-            aPriority++;
         }
     }
 
@@ -589,11 +588,24 @@ void MeshForwarder::UpdateRoutes(uint8_t *           aFrame,
 {
     Ip6::Header ip6Header;
     Neighbor *  neighbor;
+    Child *     child;
 
     VerifyOrExit(!aMeshDest.IsBroadcast() && aMeshSource.IsShort());
     SuccessOrExit(GetIp6Header(aFrame, aFrameLength, aMeshSource, aMeshDest, ip6Header));
 
-    Get<AddressResolver>().UpdateCacheEntry(ip6Header.GetSource(), aMeshSource.GetShort());
+    // Only add snooped entries for frames destined to this device or to one of its MTD children, so that frames
+    // forwarded on behalf of other devices do not churn the address cache.
+    if (aMeshDest.IsShort() &&
+        ((aMeshDest.GetShort() == Get<Mac::Mac>().GetShortAddress()) ||
+         (((child = Get<ChildTable>().FindChild(aMeshDest.GetShort(), ChildTable::kInStateValid)) != NULL) &&
+          !child->IsFullThreadDevice())))
+    {
+        Get<AddressResolver>().AddSnoopedCacheEntry(ip6Header.GetSource(), aMeshSource.GetShort());
+    }
+    else
+    {
+        Get<AddressResolver>().UpdateCacheEntry(ip6Header.GetSource(), aMeshSource.GetShort());
+    }
 
     neighbor = Get<Mle::MleRouter>().GetNeighbor(ip6Header.GetSource());
     VerifyOrExit(neighbor != NULL && !neighbor->IsFullThreadDevice());
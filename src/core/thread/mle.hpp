@@ -1648,6 +1648,7 @@ protected:
     TimerMilli    mAttachTimer;              ///< The timer for driving the attach process.
     TimerMilli    mDelayedResponseTimer;     ///< The timer to delay MLE responses.
     TimerMilli    mMessageTransmissionTimer; ///< The timer for (re-)sending of MLE messages (e.g. Child Update).
+    TlvIndex      mRxTlvIndex;               ///< Index of the TLVs of the MLE message being processed.
     uint8_t       mParentLeaderCost;
 
 private:
@@ -63,6 +63,8 @@ MleRouter::MleRouter(Instance &aInstance)
     , mAddressRelease(OT_URI_PATH_ADDRESS_RELEASE, &MleRouter::HandleAddressRelease, this)
     , mChildTable(aInstance)
     , mRouterTable(aInstance)
+    , mNumChildMulticastGroups(0)
+    , mChildMulticastGroupsOverflow(false)
     , mNeighborTableChangedCallback(NULL)
     , mChallengeTimeout(0)
     , mNextChildId(kMaxChildId)
@@ -576,22 +578,22 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid(), error = OT_ERROR_PARSE);
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId(), error = OT_ERROR_INVALID_STATE);
     }
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
@@ -642,7 +644,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
         VerifyOrExit(tlvRequest.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -654,7 +656,7 @@ otError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Message
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     if (neighbor != NULL)
     {
-        if (Tlv::GetTlv(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
+        if (mRxTlvIndex.Get(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
         {
             neighbor->SetTimeSyncEnabled(true);
         }
@@ -810,7 +812,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     if (aRequest)
@@ -823,11 +825,11 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid(), error = OT_ERROR_PARSE);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid(), error = OT_ERROR_PARSE);
 
     // Remove stale neighbors
@@ -837,11 +839,12 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter),
+                                          linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -851,7 +854,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     }
 
     // Link Margin
-    if (Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMargin), linkMargin) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kLinkMargin, sizeof(linkMargin), linkMargin) == OT_ERROR_NONE)
     {
         VerifyOrExit(linkMargin.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -898,17 +901,17 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
 
     case OT_DEVICE_ROLE_DETACHED:
         // Address16
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddress16, sizeof(address16), address16));
+        SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kAddress16, sizeof(address16), address16));
         VerifyOrExit(address16.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(GetRloc16() == address16.GetRloc16(), error = OT_ERROR_DROP);
 
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
 
         // Route
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route));
+        SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kRoute, sizeof(route), route));
         VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
         mRouterTable.Clear();
         SuccessOrExit(error = ProcessRouteTlv(route));
@@ -941,7 +944,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         VerifyOrExit(router != NULL);
 
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId());
 
@@ -952,7 +955,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         }
 
         // Route (optional)
-        if (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
+        if (mRxTlvIndex.Get(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
         {
             VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
             SuccessOrExit(error = ProcessRouteTlv(route));
@@ -988,11 +991,11 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     if (aRequest)
     {
         // Challenge
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+        SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
         VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
         // TLV Request
-        if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+        if (mRxTlvIndex.Get(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
         {
             VerifyOrExit(tlvRequest.IsValid(), error = OT_ERROR_PARSE);
         }
@@ -1162,7 +1165,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
     // Remove stale neighbors
@@ -1172,11 +1175,11 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
     }
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
     // Route Data (optional)
-    if (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kRoute, sizeof(route), route) == OT_ERROR_NONE)
     {
         VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -1597,11 +1600,11 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     aMessageInfo.GetPeerAddr().ToExtAddress(macAddr);
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid(), error = OT_ERROR_PARSE);
 
     // Scan Mask
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kScanMask, sizeof(scanMask), scanMask));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kScanMask, sizeof(scanMask), scanMask));
     VerifyOrExit(scanMask.IsValid(), error = OT_ERROR_PARSE);
 
     switch (mRole)
@@ -1621,7 +1624,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     }
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
 
     child = mChildTable.FindChild(macAddr, ChildTable::kInStateAnyExceptInvalid);
@@ -1630,16 +1633,14 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     {
         VerifyOrExit((child = mChildTable.GetNewChild()) != NULL);
 
-        memset(child, 0, sizeof(*child));
-
         // MAC Address
-        child->SetExtAddress(macAddr);
+        mChildTable.SetChildExtAddress(*child, macAddr);
         child->GetLinkInfo().Clear();
         child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
         child->ResetLinkFailures();
         child->SetState(Neighbor::kStateParentRequest);
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-        if (Tlv::GetTlv(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
+        if (mRxTlvIndex.Get(aMessage, Tlv::kTimeRequest, sizeof(timeRequest), timeRequest) == OT_ERROR_NONE)
         {
             child->SetTimeSyncEnabled(true);
         }
@@ -1957,6 +1958,7 @@ otError MleRouter::UpdateChildAddresses(const Message &aMessage, uint16_t aOffse
     offset = aOffset + sizeof(tlv);
     end    = offset + tlv.GetLength();
     aChild.ClearIp6Addresses();
+    RemoveChildMulticastSubscriptions(mChildTable.GetChildIndex(aChild));
 
     while (offset < end)
     {
@@ -2008,6 +2010,11 @@ otError MleRouter::UpdateChildAddresses(const Message &aMessage, uint16_t aOffse
 
         if (address.IsMulticast())
         {
+            if (error == OT_ERROR_NONE)
+            {
+                AddChildMulticastSubscription(address, mChildTable.GetChildIndex(aChild));
+            }
+
             continue;
         }
 
@@ -2045,9 +2052,96 @@ otError MleRouter::UpdateChildAddresses(const Message &aMessage, uint16_t aOffse
     error = OT_ERROR_NONE;
 
 exit:
+    if (mChildMulticastGroupsOverflow)
+    {
+        RebuildChildMulticastSubscriptions();
+    }
+
     return error;
 }
 
+MleRouter::ChildMulticastGroup *MleRouter::FindChildMulticastGroup(const Ip6::Address &aAddress)
+{
+    ChildMulticastGroup *rval = NULL;
+
+    for (uint8_t i = 0; i < mNumChildMulticastGroups; i++)
+    {
+        if (mChildMulticastGroups[i].mAddress == aAddress)
+        {
+            ExitNow(rval = &mChildMulticastGroups[i]);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void MleRouter::AddChildMulticastSubscription(const Ip6::Address &aAddress, uint8_t aChildIndex)
+{
+    ChildMulticastGroup *group = FindChildMulticastGroup(aAddress);
+
+    if (group == NULL)
+    {
+        VerifyOrExit(mNumChildMulticastGroups < kMaxChildMulticastGroups, mChildMulticastGroupsOverflow = true);
+
+        group           = &mChildMulticastGroups[mNumChildMulticastGroups++];
+        group->mAddress = aAddress;
+        group->mChildren.Clear();
+    }
+
+    group->mChildren.Add(aChildIndex);
+
+exit:
+    return;
+}
+
+void MleRouter::RemoveChildMulticastSubscriptions(uint8_t aChildIndex)
+{
+    uint8_t i = 0;
+
+    while (i < mNumChildMulticastGroups)
+    {
+        ChildMulticastGroup &group = mChildMulticastGroups[i];
+
+        group.mChildren.Remove(aChildIndex);
+
+        if (group.mChildren.IsEmpty())
+        {
+            // Keep the groups in use contiguous by moving the last one into the freed entry.
+            group = mChildMulticastGroups[--mNumChildMulticastGroups];
+            continue;
+        }
+
+        i++;
+    }
+}
+
+void MleRouter::RebuildChildMulticastSubscriptions(void)
+{
+    mNumChildMulticastGroups      = 0;
+    mChildMulticastGroupsOverflow = false;
+
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
+    {
+        Child &                   child = *iter.GetChild();
+        Child::Ip6AddressIterator addressIterator;
+        Ip6::Address              address;
+
+        while (child.GetNextIp6Address(GetInstance(), addressIterator, address) == OT_ERROR_NONE)
+        {
+            if (address.IsMulticast())
+            {
+                AddChildMulticastSubscription(address, mChildTable.GetChildIndex(child));
+            }
+        }
+
+        VerifyOrExit(!mChildMulticastGroupsOverflow);
+    }
+
+exit:
+    return;
+}
+
 otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
                                         const Ip6::MessageInfo &aMessageInfo,
                                         uint32_t                aKeySequence)
@@ -2082,7 +2176,7 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     VerifyOrExit(child != NULL, error = OT_ERROR_ALREADY);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid() &&
                      memcmp(response.GetResponse(), child->GetChallenge(), child->GetChallengeSize()) == 0,
                  error = OT_ERROR_SECURITY);
@@ -2094,11 +2188,12 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     Get<MeshForwarder>().RemoveMessages(*child, Message::kSubTypeMleDataResponse);
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter),
+                                          linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2108,21 +2203,21 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     }
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = OT_ERROR_PARSE);
 
     // Timeout
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kTimeout, sizeof(timeout), timeout));
     VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= Child::kMaxRequestTlvs, error = OT_ERROR_PARSE);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2130,14 +2225,14 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
 
     if (!mode.GetMode().IsFullThreadDevice())
     {
-        SuccessOrExit(error = Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset));
+        SuccessOrExit(error = mRxTlvIndex.GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset));
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
     }
 
@@ -2236,7 +2331,7 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     LogMleMessage("Receive Child Update Request from child", aMessageInfo.GetPeerAddr());
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = OT_ERROR_PARSE);
 
     // Find Child
@@ -2268,7 +2363,7 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     tlvs[tlvslength++] = Tlv::kLeaderData;
 
     // Challenge
-    if (Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == OT_ERROR_NONE)
     {
         VerifyOrExit(challenge.IsValid(), error = OT_ERROR_PARSE);
         tlvs[tlvslength++] = Tlv::kResponse;
@@ -2277,20 +2372,20 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     }
 
     // Ip6 Address TLV
-    if (Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
+    if (mRxTlvIndex.GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
     {
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
         tlvs[tlvslength++] = Tlv::kAddressRegistration;
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
     {
         VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2304,7 +2399,7 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
         uint8_t            tlv;
         TlvRequestIterator iterator = TLVREQUESTTLV_ITERATOR_INIT;
@@ -2387,7 +2482,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == OT_ERROR_NONE)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2402,7 +2497,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     LogMleMessage("Receive Child Update Response from child", aMessageInfo.GetPeerAddr(), child->GetRloc16());
 
     // Response
-    if (Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kResponse, sizeof(response), response) == OT_ERROR_NONE)
     {
         VerifyOrExit(response.IsValid() &&
                          memcmp(response.GetResponse(), child->GetChallenge(), child->GetChallengeSize()) == 0,
@@ -2410,7 +2505,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Status
-    if (Tlv::GetTlv(aMessage, Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kStatus, sizeof(status), status) == OT_ERROR_NONE)
     {
         VerifyOrExit(status.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2422,34 +2517,34 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     }
 
     // Link-Layer Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(linkFrameCounter.IsValid(), error = OT_ERROR_PARSE);
         child->SetLinkFrameCounter(linkFrameCounter.GetFrameCounter());
     }
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == OT_ERROR_NONE)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = OT_ERROR_PARSE);
         child->SetMleFrameCounter(mleFrameCounter.GetFrameCounter());
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == OT_ERROR_NONE)
     {
         VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
         child->SetTimeout(timeout.GetTimeout());
     }
 
     // Ip6 Address
-    if (Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
+    if (mRxTlvIndex.GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset) == OT_ERROR_NONE)
     {
         SuccessOrExit(error = UpdateChildAddresses(aMessage, addressRegistrationOffset, *child));
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == OT_ERROR_NONE)
     {
         VerifyOrExit(leaderData.IsValid(), error = OT_ERROR_PARSE);
 
@@ -2484,13 +2579,13 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
     LogMleMessage("Receive Data Request", aMessageInfo.GetPeerAddr());
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = mRxTlvIndex.Get(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(tlvs), error = OT_ERROR_PARSE);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2498,7 +2593,7 @@ otError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Message
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
+    if (mRxTlvIndex.Get(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == OT_ERROR_NONE)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
@@ -2633,7 +2728,7 @@ otError MleRouter::HandleDiscoveryRequest(const Message &aMessage, const Ip6::Me
     VerifyOrExit(IsFullThreadDevice(), error = OT_ERROR_INVALID_STATE);
 
     // find MLE Discovery TLV
-    VerifyOrExit(Tlv::GetOffset(aMessage, Tlv::kDiscovery, offset) == OT_ERROR_NONE, error = OT_ERROR_PARSE);
+    VerifyOrExit(mRxTlvIndex.GetOffset(aMessage, Tlv::kDiscovery, offset) == OT_ERROR_NONE, error = OT_ERROR_PARSE);
     aMessage.Read(offset, sizeof(tlv), &tlv);
 
     offset += sizeof(tlv);
@@ -2823,7 +2918,7 @@ otError MleRouter::SendChildIdResponse(Child &aChild)
         } while (mChildTable.FindChild(rloc16, ChildTable::kInStateAnyExceptInvalid) != NULL);
 
         // allocate Child ID
-        aChild.SetRloc16(rloc16);
+        mChildTable.SetChildRloc16(aChild, rloc16);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild.GetRloc16()));
@@ -3150,6 +3245,7 @@ void MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 
             aNeighbor.SetState(Neighbor::kStateInvalid);
 
+            RemoveChildMulticastSubscriptions(mChildTable.GetChildIndex(static_cast<Child &>(aNeighbor)));
             Get<IndirectSender>().ClearAllMessagesForSleepyChild(static_cast<Child &>(aNeighbor));
             Get<NetworkData::Leader>().SendServerDataNotification(aNeighbor.GetRloc16());
 
@@ -3515,11 +3611,11 @@ void MleRouter::RestoreChildren(void)
             foundDuplicate = true;
         }
 
-        memset(child, 0, sizeof(*child));
+        mChildTable.ClearChild(*child);
 
-        child->SetExtAddress(*static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
+        mChildTable.SetChildExtAddress(*child, *static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
         child->GetLinkInfo().Clear();
-        child->SetRloc16(childInfo.mRloc16);
+        mChildTable.SetChildRloc16(*child, childInfo.mRloc16);
         child->SetTimeout(childInfo.mTimeout);
         child->SetDeviceMode(DeviceMode(childInfo.mMode));
         child->SetState(Neighbor::kStateRestored);
@@ -4010,7 +4106,7 @@ void MleRouter::HandleAddressSolicit(Coap::Message &aMessage, const Ip6::Message
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     // In a time sync enabled network, all routers' xtal accuracy must be less than the threshold.
-    if (Tlv::GetTlv(aMessage, Tlv::kXtalAccuracy, sizeof(xtalAccuracyTlv), xtalAccuracyTlv) != OT_ERROR_NONE ||
+    if (mRxTlvIndex.Get(aMessage, Tlv::kXtalAccuracy, sizeof(xtalAccuracyTlv), xtalAccuracyTlv) != OT_ERROR_NONE ||
         xtalAccuracyTlv.GetXtalAccuracy() > Get<TimeSync>().GetXtalThreshold())
     {
         ExitNow(router = NULL);
@@ -4653,25 +4749,54 @@ void MleRouter::Signal(otNeighborTableEvent aEvent, Neighbor &aNeighbor)
 
 bool MleRouter::HasSleepyChildrenSubscribed(const Ip6::Address &aAddress)
 {
-    bool rval = false;
+    ChildMask childMask;
 
-    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
+    GetSleepyChildrenSubscribed(aAddress, childMask);
+
+    return !childMask.IsEmpty();
+}
+
+void MleRouter::GetSleepyChildrenSubscribed(const Ip6::Address &aAddress, ChildMask &aChildMask)
+{
+    ChildMulticastGroup *group;
+
+    aChildMask.Clear();
+
+    if (mChildMulticastGroupsOverflow)
     {
-        Child &child = *iter.GetChild();
+        for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
+        {
+            if (IsSleepyChildSubscribed(aAddress, *iter.GetChild()))
+            {
+                aChildMask.Add(mChildTable.GetChildIndex(*iter.GetChild()));
+            }
+        }
 
-        if (child.IsRxOnWhenIdle())
+        ExitNow();
+    }
+
+    VerifyOrExit((group = FindChildMulticastGroup(aAddress)) != NULL);
+
+    for (uint8_t index = 0; index < mChildTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child;
+
+        if (!group->mChildren.Has(index))
         {
             continue;
         }
 
-        if (IsSleepyChildSubscribed(aAddress, child))
+        // The group may still list a child entry that was cleared and reused since it registered.
+        child = mChildTable.GetChildAtIndex(index);
+
+        if (child != NULL && IsSleepyChildSubscribed(aAddress, *child))
         {
-            ExitNow(rval = true);
+            aChildMask.Add(index);
         }
     }
 
 exit:
-    return rval;
+    return;
 }
 
 bool MleRouter::IsSleepyChildSubscribed(const Ip6::Address &aAddress, Child &aChild)
@@ -619,6 +619,15 @@ public:
      */
     bool HasSleepyChildrenSubscribed(const Ip6::Address &aAddress);
 
+    /**
+     * This method gets the set of sleepy children subscribed to a multicast address.
+     *
+     * @param[in]   aAddress    The multicast address.
+     * @param[out]  aChildMask  A reference to a child mask to output the subscribed sleepy children.
+     *
+     */
+    void GetSleepyChildrenSubscribed(const Ip6::Address &aAddress, ChildMask &aChildMask);
+
     /**
      * This method returns whether the specific child subscribed the address.
      *
@@ -664,6 +673,13 @@ private:
         kDiscoveryMaxJitter = 250u,  ///< Maximum jitter time used to delay Discovery Responses in milliseconds.
         kStateUpdatePeriod  = 1000u, ///< State update period in milliseconds.
         kUnsolicitedDataResponseJitter = 500u, ///< Maximum delay before unsolicited Data Response in milliseconds.
+        kMaxChildMulticastGroups       = OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS,
+    };
+
+    struct ChildMulticastGroup
+    {
+        Ip6::Address mAddress;
+        ChildMask    mChildren; // Children with the group registered (may include stale entries).
     };
 
     otError AppendConnectivity(Message &aMessage);
@@ -734,6 +750,11 @@ private:
     otError UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void    UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
 
+    ChildMulticastGroup *FindChildMulticastGroup(const Ip6::Address &aAddress);
+    void                 AddChildMulticastSubscription(const Ip6::Address &aAddress, uint8_t aChildIndex);
+    void                 RemoveChildMulticastSubscriptions(uint8_t aChildIndex);
+    void                 RebuildChildMulticastSubscriptions(void);
+
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
                                              const otMessageInfo *aMessageInfo,
@@ -769,6 +790,10 @@ private:
     ChildTable  mChildTable;
     RouterTable mRouterTable;
 
+    ChildMulticastGroup mChildMulticastGroups[kMaxChildMulticastGroups];
+    uint8_t             mNumChildMulticastGroups;
+    bool                mChildMulticastGroupsOverflow;
+
     otNeighborTableCallback mNeighborTableChangedCallback;
 
     uint8_t  mChallengeTimeout;
@@ -55,6 +55,10 @@ namespace NetworkData {
 
 LeaderBase::LeaderBase(Instance &aInstance)
     : NetworkData(aInstance, kTypeLeader)
+    , mNumLookupPrefixes(0)
+    , mNumLookupRoutes(0)
+    , mLookupTableValid(false)
+    , mLookupLongContext(false)
 {
     Reset();
 }
@@ -64,13 +68,13 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+    InvalidateLookupTable();
     Get<Notifier>().Signal(OT_CHANGED_THREAD_NETDATA);
 }
 
 otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
 {
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    uint8_t index;
 
     aContext.mPrefixLength = 0;
 
@@ -82,45 +86,82 @@ otError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aC
         aContext.mCompressFlag = true;
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
+    UpdateLookupTable();
+
+    // Only a context prefix longer than 64 bits can override the mesh-local prefix.
+    VerifyOrExit(aContext.mPrefixLength == 0 || mLookupLongContext);
+
+    index = FindContextPrefix(aAddress);
+    VerifyOrExit(index != kLookupNone);
+
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+        const LookupPrefix &entry      = mLookupPrefixes[index];
+        ContextTlv *        contextTlv = reinterpret_cast<ContextTlv *>(&mTlvs[entry.mContextOffset]);
 
-        prefix = static_cast<PrefixTlv *>(cur);
+        VerifyOrExit(GetLookupPrefixLength(entry) > aContext.mPrefixLength);
+
+        aContext.mPrefix       = GetLookupPrefix(entry);
+        aContext.mPrefixLength = GetLookupPrefixLength(entry);
+        aContext.mContextId    = contextTlv->GetContextId();
+        aContext.mCompressFlag = contextTlv->IsCompress();
+    }
+
+exit:
+    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+}
+
+uint8_t LeaderBase::FindContextPrefix(const Ip6::Address &aAddress)
+{
+    ContextCacheEntry *cacheEntry = NULL;
+    uint8_t            rval       = kLookupNone;
+
+    // With no context prefix longer than 64 bits, the result only depends on the 64-bit prefix of the address.
+    if (!mLookupLongContext)
+    {
+        uint8_t hash = 0;
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        for (uint8_t i = 0; i < sizeof(cacheEntry->mPrefix); i++)
         {
-            continue;
+            hash ^= aAddress.mFields.m8[i];
         }
 
-        contextTlv = FindContext(*prefix);
+        cacheEntry = &mContextCache[hash % kContextCacheSize];
 
-        if (contextTlv == NULL)
+        if (cacheEntry->mPrefixIndex != kContextCacheEmpty &&
+            memcmp(cacheEntry->mPrefix, aAddress.mFields.m8, sizeof(cacheEntry->mPrefix)) == 0)
         {
-            continue;
+            ExitNow(rval = cacheEntry->mPrefixIndex);
         }
+    }
+
+    // Prefixes are visited longest first, so the first match with a context is the longest one.
+    for (uint8_t i = 0; i < mNumLookupPrefixes; i++)
+    {
+        const LookupPrefix &entry = mLookupPrefixes[mLookupOrder[i]];
 
-        if (prefix->GetPrefixLength() > aContext.mPrefixLength)
+        if (entry.mContextOffset != kLookupNone && GetLookupPrefixLength(entry) > 0 &&
+            PrefixMatch(GetLookupPrefix(entry), aAddress.mFields.m8, GetLookupPrefixLength(entry)) >= 0)
         {
-            aContext.mPrefix       = prefix->GetPrefix();
-            aContext.mPrefixLength = prefix->GetPrefixLength();
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            rval = mLookupOrder[i];
+            break;
         }
     }
 
-    return (aContext.mPrefixLength > 0) ? OT_ERROR_NONE : OT_ERROR_NOT_FOUND;
+    if (cacheEntry != NULL)
+    {
+        memcpy(cacheEntry->mPrefix, aAddress.mFields.m8, sizeof(cacheEntry->mPrefix));
+        cacheEntry->mPrefixIndex = rval;
+    }
+
+exit:
+    return rval;
 }
 
 otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
 {
-    otError     error = OT_ERROR_NOT_FOUND;
-    PrefixTlv * prefix;
-    ContextTlv *contextTlv;
+    otError             error = OT_ERROR_NOT_FOUND;
+    const LookupPrefix *entry;
+    ContextTlv *        contextTlv;
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -131,33 +172,18 @@ otError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
         ExitNow(error = OT_ERROR_NONE);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateLookupTable();
 
-        prefix     = static_cast<PrefixTlv *>(cur);
-        contextTlv = FindContext(*prefix);
+    VerifyOrExit(aContextId < kNumLookupContexts && mLookupContexts[aContextId] != kLookupNone);
 
-        if (contextTlv == NULL)
-        {
-            continue;
-        }
-
-        if (contextTlv->GetContextId() != aContextId)
-        {
-            continue;
-        }
+    entry      = &mLookupPrefixes[mLookupContexts[aContextId]];
+    contextTlv = reinterpret_cast<ContextTlv *>(&mTlvs[entry->mContextOffset]);
 
-        aContext.mPrefix       = prefix->GetPrefix();
-        aContext.mPrefixLength = prefix->GetPrefixLength();
-        aContext.mContextId    = contextTlv->GetContextId();
-        aContext.mCompressFlag = contextTlv->IsCompress();
-        ExitNow(error = OT_ERROR_NONE);
-    }
+    aContext.mPrefix       = GetLookupPrefix(*entry);
+    aContext.mPrefixLength = GetLookupPrefixLength(*entry);
+    aContext.mContextId    = contextTlv->GetContextId();
+    aContext.mCompressFlag = contextTlv->IsCompress();
+    error                  = OT_ERROR_NONE;
 
 exit:
     return error;
@@ -192,35 +218,24 @@ exit:
 
 bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress)
 {
-    PrefixTlv *prefix;
-    bool       rval = false;
+    bool rval = false;
 
     if (memcmp(aAddress.mFields.m8, Get<Mle::MleRouter>().GetMeshLocalPrefix().m8, sizeof(otMeshLocalPrefix)) == 0)
     {
         ExitNow(rval = true);
     }
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
-
-        prefix = static_cast<PrefixTlv *>(cur);
+    UpdateLookupTable();
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
-        {
-            continue;
-        }
+    for (uint8_t i = 0; i < mNumLookupPrefixes; i++)
+    {
+        const LookupPrefix &entry = mLookupPrefixes[i];
 
-        if (FindBorderRouter(*prefix) == NULL)
+        if (entry.mHasBorderRouter &&
+            PrefixMatch(GetLookupPrefix(entry), aAddress.mFields.m8, GetLookupPrefixLength(entry)) >= 0)
         {
-            continue;
+            ExitNow(rval = true);
         }
-
-        ExitNow(rval = true);
     }
 
 exit:
@@ -232,27 +247,23 @@ otError LeaderBase::RouteLookup(const Ip6::Address &aSource,
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16)
 {
-    otError    error = OT_ERROR_NO_ROUTE;
-    PrefixTlv *prefix;
+    otError error = OT_ERROR_NO_ROUTE;
 
-    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateLookupTable();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumLookupPrefixes; i++)
+    {
+        const LookupPrefix &entry = mLookupPrefixes[i];
 
-        if (PrefixMatch(prefix->GetPrefix(), aSource.mFields.m8, prefix->GetPrefixLength()) >= 0)
+        if (PrefixMatch(GetLookupPrefix(entry), aSource.mFields.m8, GetLookupPrefixLength(entry)) >= 0)
         {
-            if (ExternalRouteLookup(prefix->GetDomainId(), aDestination, aPrefixMatch, aRloc16) == OT_ERROR_NONE)
+            if (ExternalRouteLookup(GetLookupPrefixTlv(entry).GetDomainId(), aDestination, aPrefixMatch, aRloc16) ==
+                OT_ERROR_NONE)
             {
                 ExitNow(error = OT_ERROR_NONE);
             }
 
-            if (DefaultRouteLookup(*prefix, aRloc16) == OT_ERROR_NONE)
+            if (DefaultRouteLookup(entry, aRloc16) == OT_ERROR_NONE)
             {
                 if (aPrefixMatch)
                 {
@@ -273,59 +284,40 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
                                         uint8_t *           aPrefixMatch,
                                         uint16_t *          aRloc16)
 {
-    otError         error = OT_ERROR_NO_ROUTE;
-    PrefixTlv *     prefix;
-    HasRouteTlv *   hasRoute;
-    HasRouteEntry * entry;
-    HasRouteEntry * rvalRoute = NULL;
-    uint8_t         rval_plen = 0;
-    int8_t          plen;
-    NetworkDataTlv *cur;
-    NetworkDataTlv *subCur;
-
-    for (cur = reinterpret_cast<NetworkDataTlv *>(mTlvs); cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    otError        error = OT_ERROR_NO_ROUTE;
+    HasRouteEntry *entry;
+    HasRouteEntry *rvalRoute = NULL;
+    uint8_t        rval_plen = 0;
+    int8_t         plen;
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumLookupPrefixes; i++)
+    {
+        const LookupPrefix &prefix = mLookupPrefixes[i];
+        const uint8_t *     routes = &mLookupRoutes[prefix.mFirstRoute + prefix.mNumDefaultRoutes];
 
-        if (prefix->GetDomainId() != aDomainId)
+        if (prefix.mNumExternalRoutes == 0 || GetLookupPrefixTlv(prefix).GetDomainId() != aDomainId)
         {
             continue;
         }
 
-        plen = PrefixMatch(prefix->GetPrefix(), aDestination.mFields.m8, prefix->GetPrefixLength());
+        plen = PrefixMatch(GetLookupPrefix(prefix), aDestination.mFields.m8, GetLookupPrefixLength(prefix));
 
         if (plen > rval_plen)
         {
             // select border router
-            for (subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
+            for (uint8_t j = 0; j < prefix.mNumExternalRoutes; j++)
             {
-                if (subCur->GetType() != NetworkDataTlv::kTypeHasRoute)
-                {
-                    continue;
-                }
-
-                hasRoute = static_cast<HasRouteTlv *>(subCur);
-
-                for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+                entry = reinterpret_cast<HasRouteEntry *>(&mTlvs[routes[j]]);
+
+                if (rvalRoute == NULL || entry->GetPreference() > rvalRoute->GetPreference() ||
+                    (entry->GetPreference() == rvalRoute->GetPreference() &&
+                     (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
+                      (rvalRoute->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
+                       Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
+                           Get<Mle::MleRouter>().GetCost(rvalRoute->GetRloc())))))
                 {
-                    entry = hasRoute->GetEntry(i);
-
-                    if (rvalRoute == NULL || entry->GetPreference() > rvalRoute->GetPreference() ||
-                        (entry->GetPreference() == rvalRoute->GetPreference() &&
-                         (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                          (rvalRoute->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                           Get<Mle::MleRouter>().GetCost(entry->GetRloc()) <
-                               Get<Mle::MleRouter>().GetCost(rvalRoute->GetRloc())))))
-                    {
-                        rvalRoute = entry;
-                        rval_plen = static_cast<uint8_t>(plen);
-                    }
+                    rvalRoute = entry;
+                    rval_plen = static_cast<uint8_t>(plen);
                 }
             }
         }
@@ -349,53 +341,170 @@ otError LeaderBase::ExternalRouteLookup(uint8_t             aDomainId,
     return error;
 }
 
-otError LeaderBase::DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16)
+otError LeaderBase::DefaultRouteLookup(const LookupPrefix &aEntry, uint16_t *aRloc16)
 {
-    otError            error = OT_ERROR_NO_ROUTE;
-    BorderRouterTlv *  borderRouter;
+    otError            error  = OT_ERROR_NO_ROUTE;
+    const uint8_t *    routes = &mLookupRoutes[aEntry.mFirstRoute];
     BorderRouterEntry *entry;
     BorderRouterEntry *route = NULL;
 
-    for (NetworkDataTlv *cur = aPrefix.GetSubTlvs(); cur < aPrefix.GetNext(); cur = cur->GetNext())
+    for (uint8_t i = 0; i < aEntry.mNumDefaultRoutes; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypeBorderRouter)
+        entry = reinterpret_cast<BorderRouterEntry *>(&mTlvs[routes[i]]);
+
+        if (route == NULL || entry->GetPreference() > route->GetPreference() ||
+            (entry->GetPreference() == route->GetPreference() &&
+             (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
+              (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
+               Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+        {
+            route = entry;
+        }
+    }
+
+    if (route != NULL)
+    {
+        if (aRloc16 != NULL)
+        {
+            *aRloc16 = route->GetRloc();
+        }
+
+        error = OT_ERROR_NONE;
+    }
+
+    return error;
+}
+
+void LeaderBase::UpdateLookupTable(void)
+{
+    VerifyOrExit(!mLookupTableValid);
+
+    mLookupTableValid  = true;
+    mLookupLongContext = false;
+    mNumLookupPrefixes = 0;
+    mNumLookupRoutes   = 0;
+    memset(mLookupContexts, kLookupNone, sizeof(mLookupContexts));
+
+    for (uint8_t i = 0; i < kContextCacheSize; i++)
+    {
+        mContextCache[i].mPrefixIndex = kContextCacheEmpty;
+    }
+
+    for (NetworkDataTlv *cur                                            = reinterpret_cast<NetworkDataTlv *>(mTlvs);
+         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength); cur = cur->GetNext())
+    {
+        PrefixTlv *   prefix;
+        ContextTlv *  contextTlv;
+        LookupPrefix &entry = mLookupPrefixes[mNumLookupPrefixes];
+        uint8_t       index;
+
+        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
         {
             continue;
         }
 
-        borderRouter = static_cast<BorderRouterTlv *>(cur);
+        VerifyOrExit(mNumLookupPrefixes < kMaxLookupPrefixes);
+
+        prefix                   = static_cast<PrefixTlv *>(cur);
+        entry.mPrefixOffset      = GetOffset(prefix);
+        entry.mContextOffset     = kLookupNone;
+        entry.mFirstRoute        = mNumLookupRoutes;
+        entry.mNumDefaultRoutes  = 0;
+        entry.mNumExternalRoutes = 0;
+        entry.mHasBorderRouter   = (FindBorderRouter(*prefix) != NULL);
+
+        contextTlv = FindContext(*prefix);
 
-        for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
+        if (contextTlv != NULL)
         {
-            entry = borderRouter->GetEntry(i);
+            entry.mContextOffset = GetOffset(contextTlv);
 
-            if (!entry->IsDefaultRoute())
+            if (prefix->GetPrefixLength() > 64)
+            {
+                mLookupLongContext = true;
+            }
+
+            // Like the Network Data walk, a Context ID resolves to the first prefix carrying it.
+            if (mLookupContexts[contextTlv->GetContextId()] == kLookupNone)
+            {
+                mLookupContexts[contextTlv->GetContextId()] = mNumLookupPrefixes;
+            }
+        }
+
+        // Default route Border Router entries first, then Has Route entries, each in Network Data order.
+        for (NetworkDataTlv *subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
+        {
+            BorderRouterTlv *borderRouter;
+
+            if (subCur->GetType() != NetworkDataTlv::kTypeBorderRouter)
             {
                 continue;
             }
 
-            if (route == NULL || entry->GetPreference() > route->GetPreference() ||
-                (entry->GetPreference() == route->GetPreference() &&
-                 (entry->GetRloc() == Get<Mle::MleRouter>().GetRloc16() ||
-                  (route->GetRloc() != Get<Mle::MleRouter>().GetRloc16() &&
-                   Get<Mle::MleRouter>().GetCost(entry->GetRloc()) < Get<Mle::MleRouter>().GetCost(route->GetRloc())))))
+            borderRouter = static_cast<BorderRouterTlv *>(subCur);
+
+            for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
             {
-                route = entry;
+                BorderRouterEntry *borderRouterEntry = borderRouter->GetEntry(i);
+
+                if (borderRouterEntry->IsDefaultRoute())
+                {
+                    VerifyOrExit(AddLookupRoute(reinterpret_cast<uint8_t *>(borderRouterEntry),
+                                                sizeof(BorderRouterEntry)));
+                    entry.mNumDefaultRoutes++;
+                }
             }
         }
-    }
 
-    if (route != NULL)
-    {
-        if (aRloc16 != NULL)
+        for (NetworkDataTlv *subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
         {
-            *aRloc16 = route->GetRloc();
+            HasRouteTlv *hasRoute;
+
+            if (subCur->GetType() != NetworkDataTlv::kTypeHasRoute)
+            {
+                continue;
+            }
+
+            hasRoute = static_cast<HasRouteTlv *>(subCur);
+
+            for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+            {
+                VerifyOrExit(AddLookupRoute(reinterpret_cast<uint8_t *>(hasRoute->GetEntry(i)), sizeof(HasRouteEntry)));
+                entry.mNumExternalRoutes++;
+            }
         }
 
-        error = OT_ERROR_NONE;
+        // Keep the longest-first order stable, so equal lengths stay in Network Data order.
+        for (index = mNumLookupPrefixes;
+             index > 0 && GetLookupPrefixLength(mLookupPrefixes[mLookupOrder[index - 1]]) < prefix->GetPrefixLength();
+             index--)
+        {
+            mLookupOrder[index] = mLookupOrder[index - 1];
+        }
+
+        mLookupOrder[index] = mNumLookupPrefixes++;
     }
 
-    return error;
+exit:
+    return;
+}
+
+bool LeaderBase::AddLookupRoute(const uint8_t *aEntry, uint8_t aEntrySize)
+{
+    bool rval = false;
+
+    VerifyOrExit(mNumLookupRoutes < kMaxLookupRoutes && aEntry + aEntrySize <= mTlvs + mLength);
+
+    mLookupRoutes[mNumLookupRoutes++] = GetOffset(aEntry);
+    rval                              = true;
+
+exit:
+    return rval;
+}
+
+uint8_t LeaderBase::GetOffset(const void *aTlv) const
+{
+    return static_cast<uint8_t>(reinterpret_cast<const uint8_t *>(aTlv) - mTlvs);
 }
 
 otError LeaderBase::SetNetworkData(uint8_t        aVersion,
@@ -411,6 +520,8 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
     length = aMessage.Read(aMessageOffset, sizeof(tlv), &tlv);
     VerifyOrExit(length == sizeof(tlv), error = OT_ERROR_PARSE);
 
+    InvalidateLookupTable();
+
     length = aMessage.Read(aMessageOffset + sizeof(tlv), tlv.GetLength(), mTlvs);
     VerifyOrExit(length == tlv.GetLength(), error = OT_ERROR_PARSE);
 
@@ -447,6 +558,7 @@ otError LeaderBase::SetCommissioningData(const uint8_t *aValue, uint8_t aValueLe
 
     VerifyOrExit(sizeof(NetworkDataTlv) + aValueLength < remaining, error = OT_ERROR_NO_BUFS);
 
+    InvalidateLookupTable();
     RemoveCommissioningData();
 
     if (aValueLength > 0)
@@ -232,17 +232,83 @@ public:
 #endif // OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE || OPENTHREAD_CONFIG_DHCP6_CLIENT_ENABLE
 
 protected:
+    /**
+     * This method marks the lookup table derived from the Network Data as outdated.
+     *
+     * It must be called whenever the Network Data TLVs are modified. The table is rebuilt on the next lookup.
+     *
+     */
+    void InvalidateLookupTable(void) { mLookupTableValid = false; }
+
     uint8_t mStableVersion;
     uint8_t mVersion;
 
 private:
+    enum
+    {
+        kMaxLookupPrefixes = kMaxSize / sizeof(PrefixTlv),     ///< Each Prefix TLV takes at least this many bytes.
+        kMaxLookupRoutes   = kMaxSize / sizeof(HasRouteEntry), ///< Each route entry takes at least this many bytes.
+        kNumLookupContexts = 16,                               ///< Context IDs are 4 bits.
+        kLookupNone        = 0xff,                             ///< Marks an absent offset or index.
+        kContextCacheSize  = 8,                                ///< Number of entries in the context cache.
+        kContextCacheEmpty = 0xfe,                             ///< Marks an unused context cache entry.
+    };
+
+    /**
+     * This structure represents a Prefix TLV in the lookup table.
+     *
+     * TLVs and entries are referenced by their offset in `mTlvs`.
+     *
+     */
+    struct LookupPrefix
+    {
+        uint8_t mPrefixOffset;      ///< Offset of the Prefix TLV.
+        uint8_t mContextOffset;     ///< Offset of the Context sub-TLV, or `kLookupNone`.
+        uint8_t mFirstRoute;        ///< Index of the prefix's first entry in `mLookupRoutes`.
+        uint8_t mNumDefaultRoutes;  ///< Number of default route Border Router entries.
+        uint8_t mNumExternalRoutes; ///< Number of Has Route entries, following the default route entries.
+        bool    mHasBorderRouter;   ///< Whether the prefix has a Border Router sub-TLV.
+    };
+
+    /**
+     * This structure caches the longest context prefix matching a 64-bit prefix.
+     *
+     */
+    struct ContextCacheEntry
+    {
+        uint8_t mPrefix[8];   ///< The 64-bit prefix.
+        uint8_t mPrefixIndex; ///< Index in `mLookupPrefixes`, `kLookupNone` or `kContextCacheEmpty`.
+    };
+
     otError RemoveCommissioningData(void);
 
     otError ExternalRouteLookup(uint8_t             aDomainId,
                                 const Ip6::Address &aDestination,
                                 uint8_t *           aPrefixMatch,
                                 uint16_t *          aRloc16);
-    otError DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16);
+    otError DefaultRouteLookup(const LookupPrefix &aEntry, uint16_t *aRloc16);
+
+    void     UpdateLookupTable(void);
+    uint8_t  FindContextPrefix(const Ip6::Address &aAddress);
+    bool     AddLookupRoute(const uint8_t *aEntry, uint8_t aEntrySize);
+    uint8_t  GetOffset(const void *aTlv) const;
+    uint8_t *GetLookupPrefix(const LookupPrefix &aEntry) { return GetLookupPrefixTlv(aEntry).GetPrefix(); }
+    uint8_t  GetLookupPrefixLength(const LookupPrefix &aEntry) { return GetLookupPrefixTlv(aEntry).GetPrefixLength(); }
+    PrefixTlv &GetLookupPrefixTlv(const LookupPrefix &aEntry)
+    {
+        return *reinterpret_cast<PrefixTlv *>(&mTlvs[aEntry.mPrefixOffset]);
+    }
+
+    LookupPrefix mLookupPrefixes[kMaxLookupPrefixes]; ///< Prefix TLVs, in Network Data order.
+    uint8_t      mLookupOrder[kMaxLookupPrefixes];    ///< Indexes in `mLookupPrefixes`, longest prefix first.
+    uint8_t      mLookupRoutes[kMaxLookupRoutes];     ///< Offsets of route entries, grouped by prefix.
+    uint8_t      mLookupContexts[kNumLookupContexts]; ///< Index in `mLookupPrefixes` for each Context ID.
+    uint8_t      mNumLookupPrefixes;
+    uint8_t      mNumLookupRoutes;
+    bool         mLookupTableValid : 1;
+    bool         mLookupLongContext : 1; ///< Whether a context prefix is longer than 64 bits.
+
+    ContextCacheEntry mContextCache[kContextCacheSize];
 };
 
 /**
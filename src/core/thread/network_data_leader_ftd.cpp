@@ -803,6 +803,8 @@ otError Leader::AddNetworkData(uint8_t *aTlvs, uint8_t aTlvsLength, uint8_t *aOl
     NetworkDataTlv *cur   = reinterpret_cast<NetworkDataTlv *>(aTlvs);
     NetworkDataTlv *end   = reinterpret_cast<NetworkDataTlv *>(aTlvs + aTlvsLength);
 
+    InvalidateLookupTable();
+
     while (cur < end)
     {
         VerifyOrExit((cur + 1) <= end && cur->GetNext() <= end, error = OT_ERROR_PARSE);
@@ -1240,6 +1242,8 @@ void Leader::RemoveRloc(uint16_t aRloc16, MatchMode aMatchMode)
     ServiceTlv *service;
 #endif
 
+    InvalidateLookupTable();
+
     while (1)
     {
         end = reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
@@ -1444,6 +1448,8 @@ void Leader::RemoveContext(uint8_t aContextId)
     NetworkDataTlv *end;
     PrefixTlv *     prefix;
 
+    InvalidateLookupTable();
+
     while (1)
     {
         end = reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
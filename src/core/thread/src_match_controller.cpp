@@ -204,17 +204,87 @@ exit:
     return;
 }
 
+otError SourceMatchController::AddAddresses(Child *const *aChildren, uint8_t aNumChildren)
+{
+    otError error;
+    uint8_t numAdded = 0;
+
+    if (aChildren[0]->IsIndirectSourceMatchShort())
+    {
+        otShortAddress shortAddresses[kMaxPendingBurst];
+
+        for (uint8_t i = 0; i < aNumChildren; i++)
+        {
+            shortAddresses[i] = aChildren[i]->GetRloc16();
+        }
+
+        error = otPlatRadioAddSrcMatchShortEntries(&GetInstance(), shortAddresses, aNumChildren, &numAdded);
+    }
+    else
+    {
+        otExtAddress extAddresses[kMaxPendingBurst];
+
+        for (uint8_t i = 0; i < aNumChildren; i++)
+        {
+            Mac::Address address;
+
+            address.SetExtended(aChildren[i]->GetExtAddress().m8, /* aReverse */ true);
+            extAddresses[i] = address.GetExtended();
+        }
+
+        error = otPlatRadioAddSrcMatchExtEntries(&GetInstance(), extAddresses, aNumChildren, &numAdded);
+    }
+
+    for (uint8_t i = 0; i < numAdded; i++)
+    {
+        aChildren[i]->SetIndirectSourceMatchPending(false);
+    }
+
+    otLogDebgMac("SrcAddrMatch - Added %d of %d pending %s addrs -- %s (%d)", numAdded, aNumChildren,
+                 aChildren[0]->IsIndirectSourceMatchShort() ? "short" : "ext", otThreadErrorToString(error), error);
+
+    return error;
+}
+
 otError SourceMatchController::AddPendingEntries(void)
+{
+    otError error;
+
+    SuccessOrExit(error = AddPendingEntries(/* aShortAddress */ true));
+    error = AddPendingEntries(/* aShortAddress */ false);
+
+exit:
+    return error;
+}
+
+otError SourceMatchController::AddPendingEntries(bool aShortAddress)
 {
     otError error = OT_ERROR_NONE;
+    Child * children[kMaxPendingBurst];
+    uint8_t numChildren = 0;
 
+    // Hand the pending entries to the radio in bursts, a remote radio can then write each burst in one round trip.
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValidOrRestoring); !iter.IsDone(); iter++)
     {
-        if (iter.GetChild()->IsIndirectSourceMatchPending())
+        Child &child = *iter.GetChild();
+
+        if (!child.IsIndirectSourceMatchPending() || (child.IsIndirectSourceMatchShort() != aShortAddress))
         {
-            SuccessOrExit(error = AddAddress(*iter.GetChild()));
-            iter.GetChild()->SetIndirectSourceMatchPending(false);
+            continue;
         }
+
+        children[numChildren++] = &child;
+
+        if (numChildren == kMaxPendingBurst)
+        {
+            SuccessOrExit(error = AddAddresses(children, numChildren));
+            numChildren = 0;
+        }
+    }
+
+    if (numChildren > 0)
+    {
+        error = AddAddresses(children, numChildren);
     }
 
 exit:
@@ -119,6 +119,11 @@ public:
     void SetSrcMatchAsShort(Child &aChild, bool aUseShortAddress);
 
 private:
+    enum
+    {
+        kMaxPendingBurst = 8, ///< Max number of pending entries handed to the radio in one call.
+    };
+
     /**
      * This method clears the source match table.
      *
@@ -174,6 +179,21 @@ private:
      */
     otError AddAddress(const Child &aChild);
 
+    /**
+     * This method adds the addresses of a list of children to the source match table in one platform call.
+     *
+     * All children in the list must use the same address type (@sa SetSrcMatchAsShort). The pending flag is cleared
+     * on the children whose address was added.
+     *
+     * @param[in] aChildren     A pointer to the list of children.
+     * @param[in] aNumChildren  The number of children in @p aChildren.
+     *
+     * @retval OT_ERROR_NONE     All addresses were added successfully to the source match table.
+     * @retval OT_ERROR_NO_BUFS  No available space in the source match table.
+     *
+     */
+    otError AddAddresses(Child *const *aChildren, uint8_t aNumChildren);
+
     /**
      * This method adds all pending entries to the source match table.
      *
@@ -183,6 +203,17 @@ private:
      */
     otError AddPendingEntries(void);
 
+    /**
+     * This method adds all pending entries of a given address type to the source match table.
+     *
+     * @param[in] aShortAddress  `true` to add the pending short address entries, `false` for extended addresses.
+     *
+     * @retval OT_ERROR_NONE     All pending entries were successfully added.
+     * @retval OT_ERROR_NO_BUFS  No available space in the source match table.
+     *
+     */
+    otError AddPendingEntries(bool aShortAddress);
+
     bool mEnabled;
 };
 
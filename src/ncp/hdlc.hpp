@@ -99,6 +99,31 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * This method writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * @param[in]  aBuf     A pointer to the bytes to write.
+     * @param[in]  aLength  The number of bytes to write.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write all the bytes (nothing is written).
+     *
+     */
+    otError WriteBytes(const uint8_t *aBuf, uint16_t aLength)
+    {
+        otError error = OT_ERROR_NO_BUFS;
+
+        if (CanWrite(aLength))
+        {
+            memcpy(mWritePointer, aBuf, aLength);
+            mWritePointer += aLength;
+            mRemainingLength -= aLength;
+            error = OT_ERROR_NONE;
+        }
+
+        return error;
+    }
+
     /**
      * This method undoes the last @p aUndoLength writes, removing them from frame.
      *
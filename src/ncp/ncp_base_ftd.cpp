@@ -883,7 +883,7 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ADDRESS_CACHE_
     otError         error = OT_ERROR_NONE;
     otEidCacheEntry entry;
 
-    for (uint8_t index = 0;; index++)
+    for (uint16_t index = 0;; index++)
     {
         SuccessOrExit(otThreadGetEidCacheEntry(mInstance, index, &entry));
 
@@ -895,7 +895,7 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_THREAD_ADDRESS_CACHE_
         SuccessOrExit(error = mEncoder.OpenStruct());
         SuccessOrExit(error = mEncoder.WriteIp6Address(entry.mTarget));
         SuccessOrExit(error = mEncoder.WriteUint16(entry.mRloc16));
-        SuccessOrExit(error = mEncoder.WriteUint8(entry.mAge));
+        SuccessOrExit(error = mEncoder.WriteUint8(entry.mAge < 0xff ? static_cast<uint8_t>(entry.mAge) : 0xff));
         SuccessOrExit(error = mEncoder.CloseStruct());
     }
 
@@ -87,8 +87,7 @@ void NcpFrameBuffer::Clear(void)
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     mReadMessage       = NULL;
-    mReadMessageOffset = 0;
-    mReadMessageTail   = mMessageBuffer;
+    mReadMessageLength = 0;
 
     // Free all messages in the queues.
 
@@ -624,8 +623,8 @@ exit:
 }
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-// This method prepares an associated message in current segment and fills the message buffer. It returns
-// ThreadError_NotFound if there is no message or if the message has no content.
+// This method prepares an associated message in current segment and points the read pointer to its first chunk. It
+// returns ThreadError_NotFound if there is no message or if the message has no content.
 otError NcpFrameBuffer::OutFramePrepareMessage(void)
 {
     otError  error = OT_ERROR_NONE;
@@ -643,11 +642,11 @@ otError NcpFrameBuffer::OutFramePrepareMessage(void)
 
     VerifyOrExit(mReadMessage != NULL, error = OT_ERROR_NOT_FOUND);
 
-    // Reset the offset for reading the message.
-    mReadMessageOffset = 0;
+    // Get the first chunk of the message content.
+    mReadMessageLength = otMessageGetLength(mReadMessage);
+    static_cast<Message *>(mReadMessage)->GetFirstChunk(0, mReadMessageLength, mReadMessageChunk);
 
-    // Fill the content from current message into the message buffer.
-    SuccessOrExit(error = OutFrameFillMessageBuffer());
+    SuccessOrExit(error = OutFrameReadMessageChunk());
 
     // If all successful, set the state to `InMessage`.
     mReadState = kReadStateInMessage;
@@ -656,33 +655,30 @@ exit:
     return error;
 }
 
-// This method fills content from current message into the message buffer. It returns OT_ERROR_NOT_FOUND if no more
+// This method sets the read pointer to the start of current message chunk. It returns OT_ERROR_NOT_FOUND if no more
 // content in the current message.
-otError NcpFrameBuffer::OutFrameFillMessageBuffer(void)
+otError NcpFrameBuffer::OutFrameReadMessageChunk(void)
 {
     otError error = OT_ERROR_NONE;
-    int     readLength;
 
-    VerifyOrExit(mReadMessage != NULL, error = OT_ERROR_NOT_FOUND);
-
-    VerifyOrExit(mReadMessageOffset < otMessageGetLength(mReadMessage), error = OT_ERROR_NOT_FOUND);
-
-    // Read portion of current message from the offset into message buffer.
-    readLength = otMessageRead(mReadMessage, mReadMessageOffset, mMessageBuffer, sizeof(mMessageBuffer));
-
-    VerifyOrExit(readLength > 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(mReadMessageChunk.GetLength() > 0, error = OT_ERROR_NOT_FOUND);
 
-    // Update the message offset, set up the message tail, and set read pointer to start of message buffer.
-
-    mReadMessageOffset += readLength;
-
-    mReadMessageTail = mMessageBuffer + readLength;
-
-    mReadPointer = mMessageBuffer;
+    mReadPointer = mReadMessageChunk.GetData();
 
 exit:
     return error;
 }
+
+// This method moves to the next chunk of current message, or to the next segment (if any) once the message is read.
+void NcpFrameBuffer::OutFrameMoveToNextMessageChunk(void)
+{
+    static_cast<Message *>(mReadMessage)->GetNextChunk(mReadMessageLength, mReadMessageChunk);
+
+    if (OutFrameReadMessageChunk() != OT_ERROR_NONE)
+    {
+        OutFramePrepareSegment();
+    }
+}
 #endif // #if OPENTHREAD_MTD || OPENTHREAD_FTD
 
 otError NcpFrameBuffer::OutFrameBegin(void)
@@ -760,17 +756,10 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
         retval = *mReadPointer;
         mReadPointer++;
 
-        // Check if at the end of content in message buffer.
-        if (mReadPointer == mReadMessageTail)
+        // Check if at the end of current message chunk.
+        if (mReadPointer == mReadMessageChunk.GetData() + mReadMessageChunk.GetLength())
         {
-            // Fill more bytes from current message into message buffer.
-            error = OutFrameFillMessageBuffer();
-
-            // If no more bytes in the message, move to next segment (if any).
-            if (error != OT_ERROR_NONE)
-            {
-                OutFramePrepareSegment();
-            }
+            OutFrameMoveToNextMessageChunk();
         }
 #endif
         break;
@@ -783,9 +772,34 @@ uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer
 {
     uint16_t bytesRead = 0;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && !OutFrameHasEnded())
     {
-        *aDataBuffer++ = OutFrameReadByte();
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+        if (mReadState == kReadStateInMessage)
+        {
+            // Copy the rest of current message chunk (or as much of it as fits) at once.
+            const uint8_t *chunkEnd = mReadMessageChunk.GetData() + mReadMessageChunk.GetLength();
+            uint16_t       length   = static_cast<uint16_t>(chunkEnd - mReadPointer);
+
+            if (length > aReadLength - bytesRead)
+            {
+                length = aReadLength - bytesRead;
+            }
+
+            memcpy(aDataBuffer + bytesRead, mReadPointer, length);
+            mReadPointer += length;
+            bytesRead += length;
+
+            if (mReadPointer == chunkEnd)
+            {
+                OutFrameMoveToNextMessageChunk();
+            }
+
+            continue;
+        }
+#endif
+
+        aDataBuffer[bytesRead++] = OutFrameReadByte();
     }
 
     return bytesRead;
@@ -37,6 +37,8 @@
 
 #include <openthread/message.h>
 
+#include "common/message.hpp"
+
 namespace ot {
 namespace Ncp {
 
@@ -452,7 +454,8 @@ private:
      * frame. The data segments are stored in the main buffer `mBuffer`. `mBuffer` is utilized as a circular buffer.
 
      * The content of messages (which are added using `InFrameFeedMessage()`) are not directly copied in the `mBuffer`
-     * but instead they are enqueued in a message queue `mMessageQueue`.
+     * but instead they are enqueued in a message queue `mMessageQueue`. When reading an output frame, the message
+     * content is read in place from the message buffers, one chunk at a time, without copying it.
      *
      * Every data segments starts with a header before the data portion. The header is 2 bytes long with the following
      * format:
@@ -568,7 +571,6 @@ private:
     enum
     {
         kReadByteAfterFrameHasEnded = 0,      // Value returned by ReadByte() when frame has ended.
-        kMessageReadBufferSize      = 16,     // Size of message buffer array `mMessageBuffer`.
         kUnknownFrameLength         = 0xffff, // Value used when frame length is unknown.
         kSegmentHeaderSize          = 2,      // Length of the segment header.
         kSegmentHeaderLengthMask    = 0x3fff, // Bit mask to get the length from the segment header
@@ -617,7 +619,8 @@ private:
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otError OutFramePrepareMessage(void);
-    otError OutFrameFillMessageBuffer(void);
+    otError OutFrameReadMessageChunk(void);
+    void    OutFrameMoveToNextMessageChunk(void);
 #endif
 
     uint8_t *const mBuffer;       // Pointer to the buffer used to store the data.
@@ -642,15 +645,14 @@ private:
     uint8_t *mReadFrameStart[kNumPrios]; // Pointer to start of current frame being read.
     uint8_t *mReadSegmentHead;           // Pointer to start of current segment in the frame being read.
     uint8_t *mReadSegmentTail;           // Pointer to end of current segment in the frame being read.
-    uint8_t *mReadPointer;               // Pointer to next byte to read (either in segment or in msg buffer).
+    uint8_t *mReadPointer;               // Pointer to next byte to read (either in segment or in msg chunk).
 
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
-    otMessageQueue mWriteFrameMessageQueue;                // Message queue for the current frame being written.
-    otMessageQueue mMessageQueue[kNumPrios];               // Main message queues.
-    otMessage *    mReadMessage;                           // Current Message in the frame being read.
-    uint16_t       mReadMessageOffset;                     // Offset within current message being read.
-    uint8_t        mMessageBuffer[kMessageReadBufferSize]; // Buffer to hold part of current message being read.
-    uint8_t *      mReadMessageTail;                       // Pointer to end of current part in mMessageBuffer.
+    otMessageQueue         mWriteFrameMessageQueue;  // Message queue for the current frame being written.
+    otMessageQueue         mMessageQueue[kNumPrios]; // Main message queues.
+    otMessage *            mReadMessage;             // Current Message in the frame being read.
+    Message::WritableChunk mReadMessageChunk;        // Current chunk of message being read (within its buffers).
+    uint16_t               mReadMessageLength;       // Length of current message remaining after the chunk.
 #endif
 };
 
@@ -75,6 +75,17 @@
 #define OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE 128
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICING_ENABLE
+ *
+ * Define to 1 to compute the HDLC FCS four bytes at a time (slicing-by-4) when encoding or decoding a block of
+ * bytes. This uses 1.5 KB of additional lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICING_ENABLE
+#define OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICING_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
  *
@@ -51,3 +51,20 @@
 #ifndef OPENTHREAD_POSIX_APP_SOCKET_BASENAME
 #define OPENTHREAD_POSIX_APP_SOCKET_BASENAME "/tmp/openthread"
 #endif
+
+/**
+ * @def OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL
+ *
+ * Define as 1 to poll the mainloop file descriptors with epoll (and a timerfd for the timeout) instead of select().
+ *
+ * File descriptors stay registered with epoll between mainloop iterations, so the kernel only reports the ready ones
+ * instead of rescanning every descriptor on each wakeup. This is not used in virtual time simulation mode.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL
+#ifdef __linux__
+#define OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL 1
+#else
+#define OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL 0
+#endif
+#endif
@@ -441,6 +441,18 @@ void otSimRadioSpinelProcess(otInstance *aInstance, const struct Event *aEvent);
  */
 uint64_t otSysGetTime(void);
 
+/**
+ * This function removes a file descriptor from the mainloop before it is closed.
+ *
+ * The epoll based mainloop keeps file descriptors registered across iterations, so a driver which closes a file
+ * descriptor while the mainloop is running must call this first. Otherwise a new file descriptor reusing the same
+ * number would not be polled.
+ *
+ * @param[in]   aFd     The file descriptor about to be closed.
+ *
+ */
+void platformMainloopRemoveFd(int aFd);
+
 /**
  * This function initializes platform UDP driver.
  *
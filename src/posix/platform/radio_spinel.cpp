@@ -165,6 +165,12 @@ RadioSpinel::RadioSpinel(void)
     , mPropertyFormat(NULL)
     , mExpectedCommand(0)
     , mError(OT_ERROR_NONE)
+    , mBatchTids(0)
+    , mBatchCount(0)
+    , mBatchErrorIndex(0)
+    , mBatchError(OT_ERROR_NONE)
+    , mNextBatchCallback(NULL)
+    , mNextBatchContext(NULL)
     , mTransmitFrame(NULL)
     , mShortAddress(0)
     , mPanId(0xffff)
@@ -175,6 +181,7 @@ RadioSpinel::RadioSpinel(void)
     , mIsPromiscuous(false)
     , mIsReady(false)
     , mSupportsLogStream(false)
+    , mIsBatching(false)
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     , mDiagMode(false)
     , mDiagOutput(NULL)
@@ -433,6 +440,10 @@ void RadioSpinel::HandleResponse(const uint8_t *aBuffer, uint16_t aLength)
         FreeTid(mWaitingTid);
         mWaitingTid = 0;
     }
+    else if (mBatchTids & (1 << SPINEL_HEADER_GET_TID(header)))
+    {
+        HandleBatchResponse(SPINEL_HEADER_GET_TID(header), cmd, key, data, static_cast<uint16_t>(len));
+    }
     else if (mTxRadioTid == SPINEL_HEADER_GET_TID(header))
     {
         if (mState == kStateTransmitting)
@@ -508,6 +519,58 @@ exit:
     LogIfFail("Error processing result", mError);
 }
 
+void RadioSpinel::HandleBatchResponse(spinel_tid_t      aTid,
+                                      uint32_t          aCommand,
+                                      spinel_prop_key_t aKey,
+                                      const uint8_t *   aBuffer,
+                                      uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == SPINEL_PROP_LAST_STATUS)
+    {
+        spinel_status_t status;
+        spinel_ssize_t  unpacked = spinel_datatype_unpack(aBuffer, aLength, "i", &status);
+
+        VerifyOrExit(unpacked > 0, error = OT_ERROR_PARSE);
+        error = SpinelStatusToOtError(status);
+    }
+    else if (aKey != mBatchKeys[aTid] || aCommand != mBatchCommands[aTid])
+    {
+        error = OT_ERROR_DROP;
+    }
+
+exit:
+    LogIfFail("Error processing batched result", error);
+    CompleteBatchRequest(aTid, error);
+}
+
+void RadioSpinel::CompleteBatchRequest(spinel_tid_t aTid, otError aError)
+{
+    BatchCallback callback = mBatchCallbacks[aTid];
+
+    mBatchTids &= ~(1 << aTid);
+    FreeTid(aTid);
+    mBatchCallbacks[aTid] = NULL;
+
+    LatchBatchError(mBatchIndexes[aTid], aError);
+
+    if (callback != NULL)
+    {
+        callback(mBatchContexts[aTid], aError);
+    }
+}
+
+void RadioSpinel::LatchBatchError(uint16_t aIndex, otError aError)
+{
+    // Responses may arrive in any order, keep the error of the earliest request rather than the earliest response.
+    if (aError != OT_ERROR_NONE && (mBatchError == OT_ERROR_NONE || aIndex < mBatchErrorIndex))
+    {
+        mBatchError      = aError;
+        mBatchErrorIndex = aIndex;
+    }
+}
+
 void RadioSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
 {
     otError error = OT_ERROR_NONE;
@@ -805,7 +868,7 @@ otError RadioSpinel::SetShortAddress(uint16_t aAddress)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(mShortAddress != aAddress);
-    SuccessOrExit(error = sRadioSpinel.Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
+    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, aAddress));
     mShortAddress = aAddress;
 
 exit:
@@ -855,6 +918,92 @@ otError RadioSpinel::AddSrcMatchExtEntry(const otExtAddress &aExtAddress)
     return Insert(SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES, SPINEL_DATATYPE_EUI64_S, aExtAddress.m8);
 }
 
+otError RadioSpinel::AddSrcMatchShortEntries(const uint16_t *aShortAddresses, uint8_t aNumEntries, uint8_t &aNumAdded)
+{
+    return AddSrcMatchEntries(/* aShortAddress */ true, aShortAddresses, aNumEntries, aNumAdded);
+}
+
+otError RadioSpinel::AddSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint8_t aNumEntries, uint8_t &aNumAdded)
+{
+    return AddSrcMatchEntries(/* aShortAddress */ false, aExtAddresses, aNumEntries, aNumAdded);
+}
+
+otError RadioSpinel::AddSrcMatchEntries(bool        aShortAddress,
+                                        const void *aEntries,
+                                        uint8_t     aNumEntries,
+                                        uint8_t &   aNumAdded)
+{
+    otError error = OT_ERROR_NONE;
+
+    aNumAdded = 0;
+
+    while (error == OT_ERROR_NONE && aNumAdded < aNumEntries)
+    {
+        otError results[kMaxSrcMatchBurst];
+        uint8_t count = aNumEntries - aNumAdded;
+        uint8_t added = 0;
+
+        if (count > kMaxSrcMatchBurst)
+        {
+            count = kMaxSrcMatchBurst;
+        }
+
+        BeginBatch();
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            results[i] = OT_ERROR_NONE;
+            SetBatchCallback(HandleSrcMatchResult, &results[i]);
+            UpdateSrcMatchEntry(/* aAdd */ true, aShortAddress, aEntries, aNumAdded + i);
+        }
+
+        error = EndBatch();
+
+        while (added < count && results[added] == OT_ERROR_NONE)
+        {
+            added++;
+        }
+
+        // Only the leading entries are reported as added, so take back any later entry the transceiver accepted.
+        for (uint8_t i = added + 1; i < count; i++)
+        {
+            if (results[i] == OT_ERROR_NONE)
+            {
+                IgnoreReturnValue(UpdateSrcMatchEntry(/* aAdd */ false, aShortAddress, aEntries, aNumAdded + i));
+            }
+        }
+
+        aNumAdded += added;
+    }
+
+    return error;
+}
+
+otError RadioSpinel::UpdateSrcMatchEntry(bool aAdd, bool aShortAddress, const void *aEntries, uint8_t aIndex)
+{
+    otError error;
+
+    if (aShortAddress)
+    {
+        uint16_t shortAddress = static_cast<const uint16_t *>(aEntries)[aIndex];
+
+        error = aAdd ? AddSrcMatchShortEntry(shortAddress) : ClearSrcMatchShortEntry(shortAddress);
+    }
+    else
+    {
+        const otExtAddress &extAddress = static_cast<const otExtAddress *>(aEntries)[aIndex];
+
+        error = aAdd ? AddSrcMatchExtEntry(extAddress) : ClearSrcMatchExtEntry(extAddress);
+    }
+
+    return error;
+}
+
+void RadioSpinel::HandleSrcMatchResult(void *aContext, otError aError)
+{
+    *static_cast<otError *>(aContext) = aError;
+}
+
 otError RadioSpinel::ClearSrcMatchShortEntry(const uint16_t aShortAddress)
 {
     return Remove(SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES, SPINEL_DATATYPE_UINT16_S, aShortAddress);
@@ -905,9 +1054,13 @@ otError RadioSpinel::EnergyScan(uint8_t aScanChannel, uint16_t aScanDuration)
 
     VerifyOrExit(mRadioCaps & OT_RADIO_CAPS_ENERGY_SCAN, error = OT_ERROR_NOT_CAPABLE);
 
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_MASK, SPINEL_DATATYPE_DATA_S, &aScanChannel, sizeof(uint8_t)));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_PERIOD, SPINEL_DATATYPE_UINT16_S, aScanDuration));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_SCAN_STATE, SPINEL_DATATYPE_UINT8_S, SPINEL_SCAN_STATE_ENERGY));
+    BeginBatch();
+    Set(SPINEL_PROP_MAC_SCAN_MASK, SPINEL_DATATYPE_DATA_S, &aScanChannel, sizeof(uint8_t));
+    Set(SPINEL_PROP_MAC_SCAN_PERIOD, SPINEL_DATATYPE_UINT16_S, aScanDuration);
+    SuccessOrExit(error = EndBatch());
+
+    // The scan is only started once the RCP has taken the channel and duration.
+    error = Set(SPINEL_PROP_MAC_SCAN_STATE, SPINEL_DATATYPE_UINT8_S, SPINEL_SCAN_STATE_ENERGY);
 
 exit:
     return error;
@@ -994,8 +1147,7 @@ otError RadioSpinel::WaitResponse(void)
             break;
 
         case OT_SIM_EVENT_ALARM_FIRED:
-            FreeTid(mWaitingTid);
-            mWaitingTid = 0;
+            FreeWaitingTids();
             ExitNow(mError = OT_ERROR_RESPONSE_TIMEOUT);
             break;
 
@@ -1034,8 +1186,7 @@ otError RadioSpinel::WaitResponse(void)
         }
         else if (rval == 0)
         {
-            FreeTid(mWaitingTid);
-            mWaitingTid = 0;
+            FreeWaitingTids();
             ExitNow(mError = OT_ERROR_RESPONSE_TIMEOUT);
         }
         else if (errno != EINTR)
@@ -1055,10 +1206,10 @@ otError RadioSpinel::WaitResponse(void)
         }
         else
         {
-            mWaitingTid = 0;
-            mError      = OT_ERROR_RESPONSE_TIMEOUT;
+            FreeWaitingTids();
+            mError = OT_ERROR_RESPONSE_TIMEOUT;
         }
-    } while (mWaitingTid || !mIsReady);
+    } while (mWaitingTid || mBatchTids || !mIsReady);
 
 exit:
     LogIfFail("Error waiting response", mError);
@@ -1067,6 +1218,61 @@ exit:
     return mError;
 }
 
+void RadioSpinel::FreeWaitingTids(void)
+{
+    FreeTid(mWaitingTid);
+    mWaitingTid = 0;
+
+    for (spinel_tid_t tid = 0; mBatchTids != 0; tid++)
+    {
+        if (mBatchTids & (1 << tid))
+        {
+            CompleteBatchRequest(tid, OT_ERROR_RESPONSE_TIMEOUT);
+        }
+    }
+}
+
+otError RadioSpinel::WaitBatchResponses(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (mBatchTids != 0)
+    {
+        mError = OT_ERROR_NONE;
+        error  = WaitResponse();
+    }
+
+    return error;
+}
+
+void RadioSpinel::BeginBatch(void)
+{
+    assert(!mIsBatching);
+
+    mIsBatching = true;
+    mBatchCount = 0;
+    mBatchError = OT_ERROR_NONE;
+}
+
+void RadioSpinel::SetBatchCallback(BatchCallback aCallback, void *aContext)
+{
+    assert(mIsBatching);
+
+    mNextBatchCallback = aCallback;
+    mNextBatchContext  = aContext;
+}
+
+otError RadioSpinel::EndBatch(void)
+{
+    assert(mIsBatching);
+
+    LatchBatchError(mBatchCount, WaitBatchResponses());
+    mIsBatching        = false;
+    mNextBatchCallback = NULL;
+
+    return mBatchError;
+}
+
 spinel_tid_t RadioSpinel::GetNextTid(void)
 {
     spinel_tid_t tid = 0;
@@ -1184,9 +1390,28 @@ exit:
 
 otError RadioSpinel::RequestV(bool aWait, uint32_t command, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs)
 {
-    otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = (aWait ? GetNextTid() : 0);
+    otError       error    = OT_ERROR_NONE;
+    bool          batch    = aWait && mIsBatching && (mPropertyFormat == NULL) && (aKey != SPINEL_PROP_STREAM_RAW);
+    BatchCallback callback = NULL;
+    void *        context  = NULL;
+    uint16_t      index    = 0;
+    spinel_tid_t  tid;
+
+    if (batch)
+    {
+        callback           = mNextBatchCallback;
+        context            = mNextBatchContext;
+        index              = mBatchCount++;
+        mNextBatchCallback = NULL;
+    }
+
+    if (batch && ((1 << mCmdNextTid) & mCmdTidsInUse))
+    {
+        // All transaction ids are in flight, wait for the batched responses before sending more.
+        SuccessOrExit(error = WaitBatchResponses());
+    }
 
+    tid = (aWait ? GetNextTid() : 0);
     VerifyOrExit(!aWait || tid > 0, error = OT_ERROR_BUSY);
 
     error = SendCommand(command, aKey, tid, aFormat, aArgs);
@@ -1199,6 +1424,15 @@ otError RadioSpinel::RequestV(bool aWait, uint32_t command, spinel_prop_key_t aK
         VerifyOrExit(mTxRadioTid == 0, error = OT_ERROR_BUSY);
         mTxRadioTid = tid;
     }
+    else if (batch)
+    {
+        mBatchTids |= (1 << tid);
+        mBatchKeys[tid]      = aKey;
+        mBatchCommands[tid]  = mExpectedCommand;
+        mBatchIndexes[tid]   = index;
+        mBatchCallbacks[tid] = callback;
+        mBatchContexts[tid]  = context;
+    }
     else if (aWait)
     {
         mWaitingKey = aKey;
@@ -1207,6 +1441,16 @@ otError RadioSpinel::RequestV(bool aWait, uint32_t command, spinel_prop_key_t aK
     }
 
 exit:
+    if (batch && error != OT_ERROR_NONE)
+    {
+        LatchBatchError(index, error);
+
+        if (callback != NULL)
+        {
+            callback(context, error);
+        }
+    }
+
     return error;
 }
 
@@ -1285,19 +1529,22 @@ otError RadioSpinel::Receive(uint8_t aChannel)
 
     VerifyOrExit(mState != kStateDisabled, error = OT_ERROR_INVALID_STATE);
 
+    BeginBatch();
+
     if (mChannel != aChannel)
     {
-        error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
-        VerifyOrExit(error == OT_ERROR_NONE);
-        mChannel = aChannel;
+        Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
     }
 
     if (mState == kStateSleep)
     {
-        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
-        VerifyOrExit(error == OT_ERROR_NONE);
+        Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
     }
 
+    error = EndBatch();
+    VerifyOrExit(error == OT_ERROR_NONE);
+    mChannel = aChannel;
+
     if (mTxRadioTid != 0)
     {
         FreeTid(mTxRadioTid);
@@ -1318,7 +1565,7 @@ otError RadioSpinel::Sleep(void)
     switch (mState)
     {
     case kStateReceive:
-        error = sRadioSpinel.Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
+        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
         VerifyOrExit(error == OT_ERROR_NONE);
 
         mState = kStateSleep;
@@ -1344,9 +1591,11 @@ otError RadioSpinel::Enable(otInstance *aInstance)
 
     mInstance = aInstance;
 
-    SuccessOrExit(error = Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId));
-    SuccessOrExit(error = Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress));
+    BeginBatch();
+    Set(SPINEL_PROP_PHY_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+    Set(SPINEL_PROP_MAC_15_4_PANID, SPINEL_DATATYPE_UINT16_S, mPanId);
+    Set(SPINEL_PROP_MAC_15_4_SADDR, SPINEL_DATATYPE_UINT16_S, mShortAddress);
+    SuccessOrExit(error = EndBatch());
     SuccessOrExit(error = Get(SPINEL_PROP_PHY_RX_SENSITIVITY, SPINEL_DATATYPE_INT8_S, &mRxSensitivity));
 
     mState = kStateSleep;
@@ -1574,6 +1823,57 @@ otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress
     return sRadioSpinel.AddSrcMatchExtEntry(addr);
 }
 
+otError otPlatRadioAddSrcMatchShortEntries(otInstance *          aInstance,
+                                           const otShortAddress *aShortAddresses,
+                                           uint8_t               aNumEntries,
+                                           uint8_t *             aNumAdded)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.AddSrcMatchShortEntries(aShortAddresses, aNumEntries, *aNumAdded);
+}
+
+otError otPlatRadioAddSrcMatchExtEntries(otInstance *        aInstance,
+                                         const otExtAddress *aExtAddresses,
+                                         uint8_t             aNumEntries,
+                                         uint8_t *           aNumAdded)
+{
+    enum
+    {
+        kMaxEntriesPerCall = 16,
+    };
+
+    otError      error = OT_ERROR_NONE;
+    otExtAddress addrs[kMaxEntriesPerCall];
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    *aNumAdded = 0;
+
+    while (error == OT_ERROR_NONE && *aNumAdded < aNumEntries)
+    {
+        uint8_t count = aNumEntries - *aNumAdded;
+        uint8_t added;
+
+        if (count > kMaxEntriesPerCall)
+        {
+            count = kMaxEntriesPerCall;
+        }
+
+        for (uint8_t entry = 0; entry < count; entry++)
+        {
+            for (size_t i = 0; i < sizeof(otExtAddress); i++)
+            {
+                addrs[entry].m8[i] = aExtAddresses[*aNumAdded + entry].m8[sizeof(otExtAddress) - 1 - i];
+            }
+        }
+
+        error = sRadioSpinel.AddSrcMatchExtEntries(addrs, count, added);
+        *aNumAdded += added;
+    }
+
+    return error;
+}
+
 otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, uint16_t aShortAddress)
 {
     OT_UNUSED_VARIABLE(aInstance);
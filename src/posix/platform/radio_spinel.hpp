@@ -232,6 +232,23 @@ public:
      */
     otError AddSrcMatchShortEntry(const uint16_t aShortAddress);
 
+    /**
+     * This method adds short addresses to the source address match table in one burst.
+     *
+     * The entries are written in batches, so the table costs about one round trip per batch instead of one per entry.
+     *
+     * @param[in]   aShortAddresses  A pointer to the short addresses to be added.
+     * @param[in]   aNumEntries      The number of short addresses in @p aShortAddresses.
+     * @param[out]  aNumAdded        The number of leading entries that were added.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all short addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     *
+     */
+    otError AddSrcMatchShortEntries(const uint16_t *aShortAddresses, uint8_t aNumEntries, uint8_t &aNumAdded);
+
     /**
      * This method removes a short address from the source address match table.
      *
@@ -270,6 +287,23 @@ public:
      */
     otError AddSrcMatchExtEntry(const otExtAddress &aExtAddress);
 
+    /**
+     * This method adds extended addresses to the source address match table in one burst.
+     *
+     * The entries are written in batches, so the table costs about one round trip per batch instead of one per entry.
+     *
+     * @param[in]   aExtAddresses  A pointer to the extended addresses to be added stored in little-endian byte order.
+     * @param[in]   aNumEntries    The number of extended addresses in @p aExtAddresses.
+     * @param[out]  aNumAdded      The number of leading entries that were added.
+     *
+     * @retval  OT_ERROR_NONE               Successfully added all extended addresses to the source match table.
+     * @retval  OT_ERROR_BUSY               Failed due to another operation is on going.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  OT_ERROR_NO_BUFS            No available entry in the source match table.
+     *
+     */
+    otError AddSrcMatchExtEntries(const otExtAddress *aExtAddresses, uint8_t aNumEntries, uint8_t &aNumAdded);
+
     /**
      * Remove an extended address from the source address match table.
      *
@@ -363,6 +397,47 @@ public:
      */
     otError Disable(void);
 
+    /**
+     * This method starts a batch of property updates.
+     *
+     * Until `EndBatch()` is called, property set, insert and remove requests are sent without waiting for their
+     * responses. Up to all free transaction ids are kept in flight at the same time, so a burst of updates costs about
+     * one round trip to the transceiver instead of one per update.
+     *
+     */
+    void BeginBatch(void);
+
+    /**
+     * This function pointer is called when a batched request completes.
+     *
+     * @param[in]  aContext  A pointer to the context given to `SetBatchCallback()`.
+     * @param[in]  aError    The result of the request, OT_ERROR_RESPONSE_TIMEOUT if its response did not arrive.
+     *
+     */
+    typedef void (*BatchCallback)(void *aContext, otError aError);
+
+    /**
+     * This method sets the completion callback of the next request sent in the current batch.
+     *
+     * The callback is called exactly once, while `EndBatch()` or a later request of the batch waits for responses, or
+     * right away if the request could not be sent. It must not send requests to the transceiver.
+     *
+     * @param[in]  aCallback  A pointer to the function called with the result of the request.
+     * @param[in]  aContext   A pointer to application-specific context.
+     *
+     */
+    void SetBatchCallback(BatchCallback aCallback, void *aContext);
+
+    /**
+     * This method ends a batch of property updates and waits for all of its responses.
+     *
+     * @retval  OT_ERROR_NONE               All requests in the batch succeeded.
+     * @retval  OT_ERROR_RESPONSE_TIMEOUT   Failed due to no response received from the transceiver.
+     * @retval  ...                         The error of the first request in the batch which failed.
+     *
+     */
+    otError EndBatch(void);
+
     /**
      * This method checks whether radio is enabled or not.
      *
@@ -464,6 +539,8 @@ private:
     enum
     {
         kMaxSpinelFrame        = HdlcInterface::kMaxFrameSize,
+        kMaxTids               = SPINEL_HEADER_TID_MASK + 1,
+        kMaxSrcMatchBurst      = kMaxTids - 1,
         kMaxWaitTime           = 2000, ///< Max time to wait for response in milliseconds.
         kVersionStringSize     = 128,  ///< Max size of version string.
         kCapsBufferSize        = 100,  ///< Max buffer size used to store `SPINEL_PROP_CAPS` value.
@@ -547,6 +624,14 @@ private:
     otError RequestV(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, va_list aArgs);
     otError Request(bool aWait, uint32_t aCommand, spinel_prop_key_t aKey, const char *aFormat, ...);
     otError WaitResponse(void);
+    otError WaitBatchResponses(void);
+    void    CompleteBatchRequest(spinel_tid_t aTid, otError aError);
+    void    LatchBatchError(uint16_t aIndex, otError aError);
+    void    FreeWaitingTids(void);
+    otError AddSrcMatchEntries(bool aShortAddress, const void *aEntries, uint8_t aNumEntries, uint8_t &aNumAdded);
+    otError UpdateSrcMatchEntry(bool aAdd, bool aShortAddress, const void *aEntries, uint8_t aIndex);
+
+    static void HandleSrcMatchResult(void *aContext, otError aError);
     otError SendReset(void);
     otError SendCommand(uint32_t          command,
                         spinel_prop_key_t key,
@@ -568,7 +653,7 @@ private:
      */
     bool IsSafeToHandleNow(spinel_prop_key_t aKey) const
     {
-        return !((mHdlcInterface.IsDecoding() || mWaitingKey != SPINEL_PROP_LAST_STATUS) &&
+        return !((mHdlcInterface.IsDecoding() || mWaitingKey != SPINEL_PROP_LAST_STATUS || mBatchTids != 0) &&
                  (aKey == SPINEL_PROP_STREAM_RAW || aKey == SPINEL_PROP_MAC_ENERGY_SCAN_RESULT));
     }
 
@@ -579,6 +664,11 @@ private:
     void HandleResponse(const uint8_t *aBuffer, uint16_t aLength);
     void HandleTransmitDone(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
     void HandleWaitingResponse(uint32_t aCommand, spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength);
+    void HandleBatchResponse(spinel_tid_t      aTid,
+                             uint32_t          aCommand,
+                             spinel_prop_key_t aKey,
+                             const uint8_t *   aBuffer,
+                             uint16_t          aLength);
 
     void RadioReceive(void);
     void RadioTransmit(void);
@@ -597,6 +687,18 @@ private:
     uint32_t          mExpectedCommand; ///< Expected response command of current transaction.
     otError           mError;           ///< The result of current transaction.
 
+    uint16_t          mBatchTids;                ///< The transaction ids of batched requests in flight.
+    uint16_t          mBatchCount;               ///< The number of requests sent in the current batch.
+    uint16_t          mBatchErrorIndex;          ///< The position in the batch of the request `mBatchError` is for.
+    otError           mBatchError;               ///< The error of the first failed request in the batch.
+    uint16_t          mBatchIndexes[kMaxTids];   ///< The position in the batch of each batched request.
+    uint32_t          mBatchCommands[kMaxTids];  ///< Expected response command of each batched request.
+    spinel_prop_key_t mBatchKeys[kMaxTids];      ///< The property key of each batched request.
+    BatchCallback     mBatchCallbacks[kMaxTids]; ///< Completion callback of each batched request.
+    void *            mBatchContexts[kMaxTids];  ///< Completion callback context of each batched request.
+    BatchCallback     mNextBatchCallback;        ///< Completion callback of the next batched request.
+    void *            mNextBatchContext;         ///< Completion callback context of the next batched request.
+
     uint8_t       mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
     uint8_t       mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
@@ -618,6 +720,7 @@ private:
     bool  mIsPromiscuous : 1;     ///< Promiscuous mode.
     bool  mIsReady : 1;           ///< NCP ready.
     bool  mSupportsLogStream : 1; ///< RCP supports `LOG_STREAM` property with OpenThread log meta-data format.
+    bool  mIsBatching : 1;        ///< Property updates are being batched.
 
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
     bool   mDiagMode;
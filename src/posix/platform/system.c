@@ -38,18 +38,27 @@
 #include <assert.h>
 #include <getopt.h>
 #include <libgen.h>
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif
 
 #include <openthread-core-config.h>
 #include <openthread/tasklet.h>
 #include <openthread/platform/alarm-milli.h>
 #include <openthread/platform/radio.h>
 
+#include "code_utils.h"
 #include "openthread-system.h"
+#include "common/code_utils.hpp"
 
 static const struct option kOptions[] = {
     {"dry-run", no_argument, NULL, 'n'},          {"no-reset", no_argument, NULL, 0},
@@ -58,6 +67,364 @@ static const struct option kOptions[] = {
 
 uint64_t gNodeId = 0;
 
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+enum
+{
+    kMaxEpollEvents = 16, ///< Max number of epoll events handled per mainloop iteration.
+};
+
+static int      sEpollFd          = -1;
+static int      sTimerFd          = -1;
+static bool     sTimerArmed       = false;
+static int      sNumRegisteredFds = 0;
+static int      sRegisteredFds[FD_SETSIZE];    ///< The file descriptors with non-zero registered events.
+static uint32_t sRegisteredEvents[FD_SETSIZE]; ///< The epoll events each file descriptor is registered with.
+static fd_set   sUnpollableFdSet;              ///< File descriptors epoll does not support (e.g. regular files).
+
+static void epollInit(void)
+{
+    struct epoll_event event;
+
+    sEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(sEpollFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    sTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrDie(sTimerFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    memset(&event, 0, sizeof(event));
+    event.events  = EPOLLIN;
+    event.data.fd = sTimerFd;
+    VerifyOrDie(epoll_ctl(sEpollFd, EPOLL_CTL_ADD, sTimerFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+
+    FD_ZERO(&sUnpollableFdSet);
+}
+
+static void epollDeinit(void)
+{
+    if (sTimerFd != -1)
+    {
+        close(sTimerFd);
+        sTimerFd = -1;
+    }
+
+    if (sEpollFd != -1)
+    {
+        close(sEpollFd);
+        sEpollFd = -1;
+    }
+
+    memset(sRegisteredEvents, 0, sizeof(sRegisteredEvents));
+    sNumRegisteredFds = 0;
+    sTimerArmed       = false;
+}
+
+/**
+ * This function adds or removes a file descriptor from the list of registered file descriptors.
+ *
+ * Removal moves the last entry into the freed one, so the list may be walked backwards while updating it.
+ *
+ * @param[in]  aFd      The file descriptor.
+ * @param[in]  aEvents  The epoll events @p aFd is about to be registered with.
+ *
+ */
+static void epollUpdateFdList(int aFd, uint32_t aEvents)
+{
+    if (sRegisteredEvents[aFd] == 0 && aEvents != 0)
+    {
+        sRegisteredFds[sNumRegisteredFds++] = aFd;
+    }
+    else if (sRegisteredEvents[aFd] != 0 && aEvents == 0)
+    {
+        for (int i = 0; i < sNumRegisteredFds; i++)
+        {
+            if (sRegisteredFds[i] == aFd)
+            {
+                sRegisteredFds[i] = sRegisteredFds[--sNumRegisteredFds];
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * This function returns the epoll events the mainloop context wants a file descriptor polled for.
+ *
+ * @param[in]  aMainloop  A pointer to the mainloop context.
+ * @param[in]  aFd        The file descriptor.
+ *
+ * @returns The epoll events wanted for @p aFd, 0 if none.
+ *
+ */
+static uint32_t epollWantedEvents(const otSysMainloopContext *aMainloop, int aFd)
+{
+    uint32_t wanted = 0;
+
+    if (aFd <= aMainloop->mMaxFd)
+    {
+        wanted |= FD_ISSET(aFd, &aMainloop->mReadFdSet) ? EPOLLIN : 0;
+        wanted |= FD_ISSET(aFd, &aMainloop->mWriteFdSet) ? EPOLLOUT : 0;
+        wanted |= FD_ISSET(aFd, &aMainloop->mErrorFdSet) ? EPOLLPRI : 0;
+    }
+
+    return wanted;
+}
+
+/**
+ * This function arms the timerfd with the mainloop timeout, or disarms it.
+ *
+ * @param[in]  aTimeout  A pointer to the timeout, or NULL to disarm the timer.
+ *
+ */
+static void epollSetTimer(const struct timeval *aTimeout)
+{
+    struct itimerspec timerSpec;
+
+    otEXPECT(aTimeout != NULL || sTimerArmed);
+
+    memset(&timerSpec, 0, sizeof(timerSpec));
+
+    if (aTimeout != NULL)
+    {
+        timerSpec.it_value.tv_sec  = aTimeout->tv_sec;
+        timerSpec.it_value.tv_nsec = aTimeout->tv_usec * NS_PER_US;
+    }
+
+    VerifyOrDie(timerfd_settime(sTimerFd, 0, &timerSpec, NULL) == 0, OT_EXIT_ERROR_ERRNO);
+    sTimerArmed = (aTimeout != NULL);
+
+exit:
+    return;
+}
+
+/**
+ * This function updates the epoll registration of a file descriptor.
+ *
+ * @param[in]  aFd      The file descriptor.
+ * @param[in]  aEvents  The epoll events to poll @p aFd for, 0 to stop polling it.
+ *
+ */
+static void epollUpdateFd(int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+    int                op;
+
+    otEXPECT(sRegisteredEvents[aFd] != aEvents);
+
+    epollUpdateFdList(aFd, aEvents);
+
+    if (FD_ISSET(aFd, &sUnpollableFdSet))
+    {
+        if (aEvents == 0)
+        {
+            FD_CLR(aFd, &sUnpollableFdSet);
+        }
+
+        sRegisteredEvents[aFd] = aEvents;
+        otEXIT_NOW();
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    if (aEvents == 0)
+    {
+        // The file descriptor may already have been closed, which removes it from the epoll set.
+        epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, &event);
+    }
+    else
+    {
+        op = (sRegisteredEvents[aFd] == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+
+        if (epoll_ctl(sEpollFd, op, aFd, &event) != 0)
+        {
+            if (errno == EPERM)
+            {
+                // Regular files are always ready and cannot be added to an epoll set.
+                FD_SET(aFd, &sUnpollableFdSet);
+            }
+            else
+            {
+                op = (op == EPOLL_CTL_ADD) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+                VerifyOrDie(epoll_ctl(sEpollFd, op, aFd, &event) == 0, OT_EXIT_ERROR_ERRNO);
+            }
+        }
+    }
+
+    sRegisteredEvents[aFd] = aEvents;
+
+exit:
+    return;
+}
+
+/**
+ * This function registers the file descriptors the mainloop context added since the last poll.
+ *
+ * The file descriptor sets are scanned a word at a time, so only words with bits set cost a per-descriptor check.
+ *
+ * @param[in]  aMainloop  A pointer to the mainloop context.
+ *
+ */
+static void epollAddNewFds(const otSysMainloopContext *aMainloop)
+{
+    enum
+    {
+        kBitsPerWord = sizeof(unsigned long) * CHAR_BIT,
+        kNumWords    = sizeof(fd_set) / sizeof(unsigned long),
+    };
+
+    unsigned long readWords[kNumWords];
+    unsigned long writeWords[kNumWords];
+    unsigned long errorWords[kNumWords];
+
+    // Linux lays out `fd_set` as an array of `long` with descriptor N at bit (N % bits) of word (N / bits).
+    memcpy(readWords, &aMainloop->mReadFdSet, sizeof(readWords));
+    memcpy(writeWords, &aMainloop->mWriteFdSet, sizeof(writeWords));
+    memcpy(errorWords, &aMainloop->mErrorFdSet, sizeof(errorWords));
+
+    for (int word = 0; word <= aMainloop->mMaxFd / kBitsPerWord; word++)
+    {
+        unsigned long bits = readWords[word] | writeWords[word] | errorWords[word];
+
+        for (int bit = 0; bits != 0; bit++, bits >>= 1)
+        {
+            int fd = word * kBitsPerWord + bit;
+
+            if ((bits & 1) && fd <= aMainloop->mMaxFd && sRegisteredEvents[fd] == 0)
+            {
+                epollUpdateFd(fd, epollWantedEvents(aMainloop, fd));
+            }
+        }
+    }
+}
+
+/**
+ * This function polls the file descriptors in the mainloop context using epoll.
+ *
+ * The file descriptor sets are updated the same way select() would do it.
+ *
+ * @param[inout]  aMainloop  A pointer to the mainloop context.
+ *
+ * @returns The number of ready file descriptors, or -1 on error.
+ *
+ */
+static int epollPoll(otSysMainloopContext *aMainloop)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                timeout = -1;
+    int                count;
+    int                rval = 0;
+
+    // Walk backwards, removing an entry moves the last (already updated) one into its place.
+    for (int i = sNumRegisteredFds - 1; i >= 0; i--)
+    {
+        int fd = sRegisteredFds[i];
+
+        epollUpdateFd(fd, epollWantedEvents(aMainloop, fd));
+    }
+
+    epollAddNewFds(aMainloop);
+
+    for (int i = 0; i < sNumRegisteredFds; i++)
+    {
+        int fd = sRegisteredFds[i];
+
+        if (FD_ISSET(fd, &sUnpollableFdSet) && (sRegisteredEvents[fd] & (EPOLLIN | EPOLLOUT)))
+        {
+            timeout = 0;
+        }
+    }
+
+    if (!timerisset(&aMainloop->mTimeout))
+    {
+        timeout = 0;
+    }
+
+    // Use a timerfd instead of the epoll_wait() timeout to keep microsecond resolution. A stale expiration
+    // left armed from an earlier iteration would wake a later epoll_wait() early, so disarm it when unused.
+    epollSetTimer((timeout != 0) ? &aMainloop->mTimeout : NULL);
+
+    count = epoll_wait(sEpollFd, events, kMaxEpollEvents, timeout);
+    otEXPECT_ACTION(count >= 0, rval = -1);
+
+    FD_ZERO(&aMainloop->mReadFdSet);
+    FD_ZERO(&aMainloop->mWriteFdSet);
+    FD_ZERO(&aMainloop->mErrorFdSet);
+
+    for (int i = 0; i < count; i++)
+    {
+        int      fd         = events[i].data.fd;
+        uint32_t registered = 0;
+
+        if (fd == sTimerFd)
+        {
+            uint64_t expirations;
+
+            IgnoreReturnValue(read(sTimerFd, &expirations, sizeof(expirations)));
+            sTimerArmed = false;
+            continue;
+        }
+
+        registered = sRegisteredEvents[fd];
+
+        // Like select(), report errors and hang-ups as readable/writable so the driver's read/write sees them.
+        if ((registered & EPOLLIN) && (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+        {
+            FD_SET(fd, &aMainloop->mReadFdSet);
+            rval++;
+        }
+
+        if ((registered & EPOLLOUT) && (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)))
+        {
+            FD_SET(fd, &aMainloop->mWriteFdSet);
+            rval++;
+        }
+
+        if ((registered & EPOLLPRI) && (events[i].events & EPOLLPRI))
+        {
+            FD_SET(fd, &aMainloop->mErrorFdSet);
+            rval++;
+        }
+    }
+
+    for (int i = 0; i < sNumRegisteredFds; i++)
+    {
+        int fd = sRegisteredFds[i];
+
+        if (FD_ISSET(fd, &sUnpollableFdSet))
+        {
+            if (sRegisteredEvents[fd] & EPOLLIN)
+            {
+                FD_SET(fd, &aMainloop->mReadFdSet);
+                rval++;
+            }
+
+            if (sRegisteredEvents[fd] & EPOLLOUT)
+            {
+                FD_SET(fd, &aMainloop->mWriteFdSet);
+                rval++;
+            }
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void platformMainloopRemoveFd(int aFd)
+{
+    if (sEpollFd != -1 && aFd >= 0 && aFd < FD_SETSIZE)
+    {
+        epollUpdateFd(aFd, 0);
+    }
+}
+#else  // OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+void platformMainloopRemoveFd(int aFd)
+{
+    OT_UNUSED_VARIABLE(aFd);
+}
+#endif // OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+
 static void PrintUsage(const char *aProgramName, FILE *aStream, int aExitCode)
 {
     fprintf(aStream,
@@ -151,6 +518,9 @@ otInstance *otSysInit(int aArgCount, char *aArgVector[])
     otSimInit();
 #endif
     platformAlarmInit(speedUpFactor);
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+    epollInit();
+#endif
     platformRadioInit(radioFile, radioConfig, reset);
     platformRandomInit();
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE && OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE == 0
@@ -186,6 +556,9 @@ void otSysDeinit(void)
     otSimDeinit();
 #endif
     platformRadioDeinit();
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+    epollDeinit();
+#endif
 }
 
 #if OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -283,8 +656,12 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop)
     else
 #endif
     {
+#if OPENTHREAD_CONFIG_POSIX_APP_ENABLE_EPOLL && !OPENTHREAD_POSIX_VIRTUAL_TIME
+        rval = epollPoll(aMainloop);
+#else
         rval = select(aMainloop->mMaxFd + 1, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                       &aMainloop->mTimeout);
+#endif
     }
 
     return rval;
@@ -0,0 +1,925 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the tests and the latency benchmark of the batched requests of the spinel radio driver.
+ *
+ *   Without arguments, the tests run against a fake transceiver, which is this program started with `--fake-rcp`.
+ *   The fake holds its responses until the host is idle and then sends them in reverse order.
+ *
+ *   With `--benchmark <radio-file> [radio-config]`, the startup and property update latencies are measured against a
+ *   real transceiver, e.g. the simulated `ot-rcp` of the posix example platform.
+ *
+ */
+
+#include "openthread-core-config.h"
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <openthread/platform/diag.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/radio.h>
+
+#include "radio_spinel.hpp"
+#include "common/code_utils.hpp"
+#include "ncp/hdlc.hpp"
+#include "ncp/spinel.h"
+
+using ot::PosixApp::HdlcInterface;
+using ot::PosixApp::RadioSpinel;
+
+enum
+{
+    kFakePanIdFailure      = 0xdead, ///< PAN ID rejected with `SPINEL_STATUS_FAILURE`.
+    kFakeShortAddressError = 0xdead, ///< Short address rejected with `SPINEL_STATUS_INVALID_ARGUMENT`.
+    kFakePanIdMute         = 0xbeef, ///< PAN ID which mutes the fake until the host has been idle a while.
+    kFakePanIdNotify       = 0xface, ///< PAN ID answered after a received frame notification.
+    kFakeScanPeriodFailure = 0xdead, ///< Scan period rejected with `SPINEL_STATUS_FAILURE`.
+    kFakeSrcMatchSize      = 8,      ///< Number of entries of each source match table of the fake.
+    kFakeMaxPending        = 64,     ///< Max number of responses held by the fake.
+    kFakeFlushDelay        = 10,     ///< Host idle time in milliseconds before the fake sends its responses.
+    kFakeMuteTime          = 500,    ///< Host idle time in milliseconds before the fake is no longer muted.
+    kFakeMaxFrame          = 256,
+    kTestChannel           = 11,
+};
+
+static const uint8_t kTestPsdu[] = {0x41, 0xd8, 0x01, 0xce, 0xfa, 0xff, 0xff, 0x34, 0x12, 0x00, 0x00};
+
+static RadioSpinel sRadio;
+
+uint64_t gNodeId = 1;
+
+/*
+ * The fake transceiver.
+ */
+
+typedef ot::Hdlc::FrameBuffer<HdlcInterface::kMaxFrameSize> FakeFrameBuffer;
+
+struct FakeFrame
+{
+    uint8_t  mBuffer[kFakeMaxFrame];
+    uint16_t mLength;
+};
+
+static FakeFrameBuffer sFakeRxBuffer;
+
+static FakeFrame sFakePending[kFakeMaxPending];
+static uint8_t   sFakeNumPending;
+static uint8_t   sFakeMaxInFlight;
+static uint8_t   sFakeNumShortEntries;
+static uint8_t   sFakeNumExtEntries;
+static bool      sFakeIsMuted;
+
+static void FakeWrite(const uint8_t *aFrame, uint16_t aLength)
+{
+    FakeFrameBuffer   encoderBuffer;
+    ot::Hdlc::Encoder encoder(encoderBuffer);
+    const uint8_t *   data;
+    uint16_t          length;
+
+    SuccessOrDie(encoder.BeginFrame());
+    SuccessOrDie(encoder.Encode(aFrame, aLength));
+    SuccessOrDie(encoder.EndFrame());
+
+    data   = encoderBuffer.GetFrame();
+    length = encoderBuffer.GetLength();
+
+    while (length > 0)
+    {
+        ssize_t rval = write(STDOUT_FILENO, data, length);
+
+        VerifyOrDie(rval > 0 || errno == EINTR || errno == EAGAIN, OT_EXIT_ERROR_ERRNO);
+
+        if (rval > 0)
+        {
+            data += rval;
+            length -= static_cast<uint16_t>(rval);
+        }
+    }
+}
+
+static void FakeFlush(void)
+{
+    // Answer in reverse order, the host must not depend on the order of responses.
+    while (sFakeNumPending > 0)
+    {
+        sFakeNumPending--;
+        FakeWrite(sFakePending[sFakeNumPending].mBuffer, sFakePending[sFakeNumPending].mLength);
+    }
+}
+
+static uint16_t FakePackFrame(uint8_t *      aFrame,
+                              uint8_t        aTid,
+                              unsigned int   aCommand,
+                              unsigned int   aKey,
+                              const uint8_t *aValue,
+                              spinel_size_t  aValueLength)
+{
+    spinel_ssize_t packed;
+
+    packed = spinel_datatype_pack(aFrame, kFakeMaxFrame, "Cii", SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0 | aTid,
+                                  aCommand, aKey);
+    VerifyOrDie(packed > 0 && static_cast<size_t>(packed) + aValueLength <= kFakeMaxFrame, OT_EXIT_FAILURE);
+
+    if (aValueLength > 0)
+    {
+        memcpy(aFrame + packed, aValue, aValueLength);
+    }
+
+    return static_cast<uint16_t>(packed + aValueLength);
+}
+
+static void FakeRespond(uint8_t        aTid,
+                        unsigned int   aCommand,
+                        unsigned int   aKey,
+                        const uint8_t *aValue,
+                        spinel_size_t  aLength)
+{
+    FakeFrame &frame = sFakePending[sFakeNumPending];
+
+    frame.mLength = FakePackFrame(frame.mBuffer, aTid, aCommand, aKey, aValue, aLength);
+
+    if (++sFakeNumPending > sFakeMaxInFlight)
+    {
+        sFakeMaxInFlight = sFakeNumPending;
+    }
+
+    if (sFakeNumPending == kFakeMaxPending)
+    {
+        FakeFlush();
+    }
+}
+
+static void FakeRespondStatus(uint8_t aTid, spinel_status_t aStatus)
+{
+    uint8_t        value[8];
+    spinel_ssize_t packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UINT_PACKED_S, aStatus);
+
+    FakeRespond(aTid, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_LAST_STATUS, value, static_cast<spinel_size_t>(packed));
+}
+
+static void FakeNotify(unsigned int aKey, const uint8_t *aValue, spinel_size_t aLength)
+{
+    uint8_t frame[kFakeMaxFrame];
+
+    FakeWrite(frame, FakePackFrame(frame, 0, SPINEL_CMD_PROP_VALUE_IS, aKey, aValue, aLength));
+}
+
+static void FakeNotifyReceivedFrame(void)
+{
+    uint8_t        value[kFakeMaxFrame];
+    spinel_ssize_t packed;
+
+    packed = spinel_datatype_pack(
+        value, sizeof(value),
+        SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_UINT16_S
+            SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_UINT64_S)
+                SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_UINT_PACKED_S),
+        kTestPsdu, static_cast<unsigned int>(sizeof(kTestPsdu)), -40, -100, 0, kTestChannel, 255,
+        static_cast<uint64_t>(0), OT_ERROR_NONE);
+    VerifyOrDie(packed > 0, OT_EXIT_FAILURE);
+
+    FakeNotify(SPINEL_PROP_STREAM_RAW, value, static_cast<spinel_size_t>(packed));
+}
+
+static void FakeNotifyEnergyScanResult(void)
+{
+    uint8_t        value[kFakeMaxFrame];
+    spinel_ssize_t packed;
+
+    packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UINT8_S SPINEL_DATATYPE_INT8_S, kTestChannel,
+                                  -60);
+    VerifyOrDie(packed > 0, OT_EXIT_FAILURE);
+
+    FakeNotify(SPINEL_PROP_MAC_ENERGY_SCAN_RESULT, value, static_cast<spinel_size_t>(packed));
+}
+
+static void FakeHandleGet(uint8_t aTid, unsigned int aKey)
+{
+    uint8_t        value[kFakeMaxFrame];
+    spinel_ssize_t packed = -1;
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_PROTOCOL_VERSION:
+        packed = spinel_datatype_pack(value, sizeof(value), "ii", SPINEL_PROTOCOL_VERSION_THREAD_MAJOR,
+                                      SPINEL_PROTOCOL_VERSION_THREAD_MINOR);
+        break;
+
+    case SPINEL_PROP_CAPS:
+        packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UINT_PACKED_S, SPINEL_CAP_MAC_RAW);
+        break;
+
+    case SPINEL_PROP_RADIO_CAPS:
+        packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UINT_PACKED_S,
+                                      OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_ENERGY_SCAN |
+                                          OT_RADIO_CAPS_TRANSMIT_RETRIES | OT_RADIO_CAPS_CSMA_BACKOFF);
+        break;
+
+    case SPINEL_PROP_NCP_VERSION:
+        packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UTF8_S, "FAKE-RCP");
+        break;
+
+    case SPINEL_PROP_HWADDR:
+        packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_UINT64_S, static_cast<uint64_t>(1));
+        break;
+
+    case SPINEL_PROP_PHY_RX_SENSITIVITY:
+        packed = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_INT8_S, -100);
+        break;
+
+    case SPINEL_PROP_PHY_TX_POWER:
+        // Reports the max number of requests in flight since the previous report.
+        packed           = spinel_datatype_pack(value, sizeof(value), SPINEL_DATATYPE_INT8_S, sFakeMaxInFlight);
+        sFakeMaxInFlight = 0;
+        break;
+
+    default:
+        break;
+    }
+
+    if (packed > 0)
+    {
+        FakeRespond(aTid, SPINEL_CMD_PROP_VALUE_IS, aKey, value, static_cast<spinel_size_t>(packed));
+    }
+    else
+    {
+        FakeRespondStatus(aTid, SPINEL_STATUS_PROP_NOT_FOUND);
+    }
+}
+
+static void FakeHandleSet(uint8_t aTid, unsigned int aKey, const uint8_t *aValue, spinel_size_t aLength)
+{
+    uint16_t value = 0;
+
+    IgnoreReturnValue(spinel_datatype_unpack(aValue, aLength, SPINEL_DATATYPE_UINT16_S, &value));
+
+    if ((aKey == SPINEL_PROP_MAC_15_4_PANID && value == kFakePanIdFailure) ||
+        (aKey == SPINEL_PROP_MAC_SCAN_PERIOD && value == kFakeScanPeriodFailure))
+    {
+        FakeRespondStatus(aTid, SPINEL_STATUS_FAILURE);
+    }
+    else if (aKey == SPINEL_PROP_MAC_15_4_SADDR && value == kFakeShortAddressError)
+    {
+        FakeRespondStatus(aTid, SPINEL_STATUS_INVALID_ARGUMENT);
+    }
+    else if (aKey == SPINEL_PROP_MAC_15_4_PANID && value == kFakePanIdMute)
+    {
+        sFakeIsMuted = true;
+    }
+    else
+    {
+        if (aKey == SPINEL_PROP_MAC_15_4_PANID && value == kFakePanIdNotify)
+        {
+            FakeNotifyReceivedFrame();
+        }
+        else if (aKey == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES)
+        {
+            sFakeNumShortEntries = 0;
+        }
+        else if (aKey == SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES)
+        {
+            sFakeNumExtEntries = 0;
+        }
+        else if (aKey == SPINEL_PROP_MAC_SCAN_STATE)
+        {
+            // The scan completes right away.
+            FakeNotifyEnergyScanResult();
+        }
+
+        FakeRespond(aTid, SPINEL_CMD_PROP_VALUE_IS, aKey, aValue, aLength);
+    }
+}
+
+static void FakeHandleInsert(uint8_t aTid, unsigned int aKey, const uint8_t *aValue, spinel_size_t aLength)
+{
+    uint8_t *numEntries = NULL;
+
+    if (aKey == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES)
+    {
+        numEntries = &sFakeNumShortEntries;
+    }
+    else if (aKey == SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES)
+    {
+        numEntries = &sFakeNumExtEntries;
+    }
+
+    if (numEntries == NULL)
+    {
+        FakeRespondStatus(aTid, SPINEL_STATUS_PROP_NOT_FOUND);
+    }
+    else if (*numEntries == kFakeSrcMatchSize)
+    {
+        FakeRespondStatus(aTid, SPINEL_STATUS_NOMEM);
+    }
+    else
+    {
+        (*numEntries)++;
+        FakeRespond(aTid, SPINEL_CMD_PROP_VALUE_INSERTED, aKey, aValue, aLength);
+    }
+}
+
+static void FakeHandleRemove(uint8_t aTid, unsigned int aKey, const uint8_t *aValue, spinel_size_t aLength)
+{
+    if (aKey == SPINEL_PROP_MAC_SRC_MATCH_SHORT_ADDRESSES && sFakeNumShortEntries > 0)
+    {
+        sFakeNumShortEntries--;
+    }
+    else if (aKey == SPINEL_PROP_MAC_SRC_MATCH_EXTENDED_ADDRESSES && sFakeNumExtEntries > 0)
+    {
+        sFakeNumExtEntries--;
+    }
+
+    FakeRespond(aTid, SPINEL_CMD_PROP_VALUE_REMOVED, aKey, aValue, aLength);
+}
+
+static void FakeHandleFrame(void *aContext, otError aError)
+{
+    const uint8_t *frame  = sFakeRxBuffer.GetFrame();
+    uint16_t       length = sFakeRxBuffer.GetLength();
+    uint8_t        header;
+    unsigned int   command;
+    unsigned int   key;
+    const uint8_t *value;
+    spinel_size_t  valueLength;
+    uint8_t        tid;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    VerifyOrExit(aError == OT_ERROR_NONE);
+    VerifyOrExit(spinel_datatype_unpack(frame, length, "Ci", &header, &command) > 0);
+
+    if (command == SPINEL_CMD_RESET)
+    {
+        uint8_t        status[8];
+        spinel_ssize_t packed =
+            spinel_datatype_pack(status, sizeof(status), SPINEL_DATATYPE_UINT_PACKED_S, SPINEL_STATUS_RESET_SOFTWARE);
+
+        sFakeNumPending      = 0;
+        sFakeNumShortEntries = 0;
+        sFakeNumExtEntries   = 0;
+        FakeNotify(SPINEL_PROP_LAST_STATUS, status, static_cast<spinel_size_t>(packed));
+        ExitNow();
+    }
+
+    VerifyOrExit(!sFakeIsMuted);
+    VerifyOrExit(spinel_datatype_unpack(frame, length, "CiiD", &header, &command, &key, &value, &valueLength) > 0);
+    tid = SPINEL_HEADER_GET_TID(header);
+
+    switch (command)
+    {
+    case SPINEL_CMD_PROP_VALUE_GET:
+        FakeHandleGet(tid, key);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_SET:
+        FakeHandleSet(tid, key, value, valueLength);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_INSERT:
+        FakeHandleInsert(tid, key, value, valueLength);
+        break;
+
+    case SPINEL_CMD_PROP_VALUE_REMOVE:
+        FakeHandleRemove(tid, key, value, valueLength);
+        break;
+
+    default:
+        FakeRespondStatus(tid, SPINEL_STATUS_INVALID_COMMAND);
+        break;
+    }
+
+exit:
+    sFakeRxBuffer.Clear();
+}
+
+static int RunFakeRcp(void)
+{
+    ot::Hdlc::Decoder decoder(sFakeRxBuffer, FakeHandleFrame, NULL);
+
+    while (true)
+    {
+        uint8_t        buffer[HdlcInterface::kMaxFrameSize];
+        fd_set         readFds;
+        struct timeval timeout = {0, 0};
+        int            rval;
+
+        FD_ZERO(&readFds);
+        FD_SET(STDIN_FILENO, &readFds);
+
+        if (sFakeNumPending > 0)
+        {
+            timeout.tv_usec = kFakeFlushDelay * 1000;
+        }
+        else if (sFakeIsMuted)
+        {
+            timeout.tv_usec = kFakeMuteTime * 1000;
+        }
+
+        rval = select(STDIN_FILENO + 1, &readFds, NULL, NULL,
+                      (sFakeNumPending > 0 || sFakeIsMuted) ? &timeout : NULL);
+
+        if (rval == 0)
+        {
+            FakeFlush();
+            sFakeIsMuted = false;
+        }
+        else if (rval > 0)
+        {
+            ssize_t length = read(STDIN_FILENO, buffer, sizeof(buffer));
+
+            if (length == 0 || (length < 0 && errno != EINTR && errno != EAGAIN))
+            {
+                break;
+            }
+
+            if (length > 0)
+            {
+                decoder.Decode(buffer, static_cast<uint16_t>(length));
+            }
+        }
+        else if (errno != EINTR)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * The platform and callbacks used by the radio driver.
+ */
+
+uint64_t otSysGetTime(void)
+{
+    struct timespec now;
+
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0, OT_EXIT_ERROR_ERRNO);
+
+    return static_cast<uint64_t>(now.tv_sec) * US_PER_S + static_cast<uint64_t>(now.tv_nsec) / NS_PER_US;
+}
+
+const char *otExitCodeToString(uint8_t aExitCode)
+{
+    OT_UNUSED_VARIABLE(aExitCode);
+    return "SELF_TEST";
+}
+
+extern "C" const char *otThreadErrorToString(otError aError)
+{
+    OT_UNUSED_VARIABLE(aError);
+    return "SELF_TEST";
+}
+
+extern "C" void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+    OT_UNUSED_VARIABLE(aFormat);
+}
+
+static uint32_t sNumReceived;
+
+extern "C" void otPlatRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    assert(aError == OT_ERROR_NONE);
+    assert(aFrame->mLength == sizeof(kTestPsdu));
+    assert(memcmp(aFrame->mPsdu, kTestPsdu, sizeof(kTestPsdu)) == 0);
+    sNumReceived++;
+}
+
+extern "C" void otPlatRadioTxStarted(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aFrame);
+}
+
+extern "C" void otPlatRadioTxDone(otInstance *aInstance, otRadioFrame *aFrame, otRadioFrame *aAckFrame, otError aError)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aFrame);
+    OT_UNUSED_VARIABLE(aAckFrame);
+    OT_UNUSED_VARIABLE(aError);
+}
+
+static uint32_t sNumEnergyScans;
+
+extern "C" void otPlatRadioEnergyScanDone(otInstance *aInstance, int8_t aEnergyScanMaxRssi)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aEnergyScanMaxRssi);
+
+    sNumEnergyScans++;
+}
+
+#if OPENTHREAD_CONFIG_DIAG_ENABLE
+extern "C" void otPlatDiagRadioReceiveDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aFrame);
+    OT_UNUSED_VARIABLE(aError);
+}
+
+extern "C" void otPlatDiagRadioTransmitDone(otInstance *aInstance, otRadioFrame *aFrame, otError aError)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aFrame);
+    OT_UNUSED_VARIABLE(aError);
+}
+#endif // OPENTHREAD_CONFIG_DIAG_ENABLE
+
+/*
+ * The tests.
+ */
+
+struct BatchResult
+{
+    otError mError;
+    uint8_t mNumCalls;
+};
+
+static void HandleBatchResult(void *aContext, otError aError)
+{
+    BatchResult *result = static_cast<BatchResult *>(aContext);
+
+    result->mError = aError;
+    result->mNumCalls++;
+}
+
+static int8_t GetMaxInFlight(void)
+{
+    int8_t maxInFlight;
+
+    assert(sRadio.GetTransmitPower(maxInFlight) == OT_ERROR_NONE);
+
+    return maxInFlight;
+}
+
+static void SetTransmitPowers(uint8_t aNumRequests)
+{
+    BatchResult results[40];
+
+    assert(aNumRequests <= OT_ARRAY_LENGTH(results));
+
+    memset(results, 0, sizeof(results));
+    sRadio.BeginBatch();
+
+    for (uint8_t i = 0; i < aNumRequests; i++)
+    {
+        sRadio.SetBatchCallback(HandleBatchResult, &results[i]);
+        assert(sRadio.SetTransmitPower(static_cast<int8_t>(i)) == OT_ERROR_NONE);
+    }
+
+    assert(sRadio.EndBatch() == OT_ERROR_NONE);
+
+    for (uint8_t i = 0; i < aNumRequests; i++)
+    {
+        assert(results[i].mNumCalls == 1);
+        assert(results[i].mError == OT_ERROR_NONE);
+    }
+}
+
+void TestTidExhaustion(void)
+{
+    int8_t maxInFlight;
+
+    GetMaxInFlight();
+
+    // More requests than transaction ids, the batch waits for responses to free some and goes on.
+    SetTransmitPowers(40);
+
+    maxInFlight = GetMaxInFlight();
+    assert(maxInFlight > 1);
+    assert(maxInFlight <= SPINEL_HEADER_TID_MASK);
+
+    printf("TID exhaustion: 40 batched requests with at most %d in flight\n", maxInFlight);
+}
+
+void TestFirstErrorLatch(void)
+{
+    BatchResult results[4];
+
+    memset(results, 0, sizeof(results));
+    sRadio.BeginBatch();
+    sRadio.SetBatchCallback(HandleBatchResult, &results[0]);
+    assert(sRadio.SetTransmitPower(1) == OT_ERROR_NONE);
+    sRadio.SetBatchCallback(HandleBatchResult, &results[1]);
+    assert(sRadio.SetShortAddress(kFakeShortAddressError) == OT_ERROR_NONE);
+    sRadio.SetBatchCallback(HandleBatchResult, &results[2]);
+    assert(sRadio.SetPanId(kFakePanIdFailure) == OT_ERROR_NONE);
+    sRadio.SetBatchCallback(HandleBatchResult, &results[3]);
+    assert(sRadio.SetTransmitPower(2) == OT_ERROR_NONE);
+
+    // The responses arrive in reverse order, the error of the earliest failed request is reported.
+    assert(sRadio.EndBatch() == OT_ERROR_INVALID_ARGS);
+
+    assert(results[0].mNumCalls == 1 && results[0].mError == OT_ERROR_NONE);
+    assert(results[1].mNumCalls == 1 && results[1].mError == OT_ERROR_INVALID_ARGS);
+    assert(results[2].mNumCalls == 1 && results[2].mError == OT_ERROR_FAILED);
+    assert(results[3].mNumCalls == 1 && results[3].mError == OT_ERROR_NONE);
+
+    // The next batch starts clean.
+    SetTransmitPowers(3);
+
+    printf("First error latch: OK\n");
+}
+
+void TestTimeout(void)
+{
+    BatchResult results[SPINEL_HEADER_TID_MASK];
+
+    memset(results, 0, sizeof(results));
+    sRadio.BeginBatch();
+
+    // The fake drops this request and every request after it, keeping all transaction ids in flight.
+    sRadio.SetBatchCallback(HandleBatchResult, &results[0]);
+    assert(sRadio.SetPanId(kFakePanIdMute) == OT_ERROR_NONE);
+
+    for (uint8_t i = 1; i < OT_ARRAY_LENGTH(results); i++)
+    {
+        sRadio.SetBatchCallback(HandleBatchResult, &results[i]);
+        assert(sRadio.SetTransmitPower(static_cast<int8_t>(i)) == OT_ERROR_NONE);
+    }
+
+    assert(sRadio.EndBatch() == OT_ERROR_RESPONSE_TIMEOUT);
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(results); i++)
+    {
+        assert(results[i].mNumCalls == 1);
+        assert(results[i].mError == OT_ERROR_RESPONSE_TIMEOUT);
+    }
+
+    // All transaction ids were released, so both single and batched requests go through again.
+    GetMaxInFlight();
+    SetTransmitPowers(40);
+    assert(GetMaxInFlight() > 1);
+
+    printf("Timeout: OK\n");
+}
+
+void TestNotificationReplay(void)
+{
+    fd_set readFds;
+    fd_set writeFds;
+
+    FD_ZERO(&readFds);
+    FD_ZERO(&writeFds);
+
+    assert(sRadio.Receive(kTestChannel) == OT_ERROR_NONE);
+
+    sNumReceived = 0;
+
+    // The fake sends a received frame before the response, it is saved while the batch waits.
+    sRadio.BeginBatch();
+    assert(sRadio.SetPanId(kFakePanIdNotify) == OT_ERROR_NONE);
+    assert(sRadio.SetTransmitPower(1) == OT_ERROR_NONE);
+    assert(sRadio.EndBatch() == OT_ERROR_NONE);
+    assert(sNumReceived == 0);
+
+    sRadio.Process(readFds, writeFds);
+    assert(sNumReceived == 1);
+
+    printf("Notification replay: OK\n");
+}
+
+void TestSrcMatchBurst(void)
+{
+    uint16_t     shortAddresses[kFakeSrcMatchSize + 4];
+    otExtAddress extAddresses[kFakeSrcMatchSize + 4];
+    uint8_t      numAdded;
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(shortAddresses); i++)
+    {
+        shortAddresses[i] = 0x1000 + i;
+        memset(extAddresses[i].m8, i, sizeof(extAddresses[i].m8));
+    }
+
+    assert(sRadio.ClearSrcMatchShortEntries() == OT_ERROR_NONE);
+    assert(sRadio.ClearSrcMatchExtEntries() == OT_ERROR_NONE);
+
+    assert(sRadio.AddSrcMatchShortEntries(shortAddresses, 4, numAdded) == OT_ERROR_NONE);
+    assert(numAdded == 4);
+
+    // The table fills up in the middle of the burst, only the leading entries are reported.
+    assert(sRadio.AddSrcMatchShortEntries(&shortAddresses[4], 8, numAdded) == OT_ERROR_NO_BUFS);
+    assert(numAdded == kFakeSrcMatchSize - 4);
+
+    GetMaxInFlight();
+    assert(sRadio.AddSrcMatchExtEntries(extAddresses, kFakeSrcMatchSize, numAdded) == OT_ERROR_NONE);
+    assert(numAdded == kFakeSrcMatchSize);
+    assert(GetMaxInFlight() == kFakeSrcMatchSize);
+
+    assert(sRadio.AddSrcMatchExtEntries(&extAddresses[kFakeSrcMatchSize], 1, numAdded) == OT_ERROR_NO_BUFS);
+    assert(numAdded == 0);
+
+    printf("Source match burst: OK\n");
+}
+
+void TestEnergyScan(void)
+{
+    fd_set readFds;
+    fd_set writeFds;
+
+    FD_ZERO(&readFds);
+    FD_ZERO(&writeFds);
+
+    sNumEnergyScans = 0;
+
+    // The scan is not started when the RCP rejects its parameters.
+    assert(sRadio.EnergyScan(kTestChannel, kFakeScanPeriodFailure) == OT_ERROR_FAILED);
+    sRadio.Process(readFds, writeFds);
+    assert(sNumEnergyScans == 0);
+
+    assert(sRadio.EnergyScan(kTestChannel, 100) == OT_ERROR_NONE);
+    sRadio.Process(readFds, writeFds);
+    assert(sNumEnergyScans == 1);
+
+    printf("Energy scan: OK\n");
+}
+
+static int RunTests(const char *aProgram)
+{
+    sRadio.Init(aProgram, "--fake-rcp", true);
+    assert(sRadio.Enable(NULL) == OT_ERROR_NONE);
+
+    TestTidExhaustion();
+    TestFirstErrorLatch();
+    TestTimeout();
+    TestNotificationReplay();
+    TestSrcMatchBurst();
+    TestEnergyScan();
+
+    sRadio.Deinit();
+
+    return 0;
+}
+
+/*
+ * The benchmark.
+ */
+
+enum
+{
+    kBenchmarkRounds     = 20,
+    kBenchmarkSrcEntries = 10,
+};
+
+static uint64_t sBenchmarkStart;
+
+static void BenchmarkStart(void)
+{
+    sBenchmarkStart = otSysGetTime();
+}
+
+static void BenchmarkReport(const char *aName, uint32_t aRounds)
+{
+    uint64_t elapsed = otSysGetTime() - sBenchmarkStart;
+
+    printf("%-40s %8.3f ms\n", aName, static_cast<double>(elapsed) / aRounds / 1000);
+}
+
+static void BringUp(uint16_t aRound)
+{
+    otExtAddress extAddress;
+
+    memset(extAddress.m8, static_cast<uint8_t>(aRound), sizeof(extAddress.m8));
+
+    assert(sRadio.SetPanId(0x1000 + aRound) == OT_ERROR_NONE);
+    assert(sRadio.SetShortAddress(0x2000 + aRound) == OT_ERROR_NONE);
+    assert(sRadio.SetExtendedAddress(extAddress) == OT_ERROR_NONE);
+    assert(sRadio.EnableSrcMatch(true) == OT_ERROR_NONE);
+    assert(sRadio.ClearSrcMatchShortEntries() == OT_ERROR_NONE);
+    assert(sRadio.ClearSrcMatchExtEntries() == OT_ERROR_NONE);
+}
+
+static int RunBenchmark(const char *aRadioFile, const char *aRadioConfig)
+{
+    uint16_t     shortAddresses[kBenchmarkSrcEntries];
+    otExtAddress extAddresses[kBenchmarkSrcEntries];
+    uint16_t     round = 0;
+    uint8_t      numAdded;
+
+    for (uint8_t i = 0; i < kBenchmarkSrcEntries; i++)
+    {
+        shortAddresses[i] = 0x3000 + i;
+        memset(extAddresses[i].m8, 0x30 + i, sizeof(extAddresses[i].m8));
+    }
+
+    BenchmarkStart();
+    sRadio.Init(aRadioFile, aRadioConfig, true);
+    assert(sRadio.Enable(NULL) == OT_ERROR_NONE);
+    assert(sRadio.Receive(kTestChannel) == OT_ERROR_NONE);
+    BenchmarkReport("startup (init, enable, receive)", 1);
+
+    BenchmarkStart();
+
+    for (uint16_t i = 0; i < kBenchmarkRounds; i++)
+    {
+        BringUp(round++);
+    }
+
+    BenchmarkReport("property bring-up, serial", kBenchmarkRounds);
+
+    BenchmarkStart();
+
+    for (uint16_t i = 0; i < kBenchmarkRounds; i++)
+    {
+        sRadio.BeginBatch();
+        BringUp(round++);
+        assert(sRadio.EndBatch() == OT_ERROR_NONE);
+    }
+
+    BenchmarkReport("property bring-up, batched", kBenchmarkRounds);
+
+    BenchmarkStart();
+
+    for (uint16_t i = 0; i < kBenchmarkRounds; i++)
+    {
+        assert(sRadio.ClearSrcMatchShortEntries() == OT_ERROR_NONE);
+        assert(sRadio.ClearSrcMatchExtEntries() == OT_ERROR_NONE);
+
+        for (uint8_t entry = 0; entry < kBenchmarkSrcEntries; entry++)
+        {
+            assert(sRadio.AddSrcMatchShortEntry(shortAddresses[entry]) == OT_ERROR_NONE);
+            assert(sRadio.AddSrcMatchExtEntry(extAddresses[entry]) == OT_ERROR_NONE);
+        }
+    }
+
+    BenchmarkReport("source match rewrite, one per entry", kBenchmarkRounds);
+
+    BenchmarkStart();
+
+    for (uint16_t i = 0; i < kBenchmarkRounds; i++)
+    {
+        assert(sRadio.ClearSrcMatchShortEntries() == OT_ERROR_NONE);
+        assert(sRadio.ClearSrcMatchExtEntries() == OT_ERROR_NONE);
+        assert(sRadio.AddSrcMatchShortEntries(shortAddresses, kBenchmarkSrcEntries, numAdded) == OT_ERROR_NONE);
+        assert(sRadio.AddSrcMatchExtEntries(extAddresses, kBenchmarkSrcEntries, numAdded) == OT_ERROR_NONE);
+    }
+
+    BenchmarkReport("source match rewrite, burst", kBenchmarkRounds);
+
+    // MAC keys are derived and kept on the host, switching the key sequence sends nothing to the transceiver.
+    printf("%-40s %8s\n", "key rotation", "no transceiver requests");
+
+    sRadio.Deinit();
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int rval;
+
+    if (argc > 1 && strcmp(argv[1], "--fake-rcp") == 0)
+    {
+        rval = RunFakeRcp();
+    }
+    else if (argc > 2 && strcmp(argv[1], "--benchmark") == 0)
+    {
+        rval = RunBenchmark(argv[2], (argc > 3) ? argv[3] : "");
+    }
+    else
+    {
+        rval = RunTests(argv[0]);
+    }
+
+    return rval;
+}
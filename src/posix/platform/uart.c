@@ -239,6 +239,7 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
 
     if (FD_ISSET(sSessionSocket, aErrorFdSet))
     {
+        platformMainloopRemoveFd(sSessionSocket);
         close(sSessionSocket);
         sSessionSocket = -1;
     }
@@ -277,6 +278,7 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
             {
                 perror("UART read");
             }
+            platformMainloopRemoveFd(sSessionSocket);
             close(sSessionSocket);
             sSessionSocket = -1;
             otEXIT_NOW();
@@ -298,6 +300,7 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
         {
 #if OPENTHREAD_ENABLE_POSIX_APP_DAEMON
             perror("UART write");
+            platformMainloopRemoveFd(sSessionSocket);
             close(sSessionSocket);
             sSessionSocket = -1;
             otEXIT_NOW();
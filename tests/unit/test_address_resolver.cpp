@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2018, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/address_resolver.hpp"
+
+namespace ot {
+
+enum
+{
+    kCacheEntries = OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES,
+};
+
+static Ip6::Address GetTestEid(uint32_t aIndex)
+{
+    Ip6::Address eid;
+
+    memset(&eid, 0, sizeof(eid));
+    eid.mFields.m16[0] = Encoding::BigEndian::HostSwap16(0xfd00);
+    eid.mFields.m16[1] = Encoding::BigEndian::HostSwap16(0x0db8);
+    eid.mFields.m32[2] = Encoding::BigEndian::HostSwap32(0x02000000 ^ (aIndex * 0x9e3779b1));
+    eid.mFields.m32[3] = Encoding::BigEndian::HostSwap32(aIndex);
+
+    return eid;
+}
+
+static uint16_t GetTestRloc16(uint32_t aIndex)
+{
+    return static_cast<uint16_t>(((aIndex % 62) << 10) | (1 + aIndex % 511));
+}
+
+static bool FindEntry(AddressResolver &aResolver, const Ip6::Address &aEid, otEidCacheEntry &aEntry)
+{
+    bool found = false;
+
+    for (uint16_t index = 0; aResolver.GetEntry(index, aEntry) == OT_ERROR_NONE; index++)
+    {
+        if (aEntry.mValid && static_cast<const Ip6::Address &>(aEntry.mTarget) == aEid)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void TestAddressCache(void)
+{
+    Instance *       instance = testInitInstance();
+    AddressResolver *resolver;
+    otEidCacheEntry  entry;
+    uint16_t         rloc16;
+
+    VerifyOrQuit(instance != NULL, "Null instance");
+    resolver = &instance->Get<AddressResolver>();
+
+    printf("TestAddressCache");
+
+    resolver->Clear();
+
+    // Snooping a frame that is not destined to this device only updates existing entries.
+    resolver->UpdateCacheEntry(GetTestEid(0), GetTestRloc16(0));
+    VerifyOrQuit(!FindEntry(*resolver, GetTestEid(0), entry), "UpdateCacheEntry() added an entry");
+
+    // Snoop a mapping for every entry, the cache is then full of snooped entries.
+    for (uint32_t i = 0; i < kCacheEntries; i++)
+    {
+        resolver->AddSnoopedCacheEntry(GetTestEid(i), GetTestRloc16(i));
+    }
+
+    for (uint32_t i = 0; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(FindEntry(*resolver, GetTestEid(i), entry), "snooped entry is missing");
+        VerifyOrQuit(entry.mRloc16 == GetTestRloc16(i), "snooped entry has incorrect RLOC16");
+    }
+
+    // Snooped entries are blocked from eviction by new snooped entries.
+    resolver->AddSnoopedCacheEntry(GetTestEid(kCacheEntries), GetTestRloc16(kCacheEntries));
+    VerifyOrQuit(!FindEntry(*resolver, GetTestEid(kCacheEntries), entry), "snooped entry evicted a blocked entry");
+
+    // Resolve hits every snooped entry, last resolved entry is the most recently used one.
+    for (uint32_t i = 0; i < kCacheEntries; i++)
+    {
+        VerifyOrQuit(resolver->Resolve(GetTestEid(i), rloc16) == OT_ERROR_NONE, "Resolve() failed");
+        VerifyOrQuit(rloc16 == GetTestRloc16(i), "Resolve() returned incorrect RLOC16");
+        VerifyOrQuit(FindEntry(*resolver, GetTestEid(i), entry), "resolved entry is missing");
+        VerifyOrQuit(entry.mAge == 0, "resolved entry is not the most recently used one");
+    }
+
+    VerifyOrQuit(FindEntry(*resolver, GetTestEid(0), entry), "resolved entry is missing");
+    VerifyOrQuit(entry.mAge == kCacheEntries - 1, "least recently used entry has incorrect age");
+
+    // Snooping never evicts a cached entry.
+    resolver->AddSnoopedCacheEntry(GetTestEid(kCacheEntries), GetTestRloc16(kCacheEntries));
+    VerifyOrQuit(!FindEntry(*resolver, GetTestEid(kCacheEntries), entry), "snooped entry evicted a cached entry");
+
+    // Snooping an existing entry updates its RLOC16.
+    resolver->UpdateCacheEntry(GetTestEid(0), 0x5801);
+    VerifyOrQuit(resolver->Resolve(GetTestEid(0), rloc16) == OT_ERROR_NONE, "Resolve() failed");
+    VerifyOrQuit(rloc16 == 0x5801, "snoop did not update the RLOC16");
+
+    resolver->Remove(static_cast<uint16_t>(0x5801));
+    VerifyOrQuit(!FindEntry(*resolver, GetTestEid(0), entry), "Remove(rloc16) failed");
+
+    resolver->Remove(static_cast<uint8_t>(GetTestRloc16(1) >> 10));
+    VerifyOrQuit(!FindEntry(*resolver, GetTestEid(1), entry), "Remove(routerId) failed");
+
+    // Removed entries are reused for new snooped entries.
+    resolver->AddSnoopedCacheEntry(GetTestEid(kCacheEntries), GetTestRloc16(kCacheEntries));
+    VerifyOrQuit(FindEntry(*resolver, GetTestEid(kCacheEntries), entry), "snooped entry not added to free entry");
+
+    for (uint32_t i = 2; i < kCacheEntries; i++)
+    {
+        if ((GetTestRloc16(i) >> 10) == (GetTestRloc16(1) >> 10))
+        {
+            continue;
+        }
+
+        VerifyOrQuit(resolver->Resolve(GetTestEid(i), rloc16) == OT_ERROR_NONE, "Resolve() failed");
+        VerifyOrQuit(rloc16 == GetTestRloc16(i), "Resolve() returned incorrect RLOC16");
+    }
+
+    resolver->Clear();
+    VerifyOrQuit(resolver->GetEntry(0, entry) == OT_ERROR_NONE, "GetEntry() failed");
+    VerifyOrQuit(!entry.mValid, "Clear() failed");
+    VerifyOrQuit(resolver->GetEntry(kCacheEntries, entry) == OT_ERROR_INVALID_ARGS, "GetEntry() accepted bad index");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestAddressCachePerformance(void)
+{
+    const uint32_t kCacheSizes[] = {32, 256, 1024};
+    const uint32_t kNumLookups   = 200000;
+
+    printf("TestAddressCachePerformance\n");
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(kCacheSizes); i++)
+    {
+        Instance *       instance = testInitInstance();
+        AddressResolver *resolver;
+        uint32_t         numEntries = kCacheSizes[i];
+        uint32_t         seed       = 1;
+        uint64_t         startTime;
+        uint64_t         duration;
+        uint16_t         rloc16;
+
+        VerifyOrQuit(instance != NULL, "Null instance");
+        resolver = &instance->Get<AddressResolver>();
+
+        if (numEntries > kCacheEntries)
+        {
+            numEntries = kCacheEntries;
+        }
+
+        for (uint32_t j = 0; j < numEntries; j++)
+        {
+            resolver->AddSnoopedCacheEntry(GetTestEid(j), GetTestRloc16(j));
+        }
+
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kNumLookups; j++)
+        {
+            uint32_t index;
+
+            seed  = seed * 1103515245 + 12345;
+            index = (seed >> 8) % numEntries;
+
+            VerifyOrQuit(resolver->Resolve(GetTestEid(index), rloc16) == OT_ERROR_NONE, "Resolve() failed");
+            VerifyOrQuit(rloc16 == GetTestRloc16(index), "Resolve() returned incorrect RLOC16");
+        }
+
+        duration = testGetHostTimeUsec() - startTime;
+
+        printf("  %4u entries: resolve %6.1f ns/lookup%s\n", numEntries, (duration * 1000.0) / kNumLookups,
+               numEntries < kCacheSizes[i] ? " (limited by OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES)" : "");
+
+        testFreeInstance(instance);
+    }
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestAddressCache();
+    ot::TestAddressCachePerformance();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
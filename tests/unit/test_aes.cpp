@@ -28,6 +28,9 @@
 
 #include <openthread/config.h>
 
+#include <mbedtls/ccm.h>
+
+#include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
 #include "utils/wrap_string.h"
@@ -56,11 +59,12 @@ void TestMacBeaconFrame(void)
                            0xAC, 0x02, 0x05, 0x00, 0x00, 0x00, 0x55, 0xCF, 0x00, 0x00, 0x51, 0x52,
                            0x53, 0x54, 0x22, 0x3B, 0xC1, 0xEC, 0x84, 0x1A, 0xB5, 0x53};
 
-    otInstance *       instance = testInitInstance();
-    ot::Crypto::AesCcm aesCcm;
-    uint32_t           headerLength  = sizeof(test) - 8;
-    uint32_t           payloadLength = 0;
-    uint8_t            tagLength     = 8;
+    otInstance *                    instance = testInitInstance();
+    ot::Crypto::KeyScheduleCache<1> keyScheduleCache;
+    ot::Crypto::AesCcm              aesCcm;
+    uint32_t                        headerLength  = sizeof(test) - 8;
+    uint32_t                        payloadLength = 0;
+    uint8_t                         tagLength     = 8;
 
     uint8_t nonce[] = {
         0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02,
@@ -68,7 +72,7 @@ void TestMacBeaconFrame(void)
 
     VerifyOrQuit(instance != NULL, "Null OpenThread instance");
 
-    aesCcm.SetKey(key, sizeof(key));
+    aesCcm.SetKey(key, sizeof(key), keyScheduleCache);
     aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
     aesCcm.Header(test, headerLength);
     aesCcm.Finalize(test + headerLength, &tagLength);
@@ -118,8 +122,10 @@ void TestMacCommandFrame()
         0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x06,
     };
 
-    ot::Crypto::AesCcm aesCcm;
-    aesCcm.SetKey(key, sizeof(key));
+    ot::Crypto::KeyScheduleCache<1> keyScheduleCache;
+    ot::Crypto::AesCcm              aesCcm;
+
+    aesCcm.SetKey(key, sizeof(key), keyScheduleCache);
     aesCcm.Init(headerLength, payloadLength, tagLength, nonce, sizeof(nonce));
     aesCcm.Header(test, headerLength);
     aesCcm.Payload(test + headerLength, test + headerLength, payloadLength, true);
@@ -134,11 +140,198 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed\n");
 }
 
+/**
+ * Verifies block-wise AES-CCM processing and the key schedule cache against mbedTLS CCM.
+ */
+void TestAesCcmAgainstMbedTls(void)
+{
+    enum
+    {
+        kNumKeys        = OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE + 2, // More keys than cache entries
+        kKeySize        = 16,
+        kNonceSize      = 13,
+        kTagSize        = 8,
+        kMaxHeaderSize  = 40,
+        kMaxPayloadSize = 127,
+    };
+
+    const uint32_t headerLengths[] = {0, 5, 16, 29, kMaxHeaderSize};
+    const uint32_t chunkLengths[]  = {1, 7, 16, kMaxPayloadSize};
+
+    uint8_t             keys[kNumKeys][kKeySize];
+    uint8_t             nonce[kNonceSize];
+    uint8_t             header[kMaxHeaderSize];
+    uint8_t             plainText[kMaxPayloadSize];
+    uint8_t             cipherText[kMaxPayloadSize];
+    uint8_t             expectedCipherText[kMaxPayloadSize];
+    uint8_t             tag[kTagSize];
+    uint8_t             expectedTag[kTagSize];
+    uint8_t             tagLength;
+    uint32_t            iteration = 0;
+    mbedtls_ccm_context ccm;
+
+    ot::Crypto::KeyScheduleCache<OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE> keyScheduleCache;
+
+    for (uint32_t i = 0; i < sizeof(keys); i++)
+    {
+        keys[i / kKeySize][i % kKeySize] = static_cast<uint8_t>(i * 13 + 5);
+    }
+
+    for (uint32_t i = 0; i < sizeof(nonce); i++)
+    {
+        nonce[i] = static_cast<uint8_t>(0xa0 + i);
+    }
+
+    for (uint32_t i = 0; i < sizeof(header); i++)
+    {
+        header[i] = static_cast<uint8_t>(i * 3 + 1);
+    }
+
+    for (uint32_t i = 0; i < sizeof(plainText); i++)
+    {
+        plainText[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    mbedtls_ccm_init(&ccm);
+
+    for (uint32_t payloadLength = 0; payloadLength <= kMaxPayloadSize; payloadLength += 9)
+    {
+        for (uint32_t h = 0; h < OT_ARRAY_LENGTH(headerLengths); h++)
+        {
+            for (uint32_t c = 0; c < OT_ARRAY_LENGTH(chunkLengths); c++)
+            {
+                const uint8_t *    key          = keys[iteration++ % kNumKeys];
+                uint32_t           headerLength = headerLengths[h];
+                ot::Crypto::AesCcm aesCcm;
+                ot::Crypto::AesCcm otherAesCcm;
+
+                VerifyOrQuit(mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, key, 8 * kKeySize) == 0,
+                             "mbedtls_ccm_setkey() failed");
+                VerifyOrQuit(mbedtls_ccm_encrypt_and_tag(&ccm, payloadLength, nonce, sizeof(nonce), header,
+                                                         headerLength, plainText, expectedCipherText, expectedTag,
+                                                         sizeof(expectedTag)) == 0,
+                             "mbedtls_ccm_encrypt_and_tag() failed");
+
+                // Encrypt, feeding header and payload in chunks.
+
+                aesCcm.SetKey(key, kKeySize, keyScheduleCache);
+                SuccessOrQuit(aesCcm.Init(headerLength, payloadLength, kTagSize, nonce, sizeof(nonce)),
+                              "AesCcm::Init() failed");
+
+                for (uint32_t offset = 0; offset < headerLength; offset += chunkLengths[c])
+                {
+                    uint32_t length = headerLength - offset;
+
+                    aesCcm.Header(header + offset, (length < chunkLengths[c]) ? length : chunkLengths[c]);
+                }
+
+                // Evict the key schedule used by `aesCcm` from the cache.
+                for (uint32_t k = 0; k < kNumKeys; k++)
+                {
+                    otherAesCcm.SetKey(keys[k], kKeySize, keyScheduleCache);
+                }
+
+                for (uint32_t offset = 0; offset < payloadLength; offset += chunkLengths[c])
+                {
+                    uint32_t length = payloadLength - offset;
+
+                    length = (length < chunkLengths[c]) ? length : chunkLengths[c];
+                    memcpy(cipherText + offset, plainText + offset, length);
+                    aesCcm.Payload(cipherText + offset, cipherText + offset, length, true);
+                }
+
+                aesCcm.Finalize(tag, &tagLength);
+
+                VerifyOrQuit(tagLength == kTagSize, "AesCcm::Finalize() returned wrong tag length");
+                VerifyOrQuit(memcmp(cipherText, expectedCipherText, payloadLength) == 0,
+                             "AesCcm encryption does not match mbedTLS");
+                VerifyOrQuit(memcmp(tag, expectedTag, kTagSize) == 0, "AesCcm tag does not match mbedTLS");
+
+                // Decrypt in one go.
+
+                aesCcm.SetKey(key, kKeySize, keyScheduleCache);
+                SuccessOrQuit(aesCcm.Init(headerLength, payloadLength, kTagSize, nonce, sizeof(nonce)),
+                              "AesCcm::Init() failed");
+                aesCcm.Header(header, headerLength);
+
+                // Clearing the key schedule cache does not affect objects with a key set.
+                keyScheduleCache.Clear();
+
+                aesCcm.Payload(cipherText, cipherText, payloadLength, false);
+                aesCcm.Finalize(tag, &tagLength);
+
+                VerifyOrQuit(memcmp(cipherText, plainText, payloadLength) == 0, "AesCcm decryption failed");
+                VerifyOrQuit(memcmp(tag, expectedTag, kTagSize) == 0, "AesCcm decryption tag is wrong");
+            }
+        }
+    }
+
+    mbedtls_ccm_free(&ccm);
+}
+
+/**
+ * Measures AES-CCM throughput on maximum sized IEEE 802.15.4 frames.
+ */
+void TestAesCcmPerformance(void)
+{
+    enum
+    {
+        kFrameSize     = 127,   // Maximum IEEE 802.15.4 frame size
+        kHeaderSize    = 15,    // MAC header with security header (short addresses, key id mode 1)
+        kTagSize       = 4,     // MIC-32
+        kFcsSize       = 2,     // FCS
+        kPerfIteration = 20000, // Number of frames processed in throughput test
+    };
+
+    const uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+    const uint8_t nonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+    };
+    const uint32_t payloadLength = kFrameSize - kHeaderSize - kTagSize - kFcsSize;
+
+    uint8_t  frame[kFrameSize];
+    uint8_t  tagLength;
+    uint64_t startTime;
+    uint64_t duration;
+
+    ot::Crypto::KeyScheduleCache<OPENTHREAD_CONFIG_AES_KEY_SCHEDULE_CACHE_SIZE> keyScheduleCache;
+
+    for (uint32_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        // Like `Mac`, set up a new `AesCcm` object with the key for every frame.
+        ot::Crypto::AesCcm aesCcm;
+
+        tagLength = kTagSize;
+        aesCcm.SetKey(key, sizeof(key), keyScheduleCache);
+        aesCcm.Init(kHeaderSize, payloadLength, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(frame, kHeaderSize);
+        aesCcm.Payload(frame + kHeaderSize, frame + kHeaderSize, payloadLength, true);
+        aesCcm.Finalize(frame + kHeaderSize + payloadLength, &tagLength);
+    }
+
+    duration = testGetHostTimeUsec() - startTime;
+
+    printf("  %u-byte frames: %6.2f usec/frame, %8.0f frames/sec (tag 0x%02x)\n", kFrameSize,
+           static_cast<double>(duration) / kPerfIteration, (kPerfIteration * 1000000.0) / duration,
+           frame[kHeaderSize + payloadLength]);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesCcmAgainstMbedTls();
+    TestAesCcmPerformance();
     printf("All tests passed\n");
     return 0;
 }
@@ -29,11 +29,18 @@
 #include "test_platform.h"
 
 #include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/thread.h>
 
 #include "test_util.h"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "net/udp6.hpp"
 #include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/mle_router.hpp"
 
 namespace ot {
 
@@ -340,8 +347,8 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i].mState);
-        child->SetRloc16(testChildList[i].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress));
 
         VerifyChildTableContent(*table, i + 1, testChildList);
     }
@@ -362,8 +369,8 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i - 1].mState);
-        child->SetRloc16(testChildList[i - 1].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i - 1].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress));
 
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
@@ -400,12 +407,616 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+static uint32_t sRandomSeed = 1;
+
+static uint32_t GetRandom(void)
+{
+    sRandomSeed = sRandomSeed * 1103515245 + 12345;
+
+    return sRandomSeed >> 8;
+}
+
+static void GenerateExtAddress(Mac::ExtAddress &aExtAddress)
+{
+    for (uint8_t i = 0; i < sizeof(aExtAddress.m8); i++)
+    {
+        aExtAddress.m8[i] = static_cast<uint8_t>(GetRandom());
+    }
+}
+
+// Picks a random RLOC16 not used by any child which is not invalid.
+static uint16_t GetUnusedRloc16(ChildTable &aTable)
+{
+    uint16_t rloc16;
+
+    do
+    {
+        rloc16 = 0x8000 + static_cast<uint16_t>(GetRandom() % (2 * aTable.GetMaxChildren())) + 1;
+    } while (aTable.FindChild(rloc16, ChildTable::kInStateAnyExceptInvalid) != NULL);
+
+    return rloc16;
+}
+
+// Finds a child by a linear scan of the table (the reference behavior for the indexed `FindChild()`).
+static Child *FindChildByScan(ChildTable &aTable, uint16_t aRloc16, ChildTable::StateFilter aFilter)
+{
+    Child *rval = NULL;
+
+    for (uint8_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = aTable.GetChildAtIndex(index);
+
+        if (StateMatchesFilter(child->GetState(), aFilter) && (child->GetRloc16() == aRloc16))
+        {
+            ExitNow(rval = child);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+static Child *FindChildByScan(ChildTable &aTable, const Mac::ExtAddress &aAddress, ChildTable::StateFilter aFilter)
+{
+    Child *rval = NULL;
+
+    for (uint8_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *child = aTable.GetChildAtIndex(index);
+
+        if (StateMatchesFilter(child->GetState(), aFilter) && (child->GetExtAddress() == aAddress))
+        {
+            ExitNow(rval = child);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+// Verifies that indexed lookups of all keys present in the table (and of absent ones) match a linear scan.
+static void VerifyIndexedLookups(ChildTable &aTable)
+{
+    const ChildTable::StateFilter filters[] = {
+        ChildTable::kInStateValid,
+        ChildTable::kInStateValidOrRestoring,
+        ChildTable::kInStateChildIdRequest,
+        ChildTable::kInStateValidOrAttaching,
+        ChildTable::kInStateAnyExceptInvalid,
+        ChildTable::kInStateAnyExceptValidOrRestoring,
+    };
+
+    for (uint8_t k = 0; k < OT_ARRAY_LENGTH(filters); k++)
+    {
+        for (uint8_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+        {
+            const Child &   child   = *aTable.GetChildAtIndex(index);
+            uint16_t        rloc16  = child.GetRloc16();
+            Mac::ExtAddress address = child.GetExtAddress();
+
+            VerifyOrQuit(aTable.FindChild(rloc16, filters[k]) == FindChildByScan(aTable, rloc16, filters[k]),
+                         "FindChild(rloc) does not match linear scan");
+            VerifyOrQuit(aTable.FindChild(address, filters[k]) == FindChildByScan(aTable, address, filters[k]),
+                         "FindChild(ExtAddress) does not match linear scan");
+
+            rloc16 ^= 0x0400;
+            address.m8[0] ^= 0xff;
+
+            VerifyOrQuit(aTable.FindChild(rloc16, filters[k]) == FindChildByScan(aTable, rloc16, filters[k]),
+                         "FindChild(rloc) does not match linear scan for absent key");
+            VerifyOrQuit(aTable.FindChild(address, filters[k]) == FindChildByScan(aTable, address, filters[k]),
+                         "FindChild(ExtAddress) does not match linear scan for absent key");
+        }
+    }
+}
+
+void TestChildTableIndex(void)
+{
+    const Child::State states[] = {
+        Child::kStateValid,          Child::kStateRestored,           Child::kStateParentRequest,
+        Child::kStateChildIdRequest, Child::kStateChildUpdateRequest, Child::kStateParentResponse,
+    };
+
+    ChildTable *table;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable index consistency with %d entries", table->GetMaxChildren());
+
+    // Fill the table, using child IDs which collide in the RLOC16 index.
+
+    for (uint8_t i = 0; i < table->GetMaxChildren(); i++)
+    {
+        Child *         child = table->GetNewChild();
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+        GenerateExtAddress(extAddress);
+        child->SetState(states[i % OT_ARRAY_LENGTH(states)]);
+        table->SetChildExtAddress(*child, extAddress);
+        table->SetChildRloc16(*child, 0x8000 + static_cast<uint16_t>(i * 2 * kMaxChildren) + 1);
+    }
+
+    VerifyOrQuit(table->GetNewChild() == NULL, "GetNewChild() did not fail when table was full");
+    VerifyIndexedLookups(*table);
+
+    // Randomly re-assign RLOC16s, remove children and attach new ones (possibly with the RLOC16 and extended
+    // address of a removed child), and restore existing entries, verifying lookups after every change. Like
+    // `MleRouter`, keep RLOC16s and extended addresses unique among children that are not invalid.
+
+    for (uint16_t iter = 0; iter < 1000; iter++)
+    {
+        Child &         child = *table->GetChildAtIndex(static_cast<uint8_t>(GetRandom() % table->GetMaxChildren()));
+        Mac::ExtAddress extAddress;
+
+        switch (GetRandom() % 4)
+        {
+        case 0:
+            if (child.GetState() != Child::kStateInvalid)
+            {
+                table->SetChildRloc16(child, GetUnusedRloc16(*table));
+            }
+
+            break;
+
+        case 1:
+            child.SetState(Child::kStateInvalid);
+            break;
+
+        case 2:
+        {
+            Child *newChild = table->GetNewChild();
+
+            if (newChild == NULL)
+            {
+                break;
+            }
+
+            if (child.GetState() == Child::kStateInvalid && newChild != &child &&
+                table->FindChild(child.GetRloc16(), ChildTable::kInStateAnyExceptInvalid) == NULL &&
+                table->FindChild(child.GetExtAddress(), ChildTable::kInStateAnyExceptInvalid) == NULL)
+            {
+                table->SetChildExtAddress(*newChild, child.GetExtAddress());
+                table->SetChildRloc16(*newChild, child.GetRloc16());
+            }
+            else
+            {
+                GenerateExtAddress(extAddress);
+                table->SetChildExtAddress(*newChild, extAddress);
+                table->SetChildRloc16(*newChild, GetUnusedRloc16(*table));
+            }
+
+            newChild->SetState(states[GetRandom() % OT_ARRAY_LENGTH(states)]);
+            break;
+        }
+
+        case 3:
+            if (child.GetState() != Child::kStateInvalid)
+            {
+                uint16_t rloc16 = child.GetRloc16();
+
+                extAddress = child.GetExtAddress();
+                table->ClearChild(child);
+                table->SetChildExtAddress(child, extAddress);
+                table->SetChildRloc16(child, rloc16);
+                child.SetState(Child::kStateRestored);
+            }
+
+            break;
+        }
+
+        VerifyIndexedLookups(*table);
+    }
+
+    table->Clear();
+    VerifyIndexedLookups(*table);
+    VerifyOrQuit(!table->HasChildren(ChildTable::kInStateAnyExceptInvalid), "Clear() failed");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
+void TestChildTableLookupPerformance(void)
+{
+    const uint16_t kNumChildrenList[] = {10, 128, 511};
+
+    enum
+    {
+        kPerfIteration = 200000,
+    };
+
+    ChildTable *table;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable lookup performance\n");
+
+    for (uint8_t k = 0; k < OT_ARRAY_LENGTH(kNumChildrenList); k++)
+    {
+        uint16_t        numChildren = kNumChildrenList[k];
+        uint16_t        rloc16s[kMaxChildren];
+        Mac::ExtAddress extAddresses[kMaxChildren];
+        uint32_t        numFound = 0;
+        uint64_t        startTime;
+        uint64_t        indexDuration;
+        uint64_t        scanDuration;
+
+        if (numChildren > table->GetMaxChildren())
+        {
+            printf("  %3u children: skipped (OPENTHREAD_CONFIG_MLE_MAX_CHILDREN is %u)\n", numChildren,
+                   table->GetMaxChildren());
+            continue;
+        }
+
+        table->Clear();
+
+        for (uint16_t i = 0; i < numChildren; i++)
+        {
+            Child *child = table->GetNewChild();
+
+            VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+            rloc16s[i] = 0x8000 + i + 1;
+            GenerateExtAddress(extAddresses[i]);
+
+            child->SetState(Child::kStateValid);
+            table->SetChildExtAddress(*child, extAddresses[i]);
+            table->SetChildRloc16(*child, rloc16s[i]);
+        }
+
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+        {
+            uint16_t i = iter % numChildren;
+
+            numFound += (table->FindChild(rloc16s[i], ChildTable::kInStateValidOrRestoring) != NULL);
+            numFound += (table->FindChild(extAddresses[i], ChildTable::kInStateValidOrRestoring) != NULL);
+        }
+
+        indexDuration = testGetHostTimeUsec() - startTime;
+        startTime     = testGetHostTimeUsec();
+
+        for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+        {
+            uint16_t i = iter % numChildren;
+
+            numFound += (FindChildByScan(*table, rloc16s[i], ChildTable::kInStateValidOrRestoring) != NULL);
+            numFound += (FindChildByScan(*table, extAddresses[i], ChildTable::kInStateValidOrRestoring) != NULL);
+        }
+
+        scanDuration = testGetHostTimeUsec() - startTime;
+
+        VerifyOrQuit(numFound == 4 * kPerfIteration, "FindChild() failed to find a child");
+
+        printf("  %3u children: indexed %6.3f usec/lookup, linear scan %6.3f usec/lookup\n", numChildren,
+               static_cast<double>(indexDuration) / (2 * kPerfIteration),
+               static_cast<double>(scanDuration) / (2 * kPerfIteration));
+    }
+
+    testFreeInstance(sInstance);
+}
+
+void TestChildMask(void)
+{
+    ChildMask mask;
+
+    printf("Test ChildMask");
+
+    VerifyOrQuit(mask.IsEmpty(), "ChildMask is not empty after construction");
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN; i++)
+    {
+        VerifyOrQuit(!mask.Has(i), "ChildMask::Has() failed on empty mask");
+    }
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN; i += 3)
+    {
+        mask.Add(i);
+        VerifyOrQuit(!mask.IsEmpty(), "ChildMask::IsEmpty() failed after Add()");
+    }
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN; i++)
+    {
+        VerifyOrQuit(mask.Has(i) == (i % 3 == 0), "ChildMask::Has() does not match added children");
+    }
+
+    for (uint8_t i = 0; i < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN; i += 3)
+    {
+        VerifyOrQuit(!mask.IsEmpty(), "ChildMask::IsEmpty() failed before last Remove()");
+        mask.Remove(i);
+        VerifyOrQuit(!mask.Has(i), "ChildMask::Has() failed after Remove()");
+    }
+
+    VerifyOrQuit(mask.IsEmpty(), "ChildMask is not empty after removing all children");
+
+    mask.Add(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN - 1);
+    mask.Clear();
+    VerifyOrQuit(mask.IsEmpty(), "ChildMask is not empty after Clear()");
+
+    printf(" -- PASS\n");
+}
+
+static uint32_t sMleFrameCounter = 0;
+
+// Delivers an MLE Child Update Request from `aChild` registering `aAddresses` to the MLE socket, secured with the
+// current MLE key as a child would send it.
+static void ReceiveChildUpdateRequest(Child &             aChild,
+                                      Mle::DeviceMode     aMode,
+                                      const Ip6::Address *aAddresses,
+                                      uint8_t             aNumAddresses)
+{
+    Mle::MleRouter &              mle        = sInstance->Get<Mle::MleRouter>();
+    KeyManager &                  keyManager = sInstance->Get<KeyManager>();
+    Message *                     message;
+    Mle::Header                   header;
+    Mle::ModeTlv                  mode;
+    Mle::Tlv                      tlv;
+    Mle::AddressRegistrationEntry entry;
+    Ip6::Address                  peerAddr;
+    Ip6::MessageInfo              messageInfo;
+    otThreadLinkInfo              linkInfo;
+    Crypto::AesCcm                aesCcm;
+    uint8_t                       nonce[13];
+    uint8_t                       tag[4];
+    uint8_t                       tagLength = sizeof(tag);
+    uint8_t                       buf[64];
+    uint16_t                      offset;
+    uint16_t                      length;
+
+    message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+
+    header.Init();
+    header.SetKeyIdMode2();
+    header.SetKeyId(keyManager.GetCurrentKeySequence());
+    header.SetFrameCounter(sMleFrameCounter);
+    header.SetCommand(Mle::Header::kCommandChildUpdateRequest);
+    SuccessOrQuit(message->Append(&header, header.GetLength()), "Message::Append() failed");
+
+    mode.Init();
+    mode.SetMode(aMode);
+    SuccessOrQuit(message->Append(&mode, sizeof(mode)), "Message::Append() failed");
+
+    entry.SetUncompressed();
+    tlv.SetType(Mle::Tlv::kAddressRegistration);
+    tlv.SetLength(aNumAddresses * entry.GetLength());
+    SuccessOrQuit(message->Append(&tlv, sizeof(tlv)), "Message::Append() failed");
+
+    for (uint8_t i = 0; i < aNumAddresses; i++)
+    {
+        entry.SetIp6Address(aAddresses[i]);
+        SuccessOrQuit(message->Append(&entry, entry.GetLength()), "Message::Append() failed");
+    }
+
+    memset(&peerAddr, 0, sizeof(peerAddr));
+    peerAddr.mFields.m16[0] = HostSwap16(0xfe80);
+    peerAddr.SetIid(aChild.GetExtAddress());
+
+    memcpy(nonce, aChild.GetExtAddress().m8, sizeof(aChild.GetExtAddress().m8));
+    nonce[8]  = static_cast<uint8_t>(sMleFrameCounter >> 24);
+    nonce[9]  = static_cast<uint8_t>(sMleFrameCounter >> 16);
+    nonce[10] = static_cast<uint8_t>(sMleFrameCounter >> 8);
+    nonce[11] = static_cast<uint8_t>(sMleFrameCounter);
+    nonce[12] = Mac::Frame::kSecEncMic32;
+    sMleFrameCounter++;
+
+    // The command byte and TLVs are encrypted, the addresses and the auxiliary security header are authenticated.
+    offset = header.GetLength() - 1;
+
+    aesCcm.SetKey(keyManager.GetCurrentMleKey(), 16, keyManager.GetKeyScheduleCache());
+    SuccessOrQuit(aesCcm.Init(sizeof(peerAddr) + sizeof(peerAddr) + header.GetHeaderLength(),
+                              message->GetLength() - offset, sizeof(tag), nonce, sizeof(nonce)),
+                  "AesCcm::Init() failed");
+    aesCcm.Header(&peerAddr, sizeof(peerAddr));
+    aesCcm.Header(&mle.GetLinkLocalAddress(), sizeof(mle.GetLinkLocalAddress()));
+    aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
+
+    while (offset < message->GetLength())
+    {
+        length = message->Read(offset, sizeof(buf), buf);
+        aesCcm.Payload(buf, buf, length, true);
+        message->Write(offset, length, buf);
+        offset += length;
+    }
+
+    aesCcm.Finalize(tag, &tagLength);
+    SuccessOrQuit(message->Append(tag, tagLength), "Message::Append() failed");
+
+    memset(&linkInfo, 0, sizeof(linkInfo));
+    linkInfo.mPanId = sInstance->Get<Mac::Mac>().GetPanId();
+
+    messageInfo.SetPeerAddr(peerAddr);
+    messageInfo.SetSockAddr(mle.GetLinkLocalAddress());
+    messageInfo.SetPeerPort(Mle::kUdpPort);
+    messageInfo.SetSockPort(Mle::kUdpPort);
+    messageInfo.SetHopLimit(255);
+    messageInfo.SetLinkInfo(&linkInfo);
+
+    sInstance->Get<Ip6::Udp>().HandlePayload(*message, messageInfo);
+    message->Free();
+
+    // Drop the Child Update Response queued for the sleepy child, it is never polled for.
+    sInstance->Get<IndirectSender>().ClearAllMessagesForSleepyChild(aChild);
+}
+
+// Registers `aAddresses` for the sleepy child `aChild`.
+static void RegisterAddresses(Child &aChild, const Ip6::Address *aAddresses, uint8_t aNumAddresses)
+{
+    ReceiveChildUpdateRequest(aChild, Mle::DeviceMode(0), aAddresses, aNumAddresses);
+}
+
+static Ip6::Address MulticastGroup(uint16_t aGroupId)
+{
+    Ip6::Address address;
+
+    memset(&address, 0, sizeof(address));
+    address.mFields.m16[0] = HostSwap16(0xff05);
+    address.mFields.m16[7] = HostSwap16(aGroupId);
+
+    return address;
+}
+
+// Verifies that the fan-out set of every group up to `aMaxGroupId` matches `IsSleepyChildSubscribed()`.
+static void VerifyMulticastFanOut(uint16_t aMaxGroupId)
+{
+    Mle::MleRouter &mle   = sInstance->Get<Mle::MleRouter>();
+    ChildTable &    table = sInstance->Get<ChildTable>();
+
+    for (uint16_t groupId = 1; groupId <= aMaxGroupId; groupId++)
+    {
+        Ip6::Address address = MulticastGroup(groupId);
+        ChildMask    mask;
+        bool         hasSubscribers = false;
+
+        mle.GetSleepyChildrenSubscribed(address, mask);
+
+        for (uint8_t index = 0; index < table.GetMaxChildren(); index++)
+        {
+            Child *child      = table.GetChildAtIndex(index);
+            bool   subscribed = (child != NULL) && mle.IsSleepyChildSubscribed(address, *child);
+
+            VerifyOrQuit(mask.Has(index) == subscribed, "GetSleepyChildrenSubscribed() does not match children");
+            hasSubscribers |= subscribed;
+        }
+
+        VerifyOrQuit(mle.HasSleepyChildrenSubscribed(address) == hasSubscribers,
+                     "HasSleepyChildrenSubscribed() does not match children");
+    }
+}
+
+void TestChildMulticastSubscriptions(void)
+{
+    Child *         children[kMaxChildren];
+    Mac::ExtAddress extAddresses[kMaxChildren];
+    Ip6::Address    addresses[OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD];
+    ChildTable *    table;
+    Mle::MleRouter *mle;
+    uint16_t        nextGroupId = 1;
+    uint8_t         numChildren = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+    mle   = &sInstance->Get<Mle::MleRouter>();
+
+    printf("Test child multicast subscriptions");
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true), "otIp6SetEnabled() failed");
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true), "otThreadSetEnabled() failed");
+    SuccessOrQuit(mle->BecomeLeader(), "BecomeLeader() failed");
+
+    for (uint8_t i = 0; i < kMaxChildren; i++)
+    {
+        children[i] = table->GetNewChild();
+        VerifyOrQuit(children[i] != NULL, "GetNewChild() failed");
+
+        GenerateExtAddress(extAddresses[i]);
+        children[i]->SetState(Child::kStateValid);
+        table->SetChildExtAddress(*children[i], extAddresses[i]);
+        table->SetChildRloc16(*children[i], mle->GetRloc16() + 1 + i);
+        children[i]->SetDeviceMode(Mle::DeviceMode(0));
+        children[i]->SetKeySequence(sInstance->Get<KeyManager>().GetCurrentKeySequence());
+    }
+
+    // Two children sharing a group, plus a non-sleepy child that must never be in the fan-out set.
+
+    addresses[0] = MulticastGroup(1);
+    addresses[1] = MulticastGroup(2);
+    RegisterAddresses(*children[0], addresses, 2);
+    RegisterAddresses(*children[1], addresses, 1);
+    VerifyOrQuit(mle->HasSleepyChildrenSubscribed(addresses[0]), "group not subscribed after Child Update Request");
+
+    ReceiveChildUpdateRequest(*children[2], Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle), addresses, 1);
+    VerifyOrQuit(children[2]->GetDeviceMode().IsRxOnWhenIdle(), "Child Update Request was not processed");
+    VerifyMulticastFanOut(3);
+
+    RegisterAddresses(*children[2], NULL, 0);
+    VerifyOrQuit(!children[2]->GetDeviceMode().IsRxOnWhenIdle(), "Child Update Request was not processed");
+    VerifyMulticastFanOut(3);
+
+    // Dropping one subscriber keeps the group, dropping the last one frees it.
+
+    RegisterAddresses(*children[0], &addresses[1], 1);
+    VerifyOrQuit(mle->HasSleepyChildrenSubscribed(addresses[0]), "group dropped while it still has a subscriber");
+    VerifyMulticastFanOut(3);
+
+    RegisterAddresses(*children[1], NULL, 0);
+    VerifyOrQuit(!mle->HasSleepyChildrenSubscribed(addresses[0]), "group kept after its last child left");
+    VerifyMulticastFanOut(3);
+
+    mle->RemoveNeighbor(*children[0]);
+    VerifyOrQuit(!mle->HasSleepyChildrenSubscribed(addresses[1]), "group kept after its child was removed");
+    VerifyMulticastFanOut(3);
+
+    // A new child reusing the removed entry must not inherit its subscriptions.
+
+    VerifyOrQuit(table->GetNewChild() == children[0], "GetNewChild() did not reuse the removed child");
+    children[0]->SetState(Child::kStateValid);
+    table->SetChildExtAddress(*children[0], extAddresses[0]);
+    table->SetChildRloc16(*children[0], mle->GetRloc16() + 1);
+    children[0]->SetKeySequence(sInstance->Get<KeyManager>().GetCurrentKeySequence());
+    VerifyMulticastFanOut(3);
+
+    // Register more distinct groups than the group table holds, so lookups fall back to scanning the children.
+
+    while (nextGroupId <= OPENTHREAD_CONFIG_MLE_CHILD_MULTICAST_GROUPS)
+    {
+        VerifyOrQuit(numChildren < kMaxChildren, "not enough children to overflow the group table");
+
+        for (uint8_t i = 0; i < OT_ARRAY_LENGTH(addresses); i++)
+        {
+            addresses[i] = MulticastGroup(nextGroupId++);
+        }
+
+        RegisterAddresses(*children[numChildren++], addresses, OT_ARRAY_LENGTH(addresses));
+    }
+
+    VerifyMulticastFanOut(nextGroupId);
+
+    // Removing children keeps the scan fallback, the next registration rebuilds the group table.
+
+    while (numChildren > 2)
+    {
+        mle->RemoveNeighbor(*children[--numChildren]);
+        VerifyMulticastFanOut(nextGroupId);
+    }
+
+    addresses[0] = MulticastGroup(1);
+    RegisterAddresses(*children[1], addresses, 1);
+    VerifyMulticastFanOut(nextGroupId);
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        mle->RemoveNeighbor(*children[i]);
+    }
+
+    VerifyMulticastFanOut(nextGroupId);
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndex();
+    ot::TestChildTableLookupPerformance();
+    ot::TestChildMask();
+    ot::TestChildMulticastSubscriptions();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,1329 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "coap/coap.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+
+namespace ot {
+
+enum
+{
+    kPeerPort            = 5683,
+    kTokenLength         = 4,
+    kMaxIndexedRequests  = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_REQUESTS,
+    kMaxCachedResponses  = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
+    kBenchmarkRequests   = 200,
+    kBenchmarkIterations = 1000000,
+    kMaxIndexedResources = OPENTHREAD_CONFIG_COAP_MAX_INDEXED_RESOURCES,
+    kNumExtraResources   = 8,
+};
+
+static const char *const kUriPaths[] = {
+    "a/aq", "a/an", "a/ae", "a/ar", "a/as", "a/sd", "a", "ab", "a/a", "a/", "n/sd", "c/ca", "c/cp", "d/dg", "d/dq",
+};
+
+static const char *const kTmfUriPaths[] = {
+    "a/aq", "a/an", "a/ae", "a/ar", "a/as", "c/ag", "c/as", "c/dc", "c/es", "c/er", "c/pg",
+    "c/ps", "a/sd", "c/ab", "c/ur", "c/ut", "c/rx", "c/tx", "c/jf", "c/je", "c/lp", "c/la",
+    "c/pc", "c/pq", "c/cg", "c/ca", "c/cp", "c/cs", "d/dg", "d/dq", "d/da", "d/dr",
+};
+
+/**
+ * This class is a CoAP agent that hands sent messages to the test instead of a UDP socket.
+ *
+ */
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : Coap::CoapBase(aInstance, &TestCoap::Send)
+        , mNumSent(0)
+        , mLastSentType(OT_COAP_TYPE_RESET)
+        , mLastSentCode(OT_COAP_CODE_EMPTY)
+        , mLastSentMessageId(0)
+        , mPeer(NULL)
+        , mOutbox()
+    {
+    }
+
+    void Receive(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        CoapBase::Receive(aMessage, aMessageInfo);
+    }
+
+    uint16_t GetNumPendingRequests(void) const
+    {
+        uint16_t messageCount;
+        uint16_t bufferCount;
+
+        GetRequestMessages().GetInfo(messageCount, bufferCount);
+        return messageCount;
+    }
+
+    uint16_t            mNumSent;
+    Coap::Message::Type mLastSentType;
+    Coap::Message::Code mLastSentCode;
+    uint16_t            mLastSentMessageId;
+    TestCoap *          mPeer;
+    MessageQueue        mOutbox;
+
+private:
+    static otError Send(CoapBase &aCoapBase, ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        TestCoap &     coap    = static_cast<TestCoap &>(aCoapBase);
+        Coap::Message &message = static_cast<Coap::Message &>(aMessage);
+
+        OT_UNUSED_VARIABLE(aMessageInfo);
+
+        SuccessOrQuit(message.SetOffset(0), "SetOffset() failed");
+        SuccessOrQuit(message.ParseHeader(), "sent message has an invalid CoAP header");
+
+        coap.mNumSent++;
+        coap.mLastSentType      = message.GetType();
+        coap.mLastSentCode      = message.GetCode();
+        coap.mLastSentMessageId = message.GetMessageId();
+
+        if (coap.mPeer != NULL)
+        {
+            // Keep the message until the test hands it to the peer agent.
+            coap.mOutbox.Enqueue(aMessage);
+        }
+        else
+        {
+            aMessage.Free();
+        }
+
+        return OT_ERROR_NONE;
+    }
+};
+
+static Instance *sInstance;
+static TestCoap *sCoap;
+static void *    sResponseContext;
+static otError   sResponseResult;
+static uint16_t  sNumResponses;
+static uint16_t  sNumRequests;
+static void *    sRequestContext;
+static uint16_t  sRequestMessageId;
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sResponseContext = aContext;
+    sResponseResult  = aResult;
+    sNumResponses++;
+}
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap &coap = *static_cast<TestCoap *>(aContext);
+
+    sNumRequests++;
+    SuccessOrQuit(coap.SendHeaderResponse(OT_COAP_CODE_CHANGED, *static_cast<Coap::Message *>(aMessage),
+                                          *static_cast<const Ip6::MessageInfo *>(aMessageInfo)),
+                  "SendHeaderResponse() failed");
+}
+
+static void HandleResourceRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    sRequestContext = aContext;
+    sNumRequests++;
+}
+
+static void *GetContext(uint16_t aIndex)
+{
+    return reinterpret_cast<void *>(static_cast<uintptr_t>(aIndex));
+}
+
+static void InitMessageInfo(Ip6::MessageInfo &aMessageInfo, uint16_t aPeerPort)
+{
+    aMessageInfo = Ip6::MessageInfo();
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString("fdde:ad00:beef:0:0:ff:fe00:fc01"), "FromString() failed");
+    aMessageInfo.SetPeerPort(aPeerPort);
+}
+
+static void GetToken(uint16_t aIndex, uint8_t *aToken)
+{
+    aToken[0] = 0x5a;
+    aToken[1] = 0xa5;
+    aToken[2] = static_cast<uint8_t>(aIndex >> 8);
+    aToken[3] = static_cast<uint8_t>(aIndex & 0xff);
+}
+
+static otError SendRequest(TestCoap &aCoap, uint16_t aIndex, uint16_t aMessageId, uint16_t aPeerPort = kPeerPort)
+{
+    otError          error   = OT_ERROR_NONE;
+    Coap::Message *  message = NULL;
+    Ip6::MessageInfo messageInfo;
+    uint8_t          token[kTokenLength];
+
+    VerifyOrExit((message = aCoap.NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    GetToken(aIndex, token);
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    message->SetMessageId(aMessageId);
+    SuccessOrExit(error = message->SetToken(token, sizeof(token)));
+    SuccessOrExit(error = message->AppendUriPathOptions("a/b"));
+
+    InitMessageInfo(messageInfo, aPeerPort);
+    SuccessOrExit(error = aCoap.SendMessage(*message, messageInfo, HandleResponse, GetContext(aIndex)));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+static void InitResponse(Coap::Message &     aResponse,
+                         Coap::Message::Type aType,
+                         Coap::Message::Code aCode,
+                         uint16_t            aIndex,
+                         uint16_t            aMessageId)
+{
+    uint8_t token[kTokenLength];
+
+    GetToken(aIndex, token);
+    aResponse.Init(aType, aCode);
+    aResponse.SetMessageId(aMessageId);
+
+    if (aCode != OT_COAP_CODE_EMPTY)
+    {
+        SuccessOrQuit(aResponse.SetToken(token, sizeof(token)), "SetToken() failed");
+    }
+
+    aResponse.Finish();
+}
+
+static void ReceiveResponse(TestCoap &          aCoap,
+                            Coap::Message::Type aType,
+                            Coap::Message::Code aCode,
+                            uint16_t            aIndex,
+                            uint16_t            aMessageId,
+                            uint16_t            aPeerPort = kPeerPort)
+{
+    Coap::Message *  response;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit((response = aCoap.NewMessage()) != NULL, "NewMessage() failed");
+
+    InitResponse(*response, aType, aCode, aIndex, aMessageId);
+    InitMessageInfo(messageInfo, aPeerPort);
+    aCoap.Receive(*response, messageInfo);
+
+    response->Free();
+}
+
+static void ReceiveRequest(TestCoap &aCoap, uint16_t aMessageId, uint16_t aPeerPort)
+{
+    Coap::Message *  request;
+    Ip6::MessageInfo messageInfo;
+    uint8_t          token[kTokenLength];
+
+    VerifyOrQuit((request = aCoap.NewMessage()) != NULL, "NewMessage() failed");
+
+    GetToken(aMessageId, token);
+    request->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    request->SetMessageId(aMessageId);
+    SuccessOrQuit(request->SetToken(token, sizeof(token)), "SetToken() failed");
+    SuccessOrQuit(request->AppendUriPathOptions("t"), "AppendUriPathOptions() failed");
+    request->Finish();
+
+    InitMessageInfo(messageInfo, aPeerPort);
+    aCoap.Receive(*request, messageInfo);
+
+    request->Free();
+}
+
+static void ReceivePiggybackedResponse(TestCoap &aCoap, uint16_t aIndex, uint16_t aMessageId)
+{
+    uint16_t numPending = aCoap.GetNumPendingRequests();
+
+    sNumResponses = 0;
+    ReceiveResponse(aCoap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, aIndex, aMessageId);
+
+    VerifyOrQuit(sNumResponses == 1, "response was not matched");
+    VerifyOrQuit(sResponseContext == GetContext(aIndex), "response matched the wrong request");
+    VerifyOrQuit(sResponseResult == OT_ERROR_NONE, "response handler got an error");
+    VerifyOrQuit(aCoap.GetNumPendingRequests() == numPending - 1, "request was not removed");
+}
+
+void TestCoapResponseMatching(void)
+{
+    TestCoap &coap = *sCoap;
+
+    for (uint16_t i = 1; i <= 4; i++)
+    {
+        SuccessOrQuit(SendRequest(coap, i, 0x100 + i), "SendRequest() failed");
+    }
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == 4, "requests are not pending");
+
+    // A response from another port, or with an unknown Message ID, is not matched.
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, 3, 0x103, kPeerPort + 1);
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, 3, 0x203);
+    VerifyOrQuit(sNumResponses == 0 && coap.GetNumPendingRequests() == 4, "unrelated response was matched");
+
+    // Piggybacked responses, out of order.
+    ReceivePiggybackedResponse(coap, 3, 0x103);
+    ReceivePiggybackedResponse(coap, 1, 0x101);
+
+    // Empty acknowledgment followed by a separate response, matched by Token.
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, 4, 0x104);
+    VerifyOrQuit(sNumResponses == 0 && coap.GetNumPendingRequests() == 2, "empty acknowledgment ended the request");
+
+    ReceiveResponse(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 4, 0x7777);
+    VerifyOrQuit(sNumResponses == 1 && sResponseContext == GetContext(4), "separate response failed");
+    VerifyOrQuit(coap.mLastSentType == OT_COAP_TYPE_ACKNOWLEDGMENT && coap.mLastSentMessageId == 0x7777,
+                 "separate response was not acknowledged");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 1, "request was not removed");
+
+    // A reset ends the last request.
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_RESET, OT_COAP_CODE_EMPTY, 2, 0x102);
+    VerifyOrQuit(sNumResponses == 1 && sResponseResult == OT_ERROR_ABORT, "reset did not abort the request");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "request was not removed");
+
+    printf("TestCoapResponseMatching PASSED\n");
+}
+
+void TestCoapResponseMatchingUnindexed(void)
+{
+    enum
+    {
+        kNumRequests = kMaxIndexedRequests + 8,
+    };
+
+    TestCoap &coap = *sCoap;
+
+    // Requests sent while the index is full are still matched.
+    for (uint16_t i = 1; i <= kNumRequests; i++)
+    {
+        SuccessOrQuit(SendRequest(coap, i, 0x200 + i), "SendRequest() failed");
+    }
+
+    for (uint16_t i = kNumRequests; i > kNumRequests / 2; i--)
+    {
+        ReceivePiggybackedResponse(coap, i, 0x200 + i);
+    }
+
+    // Requests are indexed again as others complete.
+    for (uint16_t i = 1; i <= kNumRequests / 2; i++)
+    {
+        SuccessOrQuit(SendRequest(coap, kNumRequests + i, 0x300 + i), "SendRequest() failed");
+    }
+
+    for (uint16_t i = 1; i <= kNumRequests / 2; i++)
+    {
+        ReceivePiggybackedResponse(coap, i, 0x200 + i);
+        ReceivePiggybackedResponse(coap, kNumRequests + i, 0x300 + i);
+    }
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "requests are still pending");
+
+    printf("TestCoapResponseMatchingUnindexed PASSED\n");
+}
+
+void TestCoapResponseCache(void)
+{
+    TestCoap &     coap = *sCoap;
+    Coap::Resource resource("t", HandleRequest, &coap);
+    uint16_t       numSent;
+
+    SuccessOrQuit(coap.AddResource(resource), "AddResource() failed");
+
+    sNumRequests = 0;
+    ReceiveRequest(coap, 0x400, kPeerPort);
+    VerifyOrQuit(sNumRequests == 1 && coap.mLastSentCode == OT_COAP_CODE_CHANGED, "request was not handled");
+
+    // A duplicate gets the cached response without reaching the resource.
+    numSent = coap.mNumSent;
+    ReceiveRequest(coap, 0x400, kPeerPort);
+    VerifyOrQuit(sNumRequests == 1, "duplicate request reached the resource");
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastSentMessageId == 0x400, "cached response was not sent");
+
+    // The same Message ID from another endpoint is a new request.
+    ReceiveRequest(coap, 0x400, kPeerPort + 1);
+    VerifyOrQuit(sNumRequests == 2, "request from another endpoint was taken as a duplicate");
+
+    // Fill the cache, evicting the oldest responses.
+    for (uint16_t i = 1; i < kMaxCachedResponses; i++)
+    {
+        ReceiveRequest(coap, 0x400 + i, kPeerPort);
+    }
+
+    VerifyOrQuit(sNumRequests == kMaxCachedResponses + 1, "request was not handled");
+
+    ReceiveRequest(coap, 0x400 + kMaxCachedResponses - 1, kPeerPort);
+    VerifyOrQuit(sNumRequests == kMaxCachedResponses + 1, "duplicate request reached the resource");
+
+    ReceiveRequest(coap, 0x400, kPeerPort);
+    VerifyOrQuit(sNumRequests == kMaxCachedResponses + 2, "evicted response was still cached");
+
+    coap.ClearRequestsAndResponses();
+    VerifyOrQuit(coap.GetCachedResponses().GetHead() == NULL, "responses are still cached");
+
+    ReceiveRequest(coap, 0x400 + kMaxCachedResponses - 1, kPeerPort);
+    VerifyOrQuit(sNumRequests == kMaxCachedResponses + 3, "cleared response was still cached");
+
+    coap.ClearRequestsAndResponses();
+    coap.RemoveResource(resource);
+
+    printf("TestCoapResponseCache PASSED\n");
+}
+
+void TestCoapResponseMatchingThroughput(void)
+{
+    TestCoap &       coap = *sCoap;
+    Coap::Message *  response;
+    Ip6::MessageInfo messageInfo;
+    uint16_t         numRequests;
+    uint32_t         random = 1;
+    uint64_t         startTime;
+    uint64_t         duration;
+
+    // Queue as many confirmable requests as the message pool allows, keeping one buffer for the response.
+    for (numRequests = 0; numRequests < kBenchmarkRequests; numRequests++)
+    {
+        if (SendRequest(coap, numRequests, numRequests + 1) != OT_ERROR_NONE)
+        {
+            break;
+        }
+    }
+
+    VerifyOrQuit(numRequests > kMaxIndexedRequests, "message pool is too small for the benchmark");
+
+    numRequests--;
+    ReceivePiggybackedResponse(coap, numRequests, numRequests + 1);
+
+    VerifyOrQuit((response = coap.NewMessage()) != NULL, "NewMessage() failed");
+    InitMessageInfo(messageInfo, kPeerPort);
+
+    // Empty acknowledgments leave the requests pending, awaiting their separate responses.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        uint16_t index;
+
+        random = random * 1103515245 + 12345;
+        index  = static_cast<uint16_t>((random >> 16) % numRequests);
+
+        InitResponse(*response, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, index, index + 1);
+        coap.Receive(*response, messageInfo);
+    }
+
+    duration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(coap.GetNumPendingRequests() == numRequests, "requests were removed");
+
+    printf("TestCoapResponseMatchingThroughput: %d pending requests, %9.0f responses/sec\n", numRequests,
+           kBenchmarkIterations * 1000000.0 / duration);
+
+    response->Free();
+    coap.ClearRequestsAndResponses();
+}
+
+static Coap::Message *NewUriPathRequest(TestCoap &aCoap, const char *aUriPath)
+{
+    Coap::Message *request;
+
+    VerifyOrQuit((request = aCoap.NewMessage()) != NULL, "NewMessage() failed");
+
+    request->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    request->SetMessageId(++sRequestMessageId);
+    SuccessOrQuit(request->AppendUriPathOptions(aUriPath), "AppendUriPathOptions() failed");
+    request->Finish();
+
+    return request;
+}
+
+static void CheckDispatch(TestCoap &aCoap, const char *aUriPath, int aIndex)
+{
+    Coap::Message *  request = NewUriPathRequest(aCoap, aUriPath);
+    Ip6::MessageInfo messageInfo;
+    uint16_t         numSent = aCoap.mNumSent;
+
+    sNumRequests    = 0;
+    sRequestContext = NULL;
+
+    InitMessageInfo(messageInfo, kPeerPort);
+    aCoap.Receive(*request, messageInfo);
+
+    if (aIndex < 0)
+    {
+        VerifyOrQuit(sNumRequests == 0, "request was dispatched to a resource");
+        VerifyOrQuit(aCoap.mNumSent == numSent + 1 && aCoap.mLastSentCode == OT_COAP_CODE_NOT_FOUND,
+                     "request was not rejected");
+    }
+    else
+    {
+        VerifyOrQuit(sNumRequests == 1, "request was not dispatched");
+        VerifyOrQuit(sRequestContext == GetContext(static_cast<uint16_t>(aIndex)),
+                     "request was dispatched to the wrong resource");
+    }
+
+    request->Free();
+}
+
+static void InitResource(otCoapResource &aResource, const char *aUriPath, uint16_t aIndex)
+{
+    aResource.mUriPath = aUriPath;
+    aResource.mHandler = HandleResourceRequest;
+    aResource.mContext = GetContext(aIndex);
+    aResource.mNext    = NULL;
+}
+
+void TestCoapResourceDispatch(void)
+{
+    enum
+    {
+        kNumResources = OT_ARRAY_LENGTH(kUriPaths),
+    };
+
+    TestCoap &     coap = *sCoap;
+    otCoapResource resources[kNumResources];
+    otCoapResource shadow;
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        InitResource(resources[i], kUriPaths[i], i);
+    }
+
+    SuccessOrQuit(coap.AddResources(static_cast<Coap::Resource *>(&resources[0]), kNumResources), "AddResources() failed");
+    VerifyOrQuit(coap.AddResources(static_cast<Coap::Resource *>(&resources[1]), 2) == OT_ERROR_ALREADY,
+                 "AddResources() accepted resources twice");
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        CheckDispatch(coap, kUriPaths[i], i);
+    }
+
+    // Leading empty segments are ignored, other segments must match whole.
+    CheckDispatch(coap, "/a/aq", 0);
+    CheckDispatch(coap, "//n/sd", 10);
+    CheckDispatch(coap, "a/aq/x", -1);
+    CheckDispatch(coap, "a/aqx", -1);
+    CheckDispatch(coap, "a/b", -1);
+    CheckDispatch(coap, "a//aq", -1);
+    CheckDispatch(coap, "aa", -1);
+    CheckDispatch(coap, "b", -1);
+    CheckDispatch(coap, "", -1);
+    CheckDispatch(coap, "c", -1);
+    CheckDispatch(coap, "a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a", -1);
+
+    // The most recently added resource for a URI path handles its requests.
+    InitResource(shadow, "n/sd", kNumResources);
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(shadow)), "AddResource() failed");
+    CheckDispatch(coap, "n/sd", kNumResources);
+    coap.RemoveResource(static_cast<Coap::Resource &>(shadow));
+    CheckDispatch(coap, "n/sd", 10);
+
+    coap.RemoveResource(static_cast<Coap::Resource &>(resources[0]));
+    CheckDispatch(coap, "a/aq", -1);
+    CheckDispatch(coap, "a/an", 1);
+
+    for (uint16_t i = 1; i < kNumResources; i++)
+    {
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+        CheckDispatch(coap, kUriPaths[i], -1);
+    }
+
+    coap.ClearRequestsAndResponses();
+
+    printf("TestCoapResourceDispatch PASSED\n");
+}
+
+void TestCoapResourceDispatchUnindexed(void)
+{
+    enum
+    {
+        kNumResources = kMaxIndexedResources + kNumExtraResources,
+    };
+
+    TestCoap &     coap = *sCoap;
+    otCoapResource resources[kNumResources];
+    char           uriPaths[kNumResources][sizeof("r/000")];
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        snprintf(uriPaths[i], sizeof(uriPaths[i]), "r/%d", i);
+        InitResource(resources[i], uriPaths[i], i);
+        SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resources[i])), "AddResource() failed");
+    }
+
+    VerifyOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resources[kNumResources - 1])) == OT_ERROR_ALREADY,
+                 "AddResource() accepted a resource twice");
+
+    // Resources added once the table was full are dispatched as well.
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        CheckDispatch(coap, uriPaths[i], i);
+    }
+
+    CheckDispatch(coap, "r/x", -1);
+
+    // Removing indexed resources moves the others into the table.
+    for (uint16_t i = 0; i < kNumExtraResources + 2; i++)
+    {
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+        CheckDispatch(coap, uriPaths[i], -1);
+    }
+
+    coap.RemoveResource(static_cast<Coap::Resource &>(resources[kNumResources - 1]));
+    CheckDispatch(coap, uriPaths[kNumResources - 1], -1);
+
+    for (uint16_t i = kNumExtraResources + 2; i < kNumResources - 1; i++)
+    {
+        CheckDispatch(coap, uriPaths[i], i);
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+    }
+
+    coap.ClearRequestsAndResponses();
+
+    printf("TestCoapResourceDispatchUnindexed PASSED\n");
+}
+
+void TestCoapResourceDispatchDuplicates(void)
+{
+    enum
+    {
+        kNumFillers = kMaxIndexedResources + 2,
+        kOldIndex   = kNumFillers,
+        kNewIndex   = kNumFillers + 1,
+    };
+
+    TestCoap &     coap = *sCoap;
+    otCoapResource fillers[kNumFillers];
+    otCoapResource oldResource;
+    otCoapResource newResource;
+    char           uriPaths[kNumFillers][sizeof("r/000")];
+
+    InitResource(oldResource, "d", kOldIndex);
+    InitResource(newResource, "d", kNewIndex);
+
+    for (uint16_t i = 0; i < kNumFillers; i++)
+    {
+        snprintf(uriPaths[i], sizeof(uriPaths[i]), "r/%d", i);
+        InitResource(fillers[i], uriPaths[i], i);
+    }
+
+    // A newer resource that does not fit in the index takes precedence over an indexed one.
+    for (uint16_t i = 0; i < kMaxIndexedResources - 1; i++)
+    {
+        SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(fillers[i])), "AddResource() failed");
+    }
+
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(oldResource)), "AddResource() failed");
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(fillers[kMaxIndexedResources - 1])),
+                  "AddResource() failed");
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(newResource)), "AddResource() failed");
+    CheckDispatch(coap, "d", kNewIndex);
+
+    coap.RemoveResource(static_cast<Coap::Resource &>(newResource));
+    CheckDispatch(coap, "d", kOldIndex);
+    coap.RemoveResource(static_cast<Coap::Resource &>(oldResource));
+    CheckDispatch(coap, "d", -1);
+
+    // Resources moved into the index as others are removed keep the precedence of the newer resource.
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(oldResource)), "AddResource() failed");
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(fillers[kMaxIndexedResources])),
+                  "AddResource() failed");
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(newResource)), "AddResource() failed");
+    SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(fillers[kMaxIndexedResources + 1])),
+                  "AddResource() failed");
+    CheckDispatch(coap, "d", kNewIndex);
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        coap.RemoveResource(static_cast<Coap::Resource &>(fillers[i]));
+        CheckDispatch(coap, "d", kNewIndex);
+    }
+
+    coap.RemoveResource(static_cast<Coap::Resource &>(newResource));
+    CheckDispatch(coap, "d", kOldIndex);
+
+    for (uint16_t i = 4; i < kNumFillers; i++)
+    {
+        CheckDispatch(coap, uriPaths[i], i);
+        coap.RemoveResource(static_cast<Coap::Resource &>(fillers[i]));
+    }
+
+    coap.RemoveResource(static_cast<Coap::Resource &>(oldResource));
+    CheckDispatch(coap, "d", -1);
+
+    coap.ClearRequestsAndResponses();
+
+    printf("TestCoapResourceDispatchDuplicates PASSED\n");
+}
+
+void TestCoapResourceDispatchThroughput(void)
+{
+    enum
+    {
+        kNumResources = OT_ARRAY_LENGTH(kTmfUriPaths),
+    };
+
+    TestCoap &       coap = *sCoap;
+    otCoapResource   resources[kNumResources];
+    Coap::Message *  requests[kNumResources];
+    Ip6::MessageInfo messageInfo;
+    uint16_t         index  = 0;
+    uint32_t         random = 1;
+    uint64_t         startTime;
+    uint64_t         duration;
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        InitResource(resources[i], kTmfUriPaths[i], i);
+        SuccessOrQuit(coap.AddResource(static_cast<Coap::Resource &>(resources[i])), "AddResource() failed");
+        requests[i] = NewUriPathRequest(coap, kTmfUriPaths[i]);
+    }
+
+    InitMessageInfo(messageInfo, kPeerPort);
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        random = random * 1103515245 + 12345;
+        index  = static_cast<uint16_t>((random >> 16) % kNumResources);
+
+        SuccessOrQuit(requests[index]->SetOffset(0), "SetOffset() failed");
+        coap.Receive(*requests[index], messageInfo);
+    }
+
+    duration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(sRequestContext == GetContext(index), "request was dispatched to the wrong resource");
+
+    printf("TestCoapResourceDispatchThroughput: %d resources, %9.0f requests/sec\n", kNumResources,
+           kBenchmarkIterations * 1000000.0 / duration);
+
+    for (uint16_t i = 0; i < kNumResources; i++)
+    {
+        requests[i]->Free();
+        coap.RemoveResource(static_cast<Coap::Resource &>(resources[i]));
+    }
+}
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+static uint32_t sNow;
+
+static uint32_t GetTestTime(void)
+{
+    return sNow;
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    sNow += aDuration;
+
+    // Fire the timers that are due, one at a time.
+    while (g_testPlatAlarmSet && static_cast<int32_t>(sNow - g_testPlatAlarmNext) >= 0)
+    {
+        otPlatAlarmMilliFired(sInstance);
+    }
+}
+
+static void GetPeerStats(TestCoap &aCoap, uint16_t aPeerPort, otCoapPeerStats &aStats)
+{
+    otCoapPeerStatsIterator iterator = OT_COAP_PEER_STATS_ITERATOR_INIT;
+
+    do
+    {
+        SuccessOrQuit(aCoap.GetNextPeerStats(iterator, aStats), "peer was not found");
+    } while (aStats.mPeerPort != aPeerPort);
+}
+
+static void CheckPeerStats(TestCoap &aCoap,
+                           uint16_t  aPeerPort,
+                           uint8_t   aNumInFlight,
+                           uint16_t  aNumDeferred,
+                           uint32_t  aNumTransmissions,
+                           uint32_t  aNumRetransmissions)
+{
+    otCoapPeerStats stats;
+
+    GetPeerStats(aCoap, aPeerPort, stats);
+
+    VerifyOrQuit(stats.mNumInFlight == aNumInFlight, "peer has the wrong number of outstanding requests");
+    VerifyOrQuit(stats.mNumDeferred == aNumDeferred, "peer has the wrong number of deferred requests");
+    VerifyOrQuit(stats.mNumTransmissions == aNumTransmissions, "peer has the wrong number of transmissions");
+    VerifyOrQuit(stats.mNumRetransmissions == aNumRetransmissions, "peer has the wrong number of retransmissions");
+}
+
+static void ReceivePeerResponse(TestCoap &aCoap, uint16_t aIndex, uint16_t aMessageId, uint16_t aPeerPort)
+{
+    sNumResponses = 0;
+    ReceiveResponse(aCoap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, aIndex, aMessageId, aPeerPort);
+    VerifyOrQuit(sNumResponses == 1 && sResponseContext == GetContext(aIndex), "response was not matched");
+}
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+static uint32_t MeasureRoundTrip(TestCoap &aCoap, uint16_t aIndex, uint16_t aPeerPort, uint32_t aRoundTripTime)
+{
+    otCoapPeerStats stats;
+
+    SuccessOrQuit(SendRequest(aCoap, aIndex, aIndex, aPeerPort), "SendRequest() failed");
+    AdvanceTime(aRoundTripTime);
+    ReceivePeerResponse(aCoap, aIndex, aIndex, aPeerPort);
+
+    GetPeerStats(aCoap, aPeerPort, stats);
+    return stats.mRetransmissionTimeout;
+}
+#endif
+
+void TestCoapCongestionControl(void)
+{
+    enum
+    {
+        kMaxPeers        = OPENTHREAD_CONFIG_COAP_MAX_PEERS,
+        kAckTimeoutMs    = OPENTHREAD_CONFIG_COAP_ACK_TIMEOUT * 1000,
+        kMaxAckTimeoutMs = kAckTimeoutMs * OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR /
+                           OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR,
+        kRetransmitPort  = kPeerPort + 2,
+        kIgnoredPort     = kPeerPort + 5,
+        kFirstTablePort  = kPeerPort + 0x100,
+    };
+
+    TestCoap &coap    = *sCoap;
+    uint16_t  numSent = coap.mNumSent;
+
+    sNow                  = otPlatAlarmMilliGetNow();
+    g_testPlatAlarmGetNow = GetTestTime;
+
+    // Requests beyond NSTART outstanding ones to a peer are deferred, other peers are not held back.
+    VerifyOrQuit(OPENTHREAD_CONFIG_COAP_NSTART == 1, "test assumes NSTART is 1");
+
+    for (uint16_t i = 1; i <= 3; i++)
+    {
+        SuccessOrQuit(SendRequest(coap, i, 0x500 + i), "SendRequest() failed");
+    }
+
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastSentMessageId == 0x501, "deferred request was sent");
+    VerifyOrQuit(coap.GetNumPendingRequests() == 3, "requests are not pending");
+    CheckPeerStats(coap, kPeerPort, 1, 2, 1, 0);
+
+    SuccessOrQuit(SendRequest(coap, 4, 0x504, kPeerPort + 1), "SendRequest() failed");
+    VerifyOrQuit(coap.mNumSent == numSent + 2 && coap.mLastSentMessageId == 0x504, "request to another peer waits");
+
+    // A deferred request was not sent, so nothing answers it.
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, 2, 0x502);
+    VerifyOrQuit(sNumResponses == 0 && coap.GetNumPendingRequests() == 4, "deferred request was matched");
+
+    // The next deferred request is sent once the outstanding one gets a response.
+    ReceivePeerResponse(coap, 1, 0x501, kPeerPort);
+    VerifyOrQuit(coap.mNumSent == numSent + 2, "deferred request was sent before the transaction ended");
+
+    AdvanceTime(0);
+    VerifyOrQuit(coap.mNumSent == numSent + 3 && coap.mLastSentMessageId == 0x502, "deferred request was not sent");
+    CheckPeerStats(coap, kPeerPort, 1, 1, 2, 0);
+
+    // An empty acknowledgment ends the outstanding interaction too, the separate response may come later.
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_EMPTY, 2, 0x502);
+    AdvanceTime(0);
+    VerifyOrQuit(coap.mNumSent == numSent + 4 && coap.mLastSentMessageId == 0x503, "deferred request was not sent");
+    CheckPeerStats(coap, kPeerPort, 1, 0, 3, 0);
+
+    ReceiveResponse(coap, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CHANGED, 2, 0x7778);
+    VerifyOrQuit(sNumResponses == 1 && sResponseContext == GetContext(2), "separate response failed");
+
+    ReceivePeerResponse(coap, 3, 0x503, kPeerPort);
+    ReceivePeerResponse(coap, 4, 0x504, kPeerPort + 1);
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "requests are still pending");
+    CheckPeerStats(coap, kPeerPort, 0, 0, 3, 0);
+
+    // Replies that are silently ignored do not end the outstanding interaction.
+    SuccessOrQuit(SendRequest(coap, 6, 0x506, kIgnoredPort), "SendRequest() failed");
+    sNumResponses = 0;
+    ReceiveResponse(coap, OT_COAP_TYPE_RESET, OT_COAP_CODE_CHANGED, 6, 0x506, kIgnoredPort);
+    ReceiveResponse(coap, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED, 7, 0x506, kIgnoredPort);
+    VerifyOrQuit(sNumResponses == 0 && coap.GetNumPendingRequests() == 1, "ignored reply was accepted");
+    CheckPeerStats(coap, kIgnoredPort, 1, 0, 1, 0);
+
+    ReceivePeerResponse(coap, 6, 0x506, kIgnoredPort);
+    CheckPeerStats(coap, kIgnoredPort, 0, 0, 1, 0);
+
+    // Retransmissions are counted per peer.
+    SuccessOrQuit(SendRequest(coap, 5, 0x505, kRetransmitPort), "SendRequest() failed");
+    numSent = coap.mNumSent;
+    AdvanceTime(kMaxAckTimeoutMs);
+    VerifyOrQuit(coap.mNumSent == numSent + 1 && coap.mLastSentMessageId == 0x505, "request was not retransmitted");
+    CheckPeerStats(coap, kRetransmitPort, 1, 0, 1, 1);
+    ReceivePeerResponse(coap, 5, 0x505, kRetransmitPort);
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    {
+        otCoapPeerStats stats;
+
+        // The weak estimate of a retransmitted request: RTT 3000 and RTTVAR 1500 give RTO (3 * 2000 + 4500) / 4.
+        GetPeerStats(coap, kRetransmitPort, stats);
+        VerifyOrQuit(stats.mRetransmissionTimeout == 2625, "weak estimate is wrong");
+    }
+#endif
+
+    // Requests to new peers are deferred while every peer has outstanding requests, and take over the first free one.
+    for (uint16_t i = 0; i <= kMaxPeers; i++)
+    {
+        SuccessOrQuit(SendRequest(coap, 0x10 + i, 0x510 + i, kFirstTablePort + i), "SendRequest() failed");
+    }
+
+    VerifyOrQuit(coap.mLastSentMessageId == 0x510 + kMaxPeers - 1, "request to a new peer was sent");
+
+    ReceivePeerResponse(coap, 0x10, 0x510, kFirstTablePort);
+    AdvanceTime(0);
+    VerifyOrQuit(coap.mLastSentMessageId == 0x510 + kMaxPeers, "request to a new peer was not sent");
+    CheckPeerStats(coap, kFirstTablePort + kMaxPeers, 1, 0, 1, 0);
+
+    coap.ClearRequestsAndResponses();
+    VerifyOrQuit(coap.GetNumPendingRequests() == 0, "requests are still pending");
+
+#if OPENTHREAD_CONFIG_COAP_COCOA_ENABLE
+    {
+        otCoapPeerStats stats;
+
+        // Strong estimates: RTT 100 and RTTVAR 50 give 300, then RTTVAR 37 gives 248.
+        VerifyOrQuit(MeasureRoundTrip(coap, 0x20, kPeerPort + 3, 100) == (kAckTimeoutMs + 300) / 2,
+                     "strong estimate is wrong");
+        VerifyOrQuit(MeasureRoundTrip(coap, 0x21, kPeerPort + 3, 100) == ((kAckTimeoutMs + 300) / 2 + 248) / 2,
+                     "strong estimate is wrong");
+
+        // A short timeout doubles after sixteen times its value without measurements.
+        AdvanceTime(16 * 699 + 1);
+        SuccessOrQuit(SendRequest(coap, 0x22, 0x22, kPeerPort + 3), "SendRequest() failed");
+        GetPeerStats(coap, kPeerPort + 3, stats);
+        VerifyOrQuit(stats.mRetransmissionTimeout == 2 * 699, "short timeout did not age");
+        ReceivePeerResponse(coap, 0x22, 0x22, kPeerPort + 3);
+
+        // A short timeout backs off three times, rather than twice.
+        VerifyOrQuit(MeasureRoundTrip(coap, 0x30, kPeerPort + 4, 100) == 1150, "strong estimate is wrong");
+        VerifyOrQuit(MeasureRoundTrip(coap, 0x31, kPeerPort + 4, 100) == 699, "strong estimate is wrong");
+
+        SuccessOrQuit(SendRequest(coap, 0x32, 0x32, kPeerPort + 4), "SendRequest() failed");
+        numSent = coap.mNumSent;
+        AdvanceTime(699 * 3 / 2);
+        VerifyOrQuit(coap.mNumSent == numSent + 1, "request was not retransmitted");
+        AdvanceTime(3 * 699 - 1);
+        VerifyOrQuit(coap.mNumSent == numSent + 1, "request was retransmitted too early");
+        AdvanceTime(3 * (699 * 3 / 2) - (3 * 699 - 1));
+        VerifyOrQuit(coap.mNumSent == numSent + 2, "request was not retransmitted");
+        ReceivePeerResponse(coap, 0x32, 0x32, kPeerPort + 4);
+    }
+#endif
+
+    coap.ClearRequestsAndResponses();
+    g_testPlatAlarmGetNow = NULL;
+
+    printf("TestCoapCongestionControl PASSED\n");
+}
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+/**
+ * This structure is the payload of a block-wise transfer, produced and consumed one block at a time.
+ *
+ */
+struct BlockwiseStream
+{
+    uint32_t mLength;    ///< Length of the payload produced by `TransmitBlock()`.
+    uint32_t mReceived;  ///< Length of the payload consumed by `ReceiveBlock()`.
+    uint32_t mMaxLength; ///< Length of the payload `ReceiveBlock()` accepts.
+    uint16_t mNumSent;   ///< Number of blocks produced.
+    uint16_t mNumBlocks; ///< Number of blocks consumed.
+    bool     mComplete;  ///< Whether the last block was consumed.
+};
+
+static TestCoap *          sServer;
+static BlockwiseStream     sClientStream;
+static BlockwiseStream     sServerStream;
+static otCoapBlockSize     sServerBlockSize;
+static Coap::Message::Code sResponseCode;
+
+static uint8_t GetPayloadByte(uint32_t aPosition)
+{
+    return static_cast<uint8_t>(aPosition ^ (aPosition >> 8));
+}
+
+static void InitBlockwiseStream(BlockwiseStream &aStream, uint32_t aLength)
+{
+    memset(&aStream, 0, sizeof(aStream));
+    aStream.mLength    = aLength;
+    aStream.mMaxLength = 0xffffffff;
+}
+
+static otError TransmitBlock(void *aContext, otMessage *aMessage, uint32_t aPosition, uint16_t aBlockSize, bool *aMore)
+{
+    BlockwiseStream &stream  = *static_cast<BlockwiseStream *>(aContext);
+    ot::Message &    message = *static_cast<ot::Message *>(aMessage);
+    otError          error   = OT_ERROR_NONE;
+    uint32_t         end     = aPosition + aBlockSize;
+
+    VerifyOrQuit(aPosition <= stream.mLength, "block is past the end of the payload");
+
+    if (end > stream.mLength)
+    {
+        end = stream.mLength;
+    }
+
+    for (uint32_t position = aPosition; position < end; position++)
+    {
+        uint8_t byte = GetPayloadByte(position);
+
+        SuccessOrExit(error = message.Append(&byte, sizeof(byte)));
+    }
+
+    *aMore = (end < stream.mLength);
+    stream.mNumSent++;
+
+exit:
+    return error;
+}
+
+static otError ReceiveBlock(void *aContext, const otMessage *aMessage, uint32_t aPosition, uint16_t aLength, bool aMore)
+{
+    BlockwiseStream &  stream  = *static_cast<BlockwiseStream *>(aContext);
+    const ot::Message &message = *static_cast<const ot::Message *>(aMessage);
+    otError            error   = OT_ERROR_NONE;
+
+    VerifyOrQuit(!stream.mComplete, "block was received after the last one");
+    VerifyOrQuit(aPosition == stream.mReceived, "block was received out of order");
+    VerifyOrQuit(message.GetLength() - message.GetOffset() == aLength, "block length is wrong");
+    VerifyOrExit(aPosition + aLength <= stream.mMaxLength, error = OT_ERROR_NO_BUFS);
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        uint8_t byte;
+
+        message.Read(message.GetOffset() + i, sizeof(byte), &byte);
+        VerifyOrQuit(byte == GetPayloadByte(aPosition + i), "block payload is corrupted");
+    }
+
+    stream.mReceived += aLength;
+    stream.mNumBlocks++;
+    stream.mComplete = !aMore;
+
+exit:
+    return error;
+}
+
+static void HandleBlockwiseResponse(void *               aContext,
+                                    otMessage *          aMessage,
+                                    const otMessageInfo *aMessageInfo,
+                                    otError              aResult)
+{
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    VerifyOrQuit(aContext == &sClientStream, "response handler got the wrong context");
+
+    sResponseResult = aResult;
+    sResponseCode   = (aMessage != NULL) ? static_cast<Coap::Message *>(aMessage)->GetCode() : OT_COAP_CODE_EMPTY;
+    sNumResponses++;
+}
+
+static void HandleBlockwiseRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap &              coap        = *static_cast<TestCoap *>(aContext);
+    Coap::Message &         request     = *static_cast<Coap::Message *>(aMessage);
+    const Ip6::MessageInfo &messageInfo = *static_cast<const Ip6::MessageInfo *>(aMessageInfo);
+    Coap::Message *         response;
+    uint32_t                num;
+    bool                    more;
+    otCoapBlockSize         blockSize;
+
+    sNumRequests++;
+
+    // Requests for the following blocks of the response only carry the Block2 option.
+    if (request.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, blockSize) != OT_ERROR_NONE || num == 0)
+    {
+        VerifyOrExit(coap.ReceiveRequestBlockWise(request, messageInfo, ReceiveBlock, &sServerStream, more) ==
+                     OT_ERROR_NONE);
+        VerifyOrExit(!more);
+    }
+
+    VerifyOrQuit((response = coap.NewMessage()) != NULL, "NewMessage() failed");
+    SuccessOrQuit(response->SetDefaultResponseHeader(request), "SetDefaultResponseHeader() failed");
+    response->SetCode(request.GetCode() == OT_COAP_CODE_GET ? OT_COAP_CODE_CONTENT : OT_COAP_CODE_CHANGED);
+
+    SuccessOrQuit(coap.SendResponseBlockWise(*response, request, messageInfo, sServerBlockSize, TransmitBlock,
+                                             &sServerStream),
+                  "SendResponseBlockWise() failed");
+
+exit:
+    return;
+}
+
+static bool DeliverMessage(TestCoap &aSender, TestCoap &aReceiver)
+{
+    Coap::Message *  message = static_cast<Coap::Message *>(aSender.mOutbox.GetHead());
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit(message != NULL);
+
+    aSender.mOutbox.Dequeue(*message);
+    SuccessOrQuit(message->SetOffset(0), "SetOffset() failed");
+
+    InitMessageInfo(messageInfo, kPeerPort);
+    aReceiver.Receive(*message, messageInfo);
+
+    message->Free();
+
+exit:
+    return message != NULL;
+}
+
+static void DeliverMessages(void)
+{
+    while (DeliverMessage(*sCoap, *sServer) || DeliverMessage(*sServer, *sCoap))
+    {
+    }
+}
+
+static void StartBlockwiseTransfer(Coap::Message::Code aCode,
+                                   otCoapBlockSize     aClientBlockSize,
+                                   otCoapBlockSize     aServerBlockSize,
+                                   uint32_t            aUploadLength,
+                                   uint32_t            aDownloadLength)
+{
+    Coap::Message *  request;
+    Ip6::MessageInfo messageInfo;
+    uint8_t          token[kTokenLength];
+
+    InitBlockwiseStream(sClientStream, aUploadLength);
+    InitBlockwiseStream(sServerStream, aDownloadLength);
+    sServerBlockSize = aServerBlockSize;
+    sNumResponses    = 0;
+    sResponseCode    = OT_COAP_CODE_EMPTY;
+
+    VerifyOrQuit((request = sCoap->NewMessage()) != NULL, "NewMessage() failed");
+
+    GetToken(0x0b10, token);
+    request->Init(OT_COAP_TYPE_CONFIRMABLE, aCode);
+    SuccessOrQuit(request->SetToken(token, sizeof(token)), "SetToken() failed");
+    SuccessOrQuit(request->AppendUriPathOptions("bw"), "AppendUriPathOptions() failed");
+
+    InitMessageInfo(messageInfo, kPeerPort);
+    SuccessOrQuit(sCoap->SendRequestBlockWise(*request, messageInfo, aClientBlockSize,
+                                              (aCode == OT_COAP_CODE_GET) ? NULL : TransmitBlock, ReceiveBlock,
+                                              HandleBlockwiseResponse, &sClientStream),
+                  "SendRequestBlockWise() failed");
+}
+
+static void CheckBlockwiseTransfer(Coap::Message::Code aCode,
+                                   otCoapBlockSize     aClientBlockSize,
+                                   otCoapBlockSize     aServerBlockSize,
+                                   uint32_t            aUploadLength,
+                                   uint32_t            aDownloadLength,
+                                   uint16_t            aNumUploadBlocks,
+                                   uint16_t            aNumDownloadBlocks)
+{
+    StartBlockwiseTransfer(aCode, aClientBlockSize, aServerBlockSize, aUploadLength, aDownloadLength);
+    DeliverMessages();
+
+    VerifyOrQuit(sNumResponses == 1 && sResponseResult == OT_ERROR_NONE, "transfer did not complete");
+    VerifyOrQuit(sResponseCode == (aCode == OT_COAP_CODE_GET ? OT_COAP_CODE_CONTENT : OT_COAP_CODE_CHANGED),
+                 "transfer got the wrong response");
+    VerifyOrQuit(sServerStream.mComplete && sServerStream.mReceived == aUploadLength, "upload is incomplete");
+    VerifyOrQuit(sClientStream.mComplete && sClientStream.mReceived == aDownloadLength, "download is incomplete");
+    VerifyOrQuit(sClientStream.mNumSent == aNumUploadBlocks, "upload has the wrong number of blocks");
+    VerifyOrQuit(sClientStream.mNumBlocks == aNumDownloadBlocks, "download has the wrong number of blocks");
+    VerifyOrQuit(sCoap->GetNumPendingRequests() == 0, "requests are still pending");
+}
+
+void TestCoapBlockwiseTransfer(void)
+{
+    enum
+    {
+        kPoolSize       = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS * OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE,
+        kPayloadLength  = 16000,
+        kPayloadBlocks  = (kPayloadLength + 63) / 64,
+        kResponseBlocks = (kPayloadLength + 255) / 256,
+    };
+
+    Coap::Resource resource("bw", HandleBlockwiseRequest, sServer);
+
+    VerifyOrQuit(kPayloadLength > kPoolSize, "payload fits in the message pool");
+    SuccessOrQuit(sServer->AddResource(resource), "AddResource() failed");
+
+    // The payload does not fit in the message pool, it is only ever held one block at a time.
+    CheckBlockwiseTransfer(OT_COAP_CODE_POST, OT_COAP_BLOCK_SIZE_64, OT_COAP_BLOCK_SIZE_256, kPayloadLength,
+                           kPayloadLength, kPayloadBlocks, kResponseBlocks);
+
+    // The last block may be full, or empty if there is no payload at all.
+    CheckBlockwiseTransfer(OT_COAP_CODE_PUT, OT_COAP_BLOCK_SIZE_64, OT_COAP_BLOCK_SIZE_64, 256, 64, 4, 1);
+    CheckBlockwiseTransfer(OT_COAP_CODE_PUT, OT_COAP_BLOCK_SIZE_64, OT_COAP_BLOCK_SIZE_64, 0, 0, 1, 1);
+
+    // Both sides use the smaller block size of the client and the server.
+    CheckBlockwiseTransfer(OT_COAP_CODE_GET, OT_COAP_BLOCK_SIZE_32, OT_COAP_BLOCK_SIZE_1024, 0, 1000, 0, 32);
+    CheckBlockwiseTransfer(OT_COAP_CODE_GET, OT_COAP_BLOCK_SIZE_1024, OT_COAP_BLOCK_SIZE_16, 0, 1000, 0, 63);
+
+    sServer->ClearRequestsAndResponses();
+    sServer->RemoveResource(resource);
+
+    printf("TestCoapBlockwiseTransfer PASSED\n");
+}
+
+void TestCoapBlockwiseDuplicate(void)
+{
+    Coap::Resource resource("bw", HandleBlockwiseRequest, sServer);
+    Coap::Message *duplicate;
+    uint16_t       numBlocks;
+    uint16_t       numSent;
+
+    SuccessOrQuit(sServer->AddResource(resource), "AddResource() failed");
+
+    StartBlockwiseTransfer(OT_COAP_CODE_POST, OT_COAP_BLOCK_SIZE_16, OT_COAP_BLOCK_SIZE_16, 100, 0);
+
+    VerifyOrQuit((duplicate = static_cast<Coap::Message *>(sCoap->mOutbox.GetHead())) != NULL, "block was not sent");
+    VerifyOrQuit((duplicate = duplicate->Clone()) != NULL, "Clone() failed");
+
+    // The first block goes through, and the next one is sent.
+    VerifyOrQuit(DeliverMessage(*sCoap, *sServer) && DeliverMessage(*sServer, *sCoap), "block was not delivered");
+    VerifyOrQuit(sServerStream.mNumBlocks == 1 && sClientStream.mNumSent == 2, "next block was not sent");
+
+    // A retransmission of the first block gets the cached 2.31 (Continue), which the client ignores.
+    numBlocks = sServerStream.mNumBlocks;
+    numSent   = sServer->mNumSent;
+    SuccessOrQuit(sCoap->mOutbox.Enqueue(*duplicate, MessageQueue::kQueuePositionHead), "Enqueue() failed");
+    VerifyOrQuit(DeliverMessage(*sCoap, *sServer), "duplicate was not delivered");
+    VerifyOrQuit(sServerStream.mNumBlocks == numBlocks, "duplicate block reached the resource");
+    VerifyOrQuit(sServer->mNumSent == numSent + 1 && sServer->mLastSentCode == OT_COAP_CODE_CONTINUE,
+                 "cached response was not sent");
+
+    DeliverMessages();
+
+    VerifyOrQuit(sNumResponses == 1 && sResponseResult == OT_ERROR_NONE, "transfer did not complete");
+    VerifyOrQuit(sServerStream.mComplete && sServerStream.mReceived == 100, "upload is incomplete");
+    VerifyOrQuit(sClientStream.mNumSent == 7 && sServerStream.mNumBlocks == 7, "upload has the wrong number of blocks");
+
+    sServer->ClearRequestsAndResponses();
+    sServer->RemoveResource(resource);
+
+    printf("TestCoapBlockwiseDuplicate PASSED\n");
+}
+
+void TestCoapBlockwiseAbort(void)
+{
+    Coap::Resource resource("bw", HandleBlockwiseRequest, sServer);
+
+    SuccessOrQuit(sServer->AddResource(resource), "AddResource() failed");
+
+    // The server rejects a payload it has no room for, which ends the transfer.
+    StartBlockwiseTransfer(OT_COAP_CODE_POST, OT_COAP_BLOCK_SIZE_64, OT_COAP_BLOCK_SIZE_64, 4000, 0);
+    sServerStream.mMaxLength = 1000;
+    DeliverMessages();
+
+    VerifyOrQuit(sNumResponses == 1 && sResponseResult == OT_ERROR_NONE, "transfer was not ended");
+    VerifyOrQuit(sResponseCode == OT_COAP_CODE_REQUEST_TOO_LARGE, "transfer got the wrong response");
+    VerifyOrQuit(sServerStream.mReceived == 960 && sClientStream.mNumSent == 16, "upload went on after the error");
+    VerifyOrQuit(sCoap->GetNumPendingRequests() == 0, "requests are still pending");
+
+    // The client rejects a payload it has no room for, the response handler gets the error.
+    StartBlockwiseTransfer(OT_COAP_CODE_GET, OT_COAP_BLOCK_SIZE_64, OT_COAP_BLOCK_SIZE_64, 0, 4000);
+    sClientStream.mMaxLength = 1000;
+    DeliverMessages();
+
+    VerifyOrQuit(sNumResponses == 1 && sResponseResult == OT_ERROR_NO_BUFS, "transfer was not ended");
+    VerifyOrQuit(sClientStream.mReceived == 960 && sServerStream.mNumSent == 16, "download went on after the error");
+    VerifyOrQuit(sCoap->GetNumPendingRequests() == 0, "requests are still pending");
+
+    sServer->ClearRequestsAndResponses();
+    sServer->RemoveResource(resource);
+
+    printf("TestCoapBlockwiseAbort PASSED\n");
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != NULL, "Null instance");
+
+    ot::TestCoap coap(*ot::sInstance);
+    ot::sCoap = &coap;
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    ot::TestCoap server(*ot::sInstance);
+    ot::sServer = &server;
+#endif
+
+#if !OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // These keep more confirmable requests outstanding to a peer than NSTART allows.
+    ot::TestCoapResponseMatching();
+    ot::TestCoapResponseMatchingUnindexed();
+#endif
+    ot::TestCoapResponseCache();
+#if !OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    ot::TestCoapResponseMatchingThroughput();
+#endif
+    ot::TestCoapResourceDispatch();
+    ot::TestCoapResourceDispatchUnindexed();
+    ot::TestCoapResourceDispatchDuplicates();
+    ot::TestCoapResourceDispatchThroughput();
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    ot::TestCoapCongestionControl();
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    coap.mPeer   = &server;
+    server.mPeer = &coap;
+
+    ot::TestCoapBlockwiseTransfer();
+    ot::TestCoapBlockwiseDuplicate();
+    ot::TestCoapBlockwiseAbort();
+#endif
+
+    testFreeInstance(ot::sInstance);
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
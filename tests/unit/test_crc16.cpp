@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "common/crc16.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+enum
+{
+    kPerfBufferSize = 1280,  // Buffer length used in throughput test
+    kPerfIteration  = 10000, // Number of buffers processed in throughput test
+};
+
+/**
+ * This function computes a CRC16 bit by bit, as a reference for the table-driven implementation.
+ *
+ */
+static uint16_t ComputeReferenceCrc(uint16_t aPolynomial, const uint8_t *aBuf, uint16_t aLength)
+{
+    uint16_t crc = 0;
+
+    while (aLength--)
+    {
+        crc ^= static_cast<uint16_t>(*aBuf++ << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? (static_cast<uint16_t>(crc << 1) ^ aPolynomial) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+void TestCrc16(void)
+{
+    static const uint8_t kCheckInput[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    ot::Crc16 ccitt(ot::Crc16::kCcitt);
+    ot::Crc16 ansi(ot::Crc16::kAnsi);
+    uint8_t   buf[256];
+
+    printf("Testing Crc16");
+
+    // Standard check values ("123456789"): CRC-16/XMODEM and CRC-16/UMTS.
+    ccitt.Update(kCheckInput, sizeof(kCheckInput));
+    ansi.Update(kCheckInput, sizeof(kCheckInput));
+    VerifyOrQuit(ccitt.Get() == 0x31c3, "Crc16::Update() failed for CCITT\n");
+    VerifyOrQuit(ansi.Get() == 0xfee8, "Crc16::Update() failed for ANSI\n");
+
+    for (uint16_t i = 0; i < sizeof(buf); i++)
+    {
+        buf[i] = static_cast<uint8_t>(rand() & 0xff);
+    }
+
+    // Byte-wise and buffer updates must match the bit-by-bit reference, including when the buffer is split.
+    for (uint16_t length = 0; length <= sizeof(buf); length++)
+    {
+        uint16_t split = length / 3;
+
+        ccitt.Init();
+        ansi.Init();
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            ccitt.Update(buf[i]);
+        }
+
+        ansi.Update(buf, split);
+        ansi.Update(buf + split, length - split);
+
+        VerifyOrQuit(ccitt.Get() == ComputeReferenceCrc(ot::Crc16::kCcitt, buf, length),
+                     "Crc16::Update() failed for CCITT\n");
+        VerifyOrQuit(ansi.Get() == ComputeReferenceCrc(ot::Crc16::kAnsi, buf, length),
+                     "Crc16::Update() failed for ANSI\n");
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestCrc16Performance(void)
+{
+    static uint8_t sBuffer[kPerfBufferSize];
+
+    ot::Crc16 ccitt(ot::Crc16::kCcitt);
+    uint64_t  startTime;
+    uint64_t  referenceDuration;
+    uint64_t  tableDuration;
+    uint32_t  totalLength = static_cast<uint32_t>(kPerfBufferSize) * kPerfIteration;
+    uint16_t  sum         = 0;
+
+    printf("Testing Crc16 throughput\n");
+
+    for (uint16_t i = 0; i < sizeof(sBuffer); i++)
+    {
+        sBuffer[i] = static_cast<uint8_t>(rand() & 0xff);
+    }
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        sum += ComputeReferenceCrc(ot::Crc16::kCcitt, sBuffer, sizeof(sBuffer));
+    }
+
+    referenceDuration = testGetHostTimeUsec() - startTime;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        ccitt.Init();
+        ccitt.Update(sBuffer, sizeof(sBuffer));
+        sum += ccitt.Get();
+    }
+
+    tableDuration = testGetHostTimeUsec() - startTime;
+
+    printf("  bit-by-bit %6.2f ns/byte, table %6.2f ns/byte (sum 0x%04x)\n",
+           (referenceDuration * 1000.0) / totalLength, (tableDuration * 1000.0) / totalLength, sum);
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestCrc16();
+    TestCrc16Performance();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
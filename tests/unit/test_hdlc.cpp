@@ -32,6 +32,7 @@
 #include "common/instance.hpp"
 #include "ncp/hdlc.hpp"
 
+#include "test_platform.h"
 #include "test_util.h"
 
 namespace ot {
@@ -42,6 +43,8 @@ enum
     kBufferSize        = 1500,  // Frame buffer size
     kMaxFrameLength    = 500,   // Maximum allowed frame length (used when randomly generating frames)
     kFuzzTestIteration = 50000, // Number of iteration during fuzz test (randomly generating frames)
+    kPerfFrameLength   = 1280,  // Frame length used in throughput test
+    kPerfIteration     = 2000,  // Number of frames encoded/decoded in throughput test
 
     kFlagXOn        = 0x11,
     kFlagXOff       = 0x13,
@@ -568,6 +571,222 @@ void TestFuzzEncoderDecoder(void)
     printf(" -- PASS\n");
 }
 
+void TestBlockEncoderDecoder(void)
+{
+    uint16_t                       length;
+    uint8_t                        frame[kMaxFrameLength];
+    Hdlc::FrameBuffer<kBufferSize> byteEncoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> blockEncoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize> decoderBuffer;
+    DecoderContext                 decoderContext;
+    Hdlc::Encoder                  byteEncoder(byteEncoderBuffer);
+    Hdlc::Encoder                  blockEncoder(blockEncoderBuffer);
+    Hdlc::Decoder                  decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder block processing against byte processing");
+
+    for (uint32_t iter = 0; iter < kFuzzTestIteration; iter++)
+    {
+        uint16_t offset;
+        uint16_t chunk;
+
+        byteEncoderBuffer.Clear();
+        blockEncoderBuffer.Clear();
+        decoderBuffer.Clear();
+
+        length = static_cast<uint16_t>(GetRandom(kMaxFrameLength));
+
+        // Bias the content towards the bytes which need escaping so that runs of all lengths are covered.
+        for (uint16_t i = 0; i < length; i++)
+        {
+            frame[i] = static_cast<uint8_t>((GetRandom(4) == 0) ? sHdlcSpeicals[GetRandom(sizeof(sHdlcSpeicals))]
+                                                                : GetRandom(256));
+        }
+
+        SuccessOrQuit(byteEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            SuccessOrQuit(byteEncoder.Encode(frame[i]), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(byteEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        SuccessOrQuit(blockEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(blockEncoder.Encode(frame, length), "Encoder::Encode() failed");
+        SuccessOrQuit(blockEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        VerifyOrQuit(blockEncoderBuffer.GetLength() == byteEncoderBuffer.GetLength(),
+                     "Block encoded frame length does not match byte encoded frame");
+        VerifyOrQuit(
+            memcmp(blockEncoderBuffer.GetFrame(), byteEncoderBuffer.GetFrame(), byteEncoderBuffer.GetLength()) == 0,
+            "Block encoded frame content does not match byte encoded frame");
+
+        // Feed the encoded frame to the decoder in randomly sized chunks (so that chunk boundaries fall on escape
+        // sequences and flags).
+        decoderContext.mWasCalled = false;
+
+        for (offset = 0; offset < blockEncoderBuffer.GetLength(); offset += chunk)
+        {
+            chunk = static_cast<uint16_t>(1 + GetRandom(16));
+
+            if (chunk > blockEncoderBuffer.GetLength() - offset)
+            {
+                chunk = blockEncoderBuffer.GetLength() - offset;
+            }
+
+            decoder.Decode(blockEncoderBuffer.GetFrame() + offset, chunk);
+        }
+
+        VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(decoderBuffer.GetLength() == length, "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, length) == 0,
+                     "Decoded frame content does not match original frame");
+    }
+
+    // Test `Encoder` block encoding does not write a partial block when running out of buffer space.
+    byteEncoderBuffer.Clear();
+    memset(frame, 0x55, sizeof(frame));
+    frame[sizeof(frame) - 1] = kFlagSequence;
+
+    SuccessOrQuit(byteEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+    while (byteEncoder.Encode(frame, sizeof(frame)) == OT_ERROR_NONE)
+    {
+    }
+
+    length = byteEncoderBuffer.GetLength();
+    VerifyOrQuit(byteEncoder.Encode(frame, sizeof(frame)) == OT_ERROR_NO_BUFS,
+                 "Encoder::Encode() did not fail with a full buffer");
+    VerifyOrQuit(byteEncoderBuffer.GetLength() == length, "Encoder::Encode() wrote a partial block");
+
+    // Test `Decoder` behavior when the decoded frame does not fit, followed by a good frame.
+    {
+        Hdlc::FrameBuffer<kMaxFrameLength / 2> smallDecoderBuffer;
+        Hdlc::Decoder                          smallDecoder(smallDecoderBuffer, ProcessDecodedFrame, &decoderContext);
+
+        blockEncoderBuffer.Clear();
+        memset(frame, 0x55, sizeof(frame));
+
+        SuccessOrQuit(blockEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(blockEncoder.Encode(frame, sizeof(frame)), "Encoder::Encode() failed");
+        SuccessOrQuit(blockEncoder.EndFrame(), "Encoder::EndFrame() failed");
+        SuccessOrQuit(blockEncoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(blockEncoder.Encode(sMottoText, sizeof(sMottoText) - 1), "Encoder::Encode() failed");
+        SuccessOrQuit(blockEncoder.EndFrame(), "Encoder::EndFrame() failed");
+
+        decoderContext.mWasCalled = false;
+        smallDecoder.Decode(blockEncoderBuffer.GetFrame(), sizeof(frame));
+        VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NO_BUFS, "Decoder::Decode() did not fail with a full buffer");
+
+        smallDecoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        smallDecoder.Decode(blockEncoderBuffer.GetFrame() + sizeof(frame),
+                            blockEncoderBuffer.GetLength() - sizeof(frame));
+        VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+        VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+        VerifyOrQuit(smallDecoderBuffer.GetLength() == sizeof(sMottoText) - 1,
+                     "Decoded frame length does not match original frame");
+        VerifyOrQuit(memcmp(smallDecoderBuffer.GetFrame(), sMottoText, sizeof(sMottoText) - 1) == 0,
+                     "Decoded frame content does not match original frame");
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestEncoderDecoderPerformance(void)
+{
+    uint8_t                            frame[kPerfFrameLength];
+    Hdlc::FrameBuffer<kBufferSize * 2> encoderBuffer;
+    Hdlc::FrameBuffer<kBufferSize * 2> decoderBuffer;
+    DecoderContext                     decoderContext;
+    Hdlc::Encoder                      encoder(encoderBuffer);
+    Hdlc::Decoder                      decoder(decoderBuffer, ProcessDecodedFrame, &decoderContext);
+    uint64_t                           startTime;
+    uint64_t                           byteEncodeDuration;
+    uint64_t                           blockEncodeDuration;
+    uint64_t                           byteDecodeDuration;
+    uint64_t                           blockDecodeDuration;
+    uint16_t                           encodedLength;
+    uint32_t                           totalLength = static_cast<uint32_t>(kPerfFrameLength) * kPerfIteration;
+
+    printf("Testing Hdlc::Encoder and Hdlc::Decoder throughput\n");
+
+    for (uint16_t i = 0; i < kPerfFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(GetRandom(256));
+    }
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+
+        for (uint16_t i = 0; i < kPerfFrameLength; i++)
+        {
+            SuccessOrQuit(encoder.Encode(frame[i]), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+    }
+
+    byteEncodeDuration = testGetHostTimeUsec() - startTime;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        encoderBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(encoder.Encode(frame, kPerfFrameLength), "Encoder::Encode() failed");
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+    }
+
+    blockEncodeDuration = testGetHostTimeUsec() - startTime;
+    encodedLength       = encoderBuffer.GetLength();
+
+    // Decoding the frame one byte per call versus the whole frame in one call.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        decoderBuffer.Clear();
+
+        for (uint16_t i = 0; i < encodedLength; i++)
+        {
+            decoder.Decode(encoderBuffer.GetFrame() + i, sizeof(uint8_t));
+        }
+    }
+
+    byteDecodeDuration = testGetHostTimeUsec() - startTime;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        decoderBuffer.Clear();
+        decoderContext.mWasCalled = false;
+        decoder.Decode(encoderBuffer.GetFrame(), encodedLength);
+    }
+
+    blockDecodeDuration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(decoderContext.mWasCalled, "Decoder::Decode() failed");
+    VerifyOrQuit(decoderContext.mError == OT_ERROR_NONE, "Decoder::Decode() returned incorrect error code");
+    VerifyOrQuit(decoderBuffer.GetLength() == kPerfFrameLength, "Decoded frame length does not match original frame");
+    VerifyOrQuit(memcmp(decoderBuffer.GetFrame(), frame, kPerfFrameLength) == 0,
+                 "Decoded frame content does not match original frame");
+
+    printf("  encode: byte %6.2f ns/byte, block %6.2f ns/byte\n", (byteEncodeDuration * 1000.0) / totalLength,
+           (blockEncodeDuration * 1000.0) / totalLength);
+    printf("  decode: byte %6.2f ns/byte, block %6.2f ns/byte\n", (byteDecodeDuration * 1000.0) / totalLength,
+           (blockDecodeDuration * 1000.0) / totalLength);
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -578,6 +797,8 @@ int main(void)
     ot::Ncp::TestHdlcMultiFrameBuffer();
     ot::Ncp::TestEncoderDecoder();
     ot::Ncp::TestFuzzEncoderDecoder();
+    ot::Ncp::TestBlockEncoderDecoder();
+    ot::Ncp::TestEncoderDecoderPerformance();
     printf("\nAll tests passed.\n");
     return 0;
 }
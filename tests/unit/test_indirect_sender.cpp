@@ -0,0 +1,379 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+enum
+{
+    kMaxChildren     = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    kNumSimChildren  = (kMaxChildren < 200) ? kMaxChildren : 200,
+    kSimQueueDepth   = 3,
+    kSimNumSeconds   = 2000,
+    kSleepyChildMode = Mle::DeviceMode::kModeSecureDataRequest | Mle::DeviceMode::kModeFullNetworkData,
+};
+
+static Instance *sInstance;
+
+static void GetChildAddress(uint8_t aChildIndex, Ip6::Address &aAddress)
+{
+    memset(&aAddress, 0, sizeof(aAddress));
+    aAddress.mFields.m16[0] = HostSwap16(0x2001);
+    aAddress.mFields.m16[1] = HostSwap16(0x0db8);
+    aAddress.mFields.m16[7] = HostSwap16(aChildIndex + 1);
+}
+
+// Adds sleepy children, each with a registered IPv6 address so that `MeshForwarder::SendMessage()` queues
+// messages to the address for indirect transmission to the child.
+static void AddSleepyChildren(uint8_t aNumChildren)
+{
+    ChildTable &table = sInstance->Get<ChildTable>();
+
+    table.Clear();
+
+    for (uint8_t i = 0; i < aNumChildren; i++)
+    {
+        Child *         child = table.GetNewChild();
+        Mac::ExtAddress extAddress;
+        Ip6::Address    address;
+
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[7] = i + 1;
+        GetChildAddress(i, address);
+
+        table.SetChildExtAddress(*child, extAddress);
+        table.SetChildRloc16(*child, 0x1000 + i + 1);
+        child->SetDeviceMode(Mle::DeviceMode(kSleepyChildMode));
+        child->SetState(Neighbor::kStateValid);
+        SuccessOrQuit(child->AddIp6Address(*sInstance, address), "Child::AddIp6Address() failed");
+    }
+}
+
+static Message *SendToChild(uint8_t aChildIndex, uint8_t aPriority)
+{
+    Message *   message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0, aPriority);
+    Ip6::Header header;
+    Child &     child = *sInstance->Get<ChildTable>().GetChildAtIndex(aChildIndex);
+    uint16_t    count = child.GetIndirectMessageCount();
+
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+
+    header.Init();
+    header.SetPayloadLength(0);
+    header.SetNextHeader(Ip6::kProtoUdp);
+    header.SetHopLimit(64);
+    GetChildAddress(aChildIndex, header.GetDestination());
+    SuccessOrQuit(message->Append(&header, sizeof(header)), "Message::Append() failed");
+
+    SuccessOrQuit(sInstance->Get<MeshForwarder>().SendMessage(*message), "MeshForwarder::SendMessage() failed");
+    VerifyOrQuit(message->GetChildMask(aChildIndex), "message was not queued for the child");
+    VerifyOrQuit(!message->GetDirectTransmission(), "message was scheduled for direct transmission");
+    VerifyOrQuit(child.GetIndirectMessageCount() == count + 1, "GetIndirectMessageCount() is incorrect");
+
+    return message;
+}
+
+// Removes a message no longer destined to any child from the send queue (as done after its indirect transmission).
+static void FreeMessage(Message &aMessage)
+{
+    VerifyOrQuit(!aMessage.IsChildPending(), "message is still pending for a child");
+
+    const_cast<PriorityQueue &>(sInstance->Get<MeshForwarder>().GetSendQueue()).Dequeue(aMessage);
+    aMessage.Free();
+}
+
+static uint16_t GetNumQueuedMessages(void)
+{
+    uint16_t count = 0;
+
+    for (const Message *message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead(); message != NULL;
+         message = message->GetNext())
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void TestIndirectSenderQueues(void)
+{
+    ChildTable &    table          = sInstance->Get<ChildTable>();
+    IndirectSender &indirectSender = sInstance->Get<IndirectSender>();
+    uint8_t         numChildren    = (kMaxChildren < 4) ? kMaxChildren : 4;
+    Message *       shared;
+
+    printf("TestIndirectSenderQueues");
+
+    AddSleepyChildren(numChildren);
+
+    // Queue messages of different priorities for all children, and one message for all of them.
+
+    for (uint8_t round = 0; round < 3; round++)
+    {
+        for (uint8_t i = 0; i < numChildren; i++)
+        {
+            SendToChild(i, (round + i) % Message::kNumPriorities);
+        }
+    }
+
+    shared = SendToChild(0, Message::kPriorityNormal);
+
+    for (uint8_t i = 1; i < numChildren; i++)
+    {
+        SuccessOrQuit(indirectSender.AddMessageForSleepyChild(*shared, *table.GetChildAtIndex(i)),
+                      "AddMessageForSleepyChild() failed");
+    }
+
+    VerifyOrQuit(indirectSender.AddMessageForSleepyChild(*shared, *table.GetChildAtIndex(0)) == OT_ERROR_ALREADY,
+                 "AddMessageForSleepyChild() did not fail for a message already queued");
+
+    // Remove the first message of child 1 (not shared with other children).
+
+    for (Message *message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead(); message != NULL;
+         message = message->GetNext())
+    {
+        if (message->GetChildMask(1) && (message != shared))
+        {
+            SuccessOrQuit(indirectSender.RemoveMessageFromSleepyChild(*message, *table.GetChildAtIndex(1)),
+                          "RemoveMessageFromSleepyChild() failed");
+            VerifyOrQuit(indirectSender.RemoveMessageFromSleepyChild(*message, *table.GetChildAtIndex(1)) ==
+                             OT_ERROR_NOT_FOUND,
+                         "RemoveMessageFromSleepyChild() did not fail for a removed message");
+            FreeMessage(*message);
+            break;
+        }
+    }
+
+    VerifyOrQuit(table.GetChildAtIndex(1)->GetIndirectMessageCount() == 3, "GetIndirectMessageCount() is incorrect");
+
+    // Clearing the messages of child 0 frees its own messages and keeps the shared one.
+
+    indirectSender.ClearAllMessagesForSleepyChild(*table.GetChildAtIndex(0));
+    VerifyOrQuit(table.GetChildAtIndex(0)->GetIndirectMessageCount() == 0, "ClearAllMessagesForSleepyChild() failed");
+    VerifyOrQuit(GetNumQueuedMessages() == 3 * numChildren - 3, "ClearAllMessagesForSleepyChild() failed");
+    VerifyOrQuit(!shared->GetChildMask(0) && shared->GetChildMask(1), "ClearAllMessagesForSleepyChild() failed");
+
+    // A mode change to rx-on-when-idle converts the child's messages to direct transmission.
+
+    {
+        Child &         child = *table.GetChildAtIndex(2);
+        Mle::DeviceMode oldMode(child.GetDeviceMode());
+        uint16_t        numDirect = 0;
+
+        child.SetDeviceMode(Mle::DeviceMode(kSleepyChildMode | Mle::DeviceMode::kModeRxOnWhenIdle));
+        indirectSender.HandleChildModeChange(child, oldMode);
+
+        VerifyOrQuit(child.GetIndirectMessageCount() == 0, "HandleChildModeChange() failed");
+
+        for (const Message *message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead(); message != NULL;
+             message = message->GetNext())
+        {
+            VerifyOrQuit(!message->GetChildMask(2), "HandleChildModeChange() did not clear child mask");
+
+            if (message->GetDirectTransmission())
+            {
+                numDirect++;
+            }
+        }
+
+        VerifyOrQuit(numDirect == 4, "HandleChildModeChange() did not convert all messages to direct");
+    }
+
+    // Remove all remaining messages.
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        indirectSender.ClearAllMessagesForSleepyChild(*table.GetChildAtIndex(i));
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == 4, "ClearAllMessagesForSleepyChild() failed");
+
+    while (sInstance->Get<MeshForwarder>().GetSendQueue().GetHead() != NULL)
+    {
+        FreeMessage(*sInstance->Get<MeshForwarder>().GetSendQueue().GetHead());
+    }
+
+    printf(" -- PASS\n");
+}
+
+void TestIndirectSenderQueueOverflow(void)
+{
+    ChildTable &    table          = sInstance->Get<ChildTable>();
+    IndirectSender &indirectSender = sInstance->Get<IndirectSender>();
+    uint8_t         numChildren    = (kMaxChildren < 4) ? kMaxChildren : 4;
+    uint16_t        numMessages    = OPENTHREAD_CONFIG_INDIRECT_QUEUE_ENTRIES / numChildren + 2;
+
+    printf("TestIndirectSenderQueueOverflow");
+
+    AddSleepyChildren(numChildren);
+
+    // Queue more (message, child) pairs than the number of queue entries (sharing each message between all
+    // children), so that the queues of some children overflow.
+
+    for (uint16_t count = 0; count < numMessages; count++)
+    {
+        Message *message = SendToChild(0, Message::kPriorityNormal);
+
+        for (uint8_t i = 1; i < numChildren; i++)
+        {
+            SuccessOrQuit(indirectSender.AddMessageForSleepyChild(*message, *table.GetChildAtIndex(i)),
+                          "AddMessageForSleepyChild() failed");
+        }
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == numMessages, "SendMessage() failed");
+
+    // Remove the first message from all children (overflowed or not), then all messages.
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        Message *message = sInstance->Get<MeshForwarder>().GetSendQueue().GetHead();
+
+        SuccessOrQuit(indirectSender.RemoveMessageFromSleepyChild(*message, *table.GetChildAtIndex(i)),
+                      "RemoveMessageFromSleepyChild() failed");
+        VerifyOrQuit(table.GetChildAtIndex(i)->GetIndirectMessageCount() == numMessages - 1,
+                     "RemoveMessageFromSleepyChild() failed");
+
+        if (!message->IsChildPending())
+        {
+            FreeMessage(*message);
+        }
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == numMessages - 1, "RemoveMessageFromSleepyChild() failed");
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        indirectSender.ClearAllMessagesForSleepyChild(*table.GetChildAtIndex(i));
+        VerifyOrQuit(table.GetChildAtIndex(i)->GetIndirectMessageCount() == 0,
+                     "ClearAllMessagesForSleepyChild() failed");
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == 0, "ClearAllMessagesForSleepyChild() did not free all messages");
+
+    // The queues are usable again after they drained.
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        SendToChild(i, Message::kPriorityNormal);
+        indirectSender.ClearAllMessagesForSleepyChild(*table.GetChildAtIndex(i));
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == 0, "ClearAllMessagesForSleepyChild() did not free all messages");
+
+    printf(" -- PASS\n");
+}
+
+// Simulates sleepy children polling once per second, each with `kSimQueueDepth` messages queued. On every poll
+// the head message of the child is delivered and removed, which makes `IndirectSender` look up the next frame for
+// the child, and a new message for the child arrives.
+void TestIndirectSenderPollPerformance(void)
+{
+    ChildTable &    table          = sInstance->Get<ChildTable>();
+    IndirectSender &indirectSender = sInstance->Get<IndirectSender>();
+    Message *       queued[kNumSimChildren][kSimQueueDepth];
+    uint8_t         head[kNumSimChildren];
+    uint64_t        pollDuration = 0;
+    uint64_t        startTime;
+
+    printf("TestIndirectSenderPollPerformance: %d sleepy children, %d queued messages per child\n", kNumSimChildren,
+           kSimQueueDepth);
+
+    AddSleepyChildren(kNumSimChildren);
+
+    for (uint8_t depth = 0; depth < kSimQueueDepth; depth++)
+    {
+        for (uint8_t i = 0; i < kNumSimChildren; i++)
+        {
+            queued[i][depth] = SendToChild(i, Message::kPriorityNormal);
+        }
+    }
+
+    memset(head, 0, sizeof(head));
+
+    for (uint16_t second = 0; second < kSimNumSeconds; second++)
+    {
+        startTime = testGetHostTimeUsec();
+
+        for (uint8_t i = 0; i < kNumSimChildren; i++)
+        {
+            indirectSender.RemoveMessageFromSleepyChild(*queued[i][head[i]], *table.GetChildAtIndex(i));
+        }
+
+        pollDuration += testGetHostTimeUsec() - startTime;
+
+        for (uint8_t i = 0; i < kNumSimChildren; i++)
+        {
+            FreeMessage(*queued[i][head[i]]);
+            queued[i][head[i]] = SendToChild(i, Message::kPriorityNormal);
+            head[i]            = (head[i] + 1) % kSimQueueDepth;
+        }
+    }
+
+    printf("  %6.3f usec/poll\n", static_cast<double>(pollDuration) / (kSimNumSeconds * kNumSimChildren));
+
+    for (uint8_t i = 0; i < kNumSimChildren; i++)
+    {
+        indirectSender.ClearAllMessagesForSleepyChild(*table.GetChildAtIndex(i));
+    }
+
+    VerifyOrQuit(GetNumQueuedMessages() == 0, "ClearAllMessagesForSleepyChild() did not free all messages");
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != NULL, "Null instance");
+
+    ot::TestIndirectSenderQueues();
+    ot::TestIndirectSenderQueueOverflow();
+    ot::TestIndirectSenderPollPerformance();
+
+    testFreeInstance(ot::sInstance);
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,171 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/key_manager.hpp"
+#include "utils/wrap_string.h"
+
+namespace ot {
+
+enum
+{
+    kKeySize             = 16,   // Size of a MAC or MLE key
+    kFirstKeySequence    = 8,    // First key sequence used in the test
+    kNumKeySequences     = 8,    // Number of key sequences used in the test
+    kFarKeySequence      = 1000, // Key sequence not adjacent to any key sequence used in the test
+    kUncachedKeySequence = 2000, // Key sequence that is never cached
+};
+
+struct DerivedKeys
+{
+    uint8_t mMacKey[kKeySize];
+    uint8_t mMleKey[kKeySize];
+};
+
+static DerivedKeys sReferenceKeys[kNumKeySequences];
+
+static void SetKeySequenceWithoutRotation(KeyManager &aKeyManager, uint32_t aKeySequence)
+{
+    // Jump via an unrelated key sequence so that all keys are derived from scratch.
+    aKeyManager.SetCurrentKeySequence(kFarKeySequence);
+    aKeyManager.SetCurrentKeySequence(aKeySequence);
+}
+
+static const DerivedKeys &GetReferenceKeys(uint32_t aKeySequence)
+{
+    return sReferenceKeys[aKeySequence - kFirstKeySequence];
+}
+
+static void VerifyTemporaryKeys(KeyManager &aKeyManager, uint32_t aKeySequence)
+{
+    const DerivedKeys &keys = GetReferenceKeys(aKeySequence);
+
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMacKey(aKeySequence), keys.mMacKey, kKeySize) == 0,
+                 "KeyManager::GetTemporaryMacKey() returned wrong key");
+    VerifyOrQuit(memcmp(aKeyManager.GetTemporaryMleKey(aKeySequence), keys.mMleKey, kKeySize) == 0,
+                 "KeyManager::GetTemporaryMleKey() returned wrong key");
+}
+
+static void VerifyCurrentKeys(KeyManager &aKeyManager)
+{
+    const DerivedKeys &keys = GetReferenceKeys(aKeyManager.GetCurrentKeySequence());
+
+    VerifyOrQuit(memcmp(aKeyManager.GetCurrentMacKey(), keys.mMacKey, kKeySize) == 0,
+                 "KeyManager::GetCurrentMacKey() returned wrong key");
+    VerifyOrQuit(memcmp(aKeyManager.GetCurrentMleKey(), keys.mMleKey, kKeySize) == 0,
+                 "KeyManager::GetCurrentMleKey() returned wrong key");
+}
+
+void TestKeyManagerKeyCache(void)
+{
+    Instance *  instance = testInitInstance();
+    KeyManager *keyManager;
+    otMasterKey masterKey;
+    DerivedKeys keys;
+    uint32_t    hitCount;
+    uint32_t    missCount;
+
+    VerifyOrQuit(instance != NULL, "Null instance");
+    keyManager = &instance->Get<KeyManager>();
+
+    for (uint32_t i = 0; i < kNumKeySequences; i++)
+    {
+        SetKeySequenceWithoutRotation(*keyManager, kFirstKeySequence + i);
+        memcpy(sReferenceKeys[i].mMacKey, keyManager->GetCurrentMacKey(), kKeySize);
+        memcpy(sReferenceKeys[i].mMleKey, keyManager->GetCurrentMleKey(), kKeySize);
+    }
+
+    // Previous and next key sequences are served from the cache.
+
+    SetKeySequenceWithoutRotation(*keyManager, kFirstKeySequence + 1);
+    hitCount  = keyManager->GetKeyCacheHitCount();
+    missCount = keyManager->GetKeyCacheMissCount();
+
+    VerifyTemporaryKeys(*keyManager, kFirstKeySequence);
+    VerifyTemporaryKeys(*keyManager, kFirstKeySequence + 2);
+    VerifyOrQuit(keyManager->GetKeyCacheHitCount() == hitCount + 4, "Key cache hit count is wrong");
+    VerifyOrQuit(keyManager->GetKeyCacheMissCount() == missCount, "Key cache miss count is wrong");
+
+    // Key rotation shifts the cached keys.
+
+    for (uint32_t keySequence = kFirstKeySequence + 2; keySequence < kFirstKeySequence + kNumKeySequences - 1;
+         keySequence++)
+    {
+        keyManager->SetCurrentKeySequence(keySequence);
+        VerifyOrQuit(keyManager->GetCurrentKeySequence() == keySequence, "SetCurrentKeySequence() failed");
+
+        VerifyCurrentKeys(*keyManager);
+        VerifyTemporaryKeys(*keyManager, keySequence - 1);
+        VerifyTemporaryKeys(*keyManager, keySequence + 1);
+    }
+
+    VerifyOrQuit(keyManager->GetKeyCacheMissCount() == missCount, "Key cache miss count is wrong");
+
+    // Any other key sequence is derived on demand.
+
+    memcpy(keys.mMacKey, keyManager->GetTemporaryMacKey(kUncachedKeySequence), kKeySize);
+    memcpy(keys.mMleKey, keyManager->GetTemporaryMleKey(kUncachedKeySequence), kKeySize);
+    VerifyOrQuit(keyManager->GetKeyCacheMissCount() == missCount + 2, "Key cache miss count is wrong");
+
+    SetKeySequenceWithoutRotation(*keyManager, kUncachedKeySequence);
+    VerifyOrQuit(memcmp(keyManager->GetCurrentMacKey(), keys.mMacKey, kKeySize) == 0, "Uncached MAC key is wrong");
+    VerifyOrQuit(memcmp(keyManager->GetCurrentMleKey(), keys.mMleKey, kKeySize) == 0, "Uncached MLE key is wrong");
+
+    // Changing the master key invalidates the cached keys.
+
+    SetKeySequenceWithoutRotation(*keyManager, kFirstKeySequence + 1);
+    memset(&masterKey, 0xa5, sizeof(masterKey));
+    SuccessOrQuit(keyManager->SetMasterKey(masterKey), "SetMasterKey() failed");
+    VerifyOrQuit(keyManager->GetCurrentKeySequence() == 0, "SetMasterKey() did not reset the key sequence");
+
+    memcpy(keys.mMacKey, keyManager->GetTemporaryMacKey(1), kKeySize);
+    memcpy(keys.mMleKey, keyManager->GetTemporaryMleKey(1), kKeySize);
+
+    SetKeySequenceWithoutRotation(*keyManager, 1);
+    VerifyOrQuit(memcmp(keyManager->GetCurrentMacKey(), keys.mMacKey, kKeySize) == 0, "Cached MAC key is stale");
+    VerifyOrQuit(memcmp(keyManager->GetCurrentMleKey(), keys.mMleKey, kKeySize) == 0, "Cached MLE key is stale");
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestKeyManagerKeyCache();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
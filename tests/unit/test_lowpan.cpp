@@ -1211,6 +1211,91 @@ static void TestUdpFullyCompressedMulticast(void)
     Test(testVector, true, true);
 }
 
+static void TestUdpMleLinkLocal(void)
+{
+    TestIphcVector testVector("UDP MLE between link-local addresses");
+
+    // Setup MAC addresses.
+    testVector.SetMacSource(sTestMacSourceDefaultLong);
+    testVector.SetMacDestination(sTestMacDestinationDefaultLong);
+
+    // Setup IPv6 header.
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 255, "fe80::200:5eef:1022:1100",
+                           "fe80::200:5eef:10aa:bbcc");
+
+    // Setup UDP header.
+    testVector.SetUDPHeader(19788, 19788, sizeof(sTestPayloadDefault) + 8, 0xbeef);
+
+    // Set LOWPAN_IPHC header.
+    uint8_t iphc[] = {0x7f, 0x33, 0xf0, 0x4d, 0x4c, 0x4d, 0x4c, 0xbe, 0xef};
+    testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+    // Set payload and error.
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    testVector.SetPayloadOffset(48);
+    testVector.SetError(OT_ERROR_NONE);
+
+    // Perform compression and decompression tests.
+    Test(testVector, true, true);
+}
+
+static void TestUdpStatefulSource16bitDestination16bitContext0(void)
+{
+    TestIphcVector testVector("UDP with stateful compression source and destination addresses 16-bit, context 0");
+
+    // Setup MAC addresses.
+    testVector.SetMacSource(sTestMacSourceDefaultShort);
+    testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+
+    // Setup IPv6 header.
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 64,
+                           "fd00:cafe:face:1234::ff:fe00:fffc", "fd00:cafe:face:1234::ff:fe00:fffe");
+
+    // Setup UDP header.
+    testVector.SetUDPHeader(5683, 5683, sizeof(sTestPayloadDefault) + 8, 0xbeef);
+
+    // Set LOWPAN_IPHC header.
+    uint8_t iphc[] = {0x7e, 0x66, 0xff, 0xfc, 0xff, 0xfe, 0xf0, 0x16, 0x33, 0x16, 0x33, 0xbe, 0xef};
+    testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+    // Set payload and error.
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    testVector.SetPayloadOffset(48);
+    testVector.SetError(OT_ERROR_NONE);
+
+    // Perform compression and decompression tests.
+    Test(testVector, true, true);
+}
+
+static void TestUdpStatefulSource64bitDestination64bitContext1HopLimitInline(void)
+{
+    TestIphcVector testVector("UDP with stateful compression addresses 64-bit, context 1, hop limit inline");
+
+    // Setup MAC addresses.
+    testVector.SetMacSource(sTestMacSourceDefaultShort);
+    testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+
+    // Setup IPv6 header.
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 32, "2001:2:0:1::1",
+                           "2001:2:0:1::2");
+
+    // Setup UDP header.
+    testVector.SetUDPHeader(5683, 5683, sizeof(sTestPayloadDefault) + 8, 0xbeef);
+
+    // Set LOWPAN_IPHC header.
+    uint8_t iphc[] = {0x7c, 0xd5, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+                      0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x16, 0x33, 0x16, 0x33, 0xbe, 0xef};
+    testVector.SetIphcHeader(iphc, sizeof(iphc));
+
+    // Set payload and error.
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    testVector.SetPayloadOffset(48);
+    testVector.SetError(OT_ERROR_NONE);
+
+    // Perform compression and decompression tests.
+    Test(testVector, true, true);
+}
+
 static void TestUdpWithoutNhc(void)
 {
     TestIphcVector testVector("UDP without LOWPAN_NHC compression");
@@ -1743,6 +1828,119 @@ static void TestErrorReservedNhc6(void)
     Test(testVector, false, true);
 }
 
+/***************************************************************************************************
+ * @section Throughput benchmark.
+ **************************************************************************************************/
+
+static void TestLowpanThroughputForTraffic(const char *aName,
+                                           const char *aSource,
+                                           const char *aDestination,
+                                           uint16_t    aPort,
+                                           bool        aShortMacAddresses)
+{
+    enum
+    {
+        kIterations = 200000,
+    };
+
+    TestIphcVector testVector(aName);
+    Message *      message;
+    uint8_t        frame[127];
+    uint8_t        ip6[512];
+    uint8_t        result[512];
+    uint16_t       ip6Length;
+    uint16_t       frameLength = 0;
+    uint64_t       startTime;
+    uint64_t       compressDuration;
+    uint64_t       decompressDuration;
+
+    if (aShortMacAddresses)
+    {
+        testVector.SetMacSource(sTestMacSourceDefaultShort);
+        testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+    }
+    else
+    {
+        testVector.SetMacSource(sTestMacSourceDefaultLong);
+        testVector.SetMacDestination(sTestMacDestinationDefaultLong);
+    }
+
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault) + 8, Ip6::kProtoUdp, 64, aSource, aDestination);
+    testVector.SetUDPHeader(aPort, aPort, sizeof(sTestPayloadDefault) + 8, 0xbeef);
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    testVector.GetUncompressedStream(ip6, ip6Length);
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL,
+                 "6lo: Ip6::NewMessage failed");
+    testVector.GetUncompressedStream(*message);
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Lowpan::BufferWriter buffer(frame, sizeof(frame));
+
+        SuccessOrQuit(message->SetOffset(0), "6lo: Message::SetOffset failed");
+        SuccessOrQuit(sLowpan->Compress(*message, testVector.mMacSource, testVector.mMacDestination, buffer),
+                      "6lo: Lowpan::Compress failed");
+        frameLength = static_cast<uint16_t>(buffer.GetWritePointer() - frame);
+    }
+
+    compressDuration = testGetHostTimeUsec() - startTime;
+
+    // Decompress the compressed headers, followed by the UDP payload.
+    memcpy(frame + frameLength, sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    message->Free();
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL,
+                 "6lo: Ip6::NewMessage failed");
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        SuccessOrQuit(message->SetLength(0), "6lo: Message::SetLength failed");
+        VerifyOrQuit(sLowpan->Decompress(*message, testVector.mMacSource, testVector.mMacDestination, frame,
+                                         frameLength + sizeof(sTestPayloadDefault), 0) == frameLength,
+                     "6lo: Lowpan::Decompress failed");
+    }
+
+    decompressDuration = testGetHostTimeUsec() - startTime;
+
+    message->Read(0, message->GetLength(), result);
+    memcpy(result + message->GetLength(), sTestPayloadDefault, sizeof(sTestPayloadDefault));
+    VerifyOrQuit(memcmp(ip6, result, ip6Length) == 0, "6lo: Lowpan::Decompress did not restore the packet");
+
+    message->Free();
+
+    printf("%-12s %2d-byte header: compress %9.0f ops/sec, decompress %9.0f ops/sec\n", aName, frameLength,
+           kIterations * 1000000.0 / compressDuration, kIterations * 1000000.0 / decompressDuration);
+}
+
+void TestLowpanThroughput(void)
+{
+    sInstance = testInitInstance();
+
+    VerifyOrQuit(sInstance != NULL, "NULL instance");
+
+    sLowpan = &sInstance->Get<Lowpan::Lowpan>();
+
+    Init();
+
+    printf("\n=== Lowpan throughput (UDP datagrams) ===\n\n");
+
+    TestLowpanThroughputForTraffic("Mesh-local", "fd00:cafe:face:1234::ff:fe00:0", "fd00:cafe:face:1234::ff:fe00:c003",
+                                   5683, true);
+    TestLowpanThroughputForTraffic("Link-local", "fe80::200:5eef:1022:1100", "fe80::200:5eef:10aa:bbcc", 5683, false);
+    TestLowpanThroughputForTraffic("MLE", "fe80::200:5eef:1022:1100", "fe80::200:5eef:10aa:bbcc", 19788, false);
+    TestLowpanThroughputForTraffic("Global", "2001:2:0:1::1", "2001:2:0:1::2", 5683, false);
+    TestLowpanThroughputForTraffic("Multicast", "fe80::200:5eef:1022:1100", "ff02::1", 19788, false);
+
+    printf("\n");
+
+    testFreeInstance(sInstance);
+}
+
 /***************************************************************************************************
  * @section Main test.
  **************************************************************************************************/
@@ -1808,6 +2006,9 @@ void TestLowpanIphc(void)
     TestUdpSource8bitDestinationInline();
     TestUdpFullyCompressed();
     TestUdpFullyCompressedMulticast();
+    TestUdpMleLinkLocal();
+    TestUdpStatefulSource16bitDestination16bitContext0();
+    TestUdpStatefulSource64bitDestination64bitContext1HopLimitInline();
     TestUdpWithoutNhc();
 
     // Extension Headers compression / decompression tests.
@@ -1845,6 +2046,7 @@ void TestLowpanIphc(void)
 int main(void)
 {
     TestLowpanIphc();
+    TestLowpanThroughput();
 
     printf("All tests passed\n");
     return 0;
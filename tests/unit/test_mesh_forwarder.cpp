@@ -0,0 +1,434 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/timer.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "mac/mac.hpp"
+#include "mac/mac_frame.hpp"
+#include "thread/key_manager.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+enum
+{
+    kPanId             = 0x1234,
+    kDatagramTag       = 0x5a5a,
+    kHeaderSize        = 48, ///< Uncompressed IPv6 and UDP headers.
+    kDatagramSize      = kHeaderSize + 164,
+    kFragmentSize      = 64,
+    kNumFragments      = (kDatagramSize + kFragmentSize - 1) / kFragmentSize,
+    kReassemblyMsec    = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT * 1000,
+    kReassemblyEntries = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES,
+};
+
+// LOWPAN_IPHC for link-local addresses derived from the MAC addresses, hop limit 255, followed by a
+// LOWPAN_NHC UDP header with the MLE ports inline.
+static const uint8_t kIphc[] = {0x7f, 0x33, 0xf0, 0x4d, 0x4c, 0x4d, 0x4c, 0x00, 0x00};
+
+static Instance *sInstance;
+static uint32_t  sNow;
+static uint16_t  sNumReceived;
+static uint16_t  sNumCorrupted;
+static uint16_t  sDatagramSize;
+static bool      sLinkSecurity;
+static uint32_t  sFrameCounter;
+
+static uint32_t TestGetNow(void)
+{
+    return sNow;
+}
+
+static uint8_t GetDatagramByte(uint8_t aSourceIndex, uint16_t aOffset)
+{
+    return static_cast<uint8_t>(aOffset * 7 + aSourceIndex);
+}
+
+static void HandleReceive(otMessage *aMessage, void *aContext)
+{
+    Message &message = *static_cast<Message *>(aMessage);
+    uint8_t  sourceIndex;
+    uint8_t  byte;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    sNumReceived++;
+
+    // The last byte of the source IID identifies the sender.
+    message.Read(Ip6::Header::GetDestinationOffset() - 1, sizeof(sourceIndex), &sourceIndex);
+
+    if (message.GetLength() != sDatagramSize || message.IsLinkSecurityEnabled() != sLinkSecurity)
+    {
+        sNumCorrupted++;
+    }
+    else
+    {
+        for (uint16_t offset = kHeaderSize; offset < sDatagramSize; offset++)
+        {
+            message.Read(offset, sizeof(byte), &byte);
+
+            if (byte != GetDatagramByte(sourceIndex, offset))
+            {
+                sNumCorrupted++;
+                break;
+            }
+        }
+    }
+
+    message.Free();
+}
+
+static void GetSource(uint8_t aSourceIndex, Mac::ExtAddress &aSource)
+{
+    memset(&aSource, 0, sizeof(aSource));
+    aSource.m8[0] = 0x12;
+    aSource.m8[7] = aSourceIndex;
+}
+
+// Secures the frame with key id mode 0, which the receiver accepts from a sender that is not a neighbor.
+static void SecureFrame(Mac::RxFrame &aFrame, const Mac::ExtAddress &aSource)
+{
+    uint8_t        nonce[Mac::kNonceSize];
+    uint8_t        tagLength = aFrame.GetFooterLength() - Mac::Frame::kFcsSize;
+    Crypto::AesCcm aesCcm;
+
+    aFrame.SetFrameCounter(sFrameCounter);
+
+    memcpy(nonce, aSource.m8, sizeof(aSource.m8));
+    nonce[8]  = static_cast<uint8_t>(sFrameCounter >> 24);
+    nonce[9]  = static_cast<uint8_t>(sFrameCounter >> 16);
+    nonce[10] = static_cast<uint8_t>(sFrameCounter >> 8);
+    nonce[11] = static_cast<uint8_t>(sFrameCounter);
+    nonce[12] = Mac::Frame::kSecEncMic32;
+    sFrameCounter++;
+
+    aesCcm.SetKey(sInstance->Get<KeyManager>().GetKek(), KeyManager::kMaxKeyLength,
+                  sInstance->Get<KeyManager>().GetKeyScheduleCache());
+    SuccessOrQuit(aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce)),
+                  "AesCcm::Init() failed");
+    aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
+    aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), true);
+    aesCcm.Finalize(aFrame.GetFooter(), &tagLength);
+}
+
+// Receives the fragment of the datagram at `aOffset` (a multiple of `kFragmentSize`), spanning `aNumFragments`.
+//
+// The datagram is `sDatagramSize` bytes long and sent with link security when `sLinkSecurity` is set.
+static void ReceiveFragment(uint8_t aSourceIndex, uint16_t aOffset, uint8_t aNumFragments = 1)
+{
+    uint8_t         psdu[Mac::Frame::kMTU];
+    Mac::RxFrame    frame;
+    Mac::ExtAddress source;
+    uint8_t *       payload;
+    uint16_t        end = aOffset + aNumFragments * kFragmentSize;
+    uint16_t        length;
+    uint16_t        fcf;
+    uint8_t         secCtl;
+
+    if (end > sDatagramSize)
+    {
+        end = sDatagramSize;
+    }
+
+    fcf = Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfPanidCompression |
+          Mac::Frame::kFcfDstAddrExt | Mac::Frame::kFcfSrcAddrExt;
+    secCtl = Mac::Frame::kSecNone;
+
+    if (sLinkSecurity)
+    {
+        fcf |= Mac::Frame::kFcfSecurityEnabled;
+        secCtl = Mac::Frame::kKeyIdMode0 | Mac::Frame::kSecEncMic32;
+    }
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu    = psdu;
+    frame.mChannel = 11;
+
+    GetSource(aSourceIndex, source);
+
+    frame.InitMacHeader(fcf, secCtl);
+    frame.SetDstPanId(kPanId);
+    frame.SetDstAddr(sInstance->Get<Mac::Mac>().GetExtAddress());
+    frame.SetSrcAddr(source);
+
+    payload = frame.GetPayload();
+
+    if (aOffset == 0)
+    {
+        payload[0] = 0xc0 | (sDatagramSize >> 8);
+        payload[1] = sDatagramSize & 0xff;
+        payload[2] = kDatagramTag >> 8;
+        payload[3] = kDatagramTag & 0xff;
+        memcpy(payload + 4, kIphc, sizeof(kIphc));
+        length  = 4 + sizeof(kIphc);
+        aOffset = kHeaderSize;
+    }
+    else
+    {
+        payload[0] = 0xe0 | (sDatagramSize >> 8);
+        payload[1] = sDatagramSize & 0xff;
+        payload[2] = kDatagramTag >> 8;
+        payload[3] = kDatagramTag & 0xff;
+        payload[4] = static_cast<uint8_t>(aOffset / 8);
+        length     = 5;
+    }
+
+    for (uint16_t offset = aOffset; offset < end; offset++)
+    {
+        payload[length++] = GetDatagramByte(aSourceIndex, offset);
+    }
+
+    frame.SetPayloadLength(length);
+
+    if (sLinkSecurity)
+    {
+        SecureFrame(frame, source);
+    }
+
+    otPlatRadioReceiveDone(sInstance, &frame, OT_ERROR_NONE);
+}
+
+static uint16_t GetNumReassemblyMessages(void)
+{
+    uint16_t numMessages;
+    uint16_t numBuffers;
+
+    sInstance->Get<MeshForwarder>().GetReassemblyQueue().GetInfo(numMessages, numBuffers);
+
+    return numMessages;
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    sNow += aDuration;
+
+    while (g_testPlatAlarmSet && !TimerScheduler::IsStrictlyBefore(sNow, g_testPlatAlarmNext))
+    {
+        otPlatAlarmMilliFired(sInstance);
+    }
+}
+
+static void ResetCounters(void)
+{
+    sNumReceived  = 0;
+    sNumCorrupted = 0;
+    sDatagramSize = kDatagramSize;
+    sLinkSecurity = false;
+}
+
+void TestReassemblyInOrder(void)
+{
+    ResetCounters();
+
+    for (uint8_t i = 0; i < kNumFragments; i++)
+    {
+        VerifyOrQuit(sNumReceived == 0, "datagram delivered before all fragments were received");
+        ReceiveFragment(1, i * kFragmentSize);
+    }
+
+    VerifyOrQuit(sNumReceived == 1 && sNumCorrupted == 0, "in-order reassembly failed");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly list not empty");
+}
+
+void TestReassemblyOutOfOrder(void)
+{
+    ResetCounters();
+
+    ReceiveFragment(1, 0);
+    ReceiveFragment(1, 2 * kFragmentSize);
+    ReceiveFragment(1, 3 * kFragmentSize);
+    VerifyOrQuit(sNumReceived == 0 && GetNumReassemblyMessages() == 1, "datagram delivered with a missing fragment");
+
+    ReceiveFragment(1, kFragmentSize);
+    VerifyOrQuit(sNumReceived == 1 && sNumCorrupted == 0, "out-of-order reassembly failed");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly list not empty");
+}
+
+void TestReassemblyDuplicates(void)
+{
+    ResetCounters();
+
+    ReceiveFragment(1, 0);
+    ReceiveFragment(1, kFragmentSize);
+
+    // Repeated first and subsequent fragments, and a fragment overlapping a received one.
+    ReceiveFragment(1, 0);
+    ReceiveFragment(1, kFragmentSize);
+    ReceiveFragment(1, kFragmentSize, 2);
+    VerifyOrQuit(sNumReceived == 0 && GetNumReassemblyMessages() == 1, "duplicate fragment was not rejected");
+
+    ReceiveFragment(1, 2 * kFragmentSize);
+    ReceiveFragment(1, 3 * kFragmentSize);
+    VerifyOrQuit(sNumReceived == 1 && sNumCorrupted == 0, "reassembly with duplicates failed");
+
+    // Fragments of a completed datagram are dropped.
+    ReceiveFragment(1, 3 * kFragmentSize);
+    VerifyOrQuit(sNumReceived == 1 && GetNumReassemblyMessages() == 0, "fragment of a completed datagram accepted");
+}
+
+void TestReassemblyInterleaved(void)
+{
+    ResetCounters();
+
+    // Senders reusing the same datagram tag are reassembled separately.
+    for (uint8_t source = 1; source <= kReassemblyEntries; source++)
+    {
+        ReceiveFragment(source, 0);
+    }
+
+    VerifyOrQuit(GetNumReassemblyMessages() == kReassemblyEntries, "first fragments not queued");
+
+    // No more entries are available.
+    ReceiveFragment(kReassemblyEntries + 1, 0);
+    VerifyOrQuit(GetNumReassemblyMessages() == kReassemblyEntries, "reassembly table overflowed");
+
+    for (uint8_t i = 1; i < kNumFragments; i++)
+    {
+        for (uint8_t source = kReassemblyEntries; source >= 1; source--)
+        {
+            ReceiveFragment(source, i * kFragmentSize);
+        }
+    }
+
+    VerifyOrQuit(sNumReceived == kReassemblyEntries && sNumCorrupted == 0, "interleaved reassembly failed");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly list not empty");
+}
+
+void TestReassemblyTimeout(void)
+{
+    const otIpCounters *counters = otThreadGetIp6Counters(sInstance);
+    uint32_t            rxFailure;
+
+    ResetCounters();
+    rxFailure = counters->mRxFailure;
+
+    ReceiveFragment(1, 0);
+    AdvanceTime(kReassemblyMsec / 2);
+    ReceiveFragment(2, 0);
+
+    // Each fragment restarts the timeout of its datagram only.
+    AdvanceTime(kReassemblyMsec / 4);
+    ReceiveFragment(1, kFragmentSize);
+
+    AdvanceTime(kReassemblyMsec * 3 / 4);
+    VerifyOrQuit(GetNumReassemblyMessages() == 1, "datagram did not time out");
+    VerifyOrQuit(counters->mRxFailure == rxFailure + 1, "timeout was not counted");
+
+    AdvanceTime(kReassemblyMsec / 4);
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "datagram did not time out");
+    VerifyOrQuit(counters->mRxFailure == rxFailure + 2, "timeout was not counted");
+
+    // A late fragment of a timed out datagram is dropped.
+    ReceiveFragment(1, 2 * kFragmentSize);
+    ReceiveFragment(1, 3 * kFragmentSize);
+    VerifyOrQuit(sNumReceived == 0 && GetNumReassemblyMessages() == 0, "fragment of a timed out datagram accepted");
+}
+
+static void ReceiveRemainingFragments(uint8_t aSourceIndex)
+{
+    for (uint16_t offset = kFragmentSize; offset < sDatagramSize; offset += kFragmentSize)
+    {
+        ReceiveFragment(aSourceIndex, offset);
+    }
+}
+
+void TestReassemblyTagReuse(void)
+{
+    const otIpCounters *counters = otThreadGetIp6Counters(sInstance);
+    uint32_t            rxFailure;
+
+    ResetCounters();
+    rxFailure = counters->mRxFailure;
+
+    // A first fragment reusing the tag with another datagram size replaces the datagram being reassembled.
+    ReceiveFragment(1, 0);
+    ReceiveFragment(1, kFragmentSize);
+    sDatagramSize = kDatagramSize - 8;
+    ReceiveFragment(1, 0);
+    VerifyOrQuit(GetNumReassemblyMessages() == 1, "stale datagram was not dropped on tag reuse");
+    VerifyOrQuit(counters->mRxFailure == rxFailure + 1, "dropped datagram was not counted");
+
+    ReceiveRemainingFragments(1);
+    VerifyOrQuit(sNumReceived == 1 && sNumCorrupted == 0, "reassembly after tag reuse with another size failed");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly list not empty");
+
+    // Same with another link security setting.
+    ResetCounters();
+    ReceiveFragment(1, 0);
+    sLinkSecurity = true;
+    ReceiveFragment(1, 0);
+    VerifyOrQuit(GetNumReassemblyMessages() == 1, "stale datagram was not dropped on tag reuse");
+    VerifyOrQuit(counters->mRxFailure == rxFailure + 2, "dropped datagram was not counted");
+
+    ReceiveRemainingFragments(1);
+    VerifyOrQuit(sNumReceived == 1 && sNumCorrupted == 0, "reassembly after tag reuse with link security failed");
+    VerifyOrQuit(GetNumReassemblyMessages() == 0, "reassembly list not empty");
+
+    ResetCounters();
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::sNow              = 10000;
+    g_testPlatAlarmGetNow = ot::TestGetNow;
+
+    ot::sInstance = testInitInstance();
+    VerifyOrQuit(ot::sInstance != NULL, "Null instance");
+
+    SuccessOrQuit(otLinkSetPanId(ot::sInstance, ot::kPanId), "otLinkSetPanId() failed");
+    SuccessOrQuit(otIp6SetEnabled(ot::sInstance, true), "otIp6SetEnabled() failed");
+    otIp6SetReceiveCallback(ot::sInstance, ot::HandleReceive, NULL);
+
+    ot::TestReassemblyInOrder();
+    ot::TestReassemblyOutOfOrder();
+    ot::TestReassemblyDuplicates();
+    ot::TestReassemblyInterleaved();
+    ot::TestReassemblyTimeout();
+    ot::TestReassemblyTagReuse();
+
+    testFreeInstance(ot::sInstance);
+
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -63,10 +63,518 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChunks(void)
+{
+    ot::Instance *             instance;
+    ot::MessagePool *          messagePool;
+    ot::Message *              message;
+    ot::Message *              messageCopy;
+    ot::Message::Chunk         chunk;
+    ot::Message::WritableChunk writableChunk;
+    uint8_t                    writeBuffer[1280];
+    uint8_t                    readBuffer[1280];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned iteration = 0; iteration < 200; iteration++)
+    {
+        uint16_t reserved = static_cast<uint16_t>(random() % 128);
+        uint16_t length   = static_cast<uint16_t>(1 + random() % sizeof(writeBuffer));
+        uint16_t offset   = static_cast<uint16_t>(random() % length);
+        uint16_t count    = static_cast<uint16_t>(random() % (sizeof(writeBuffer) + 1));
+        uint16_t bytesRead;
+        uint16_t remaining;
+
+        for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+        {
+            writeBuffer[i] = static_cast<uint8_t>(random());
+        }
+
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, reserved)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(length), "Message::SetLength failed\n");
+        VerifyOrQuit(message->Write(0, length, writeBuffer) == length, "Message::Write failed\n");
+
+        // Chunks cover the requested range (limited to the message end) in order.
+        bytesRead = 0;
+        remaining = count;
+
+        for (message->GetFirstChunk(offset, remaining, chunk); chunk.GetLength() > 0;
+             message->GetNextChunk(remaining, chunk))
+        {
+            memcpy(readBuffer + bytesRead, chunk.GetData(), chunk.GetLength());
+            bytesRead += chunk.GetLength();
+        }
+
+        VerifyOrQuit(remaining == 0, "Message::GetNextChunk() did not consume the length\n");
+        VerifyOrQuit(bytesRead == ((count < length - offset) ? count : length - offset),
+                     "Message chunks have incorrect total length\n");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, bytesRead) == 0, "Message chunks content failed\n");
+        VerifyOrQuit(message->Read(offset, count, readBuffer) == bytesRead, "Message::Read failed\n");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, bytesRead) == 0, "Message::Read content failed\n");
+
+        // Writable chunks modify the message in place.
+        remaining = count;
+
+        for (message->GetFirstChunk(offset, remaining, writableChunk); writableChunk.GetLength() > 0;
+             message->GetNextChunk(remaining, writableChunk))
+        {
+            for (uint16_t i = 0; i < writableChunk.GetLength(); i++)
+            {
+                writableChunk.GetData()[i] ^= 0xff;
+            }
+        }
+
+        VerifyOrQuit(message->Read(offset, count, readBuffer) == bytesRead, "Message::Read failed\n");
+
+        for (uint16_t i = 0; i < bytesRead; i++)
+        {
+            VerifyOrQuit(readBuffer[i] == static_cast<uint8_t>(writeBuffer[offset + i] ^ 0xff),
+                         "Message writable chunk failed\n");
+        }
+
+        VerifyOrQuit(message->Write(offset, bytesRead, writeBuffer + offset) == bytesRead, "Message::Write failed\n");
+
+        // Copy to another message with a different reserved header, so that the buffer boundaries differ.
+        reserved = static_cast<uint16_t>(random() % 128);
+        VerifyOrQuit((messageCopy = messagePool->New(ot::Message::kTypeIp6, reserved)) != NULL,
+                     "Message::New failed\n");
+        SuccessOrQuit(messageCopy->SetLength(length), "Message::SetLength failed\n");
+        VerifyOrQuit(message->CopyTo(offset, 0, length - offset, *messageCopy) == length - offset,
+                     "Message::CopyTo failed\n");
+        VerifyOrQuit(messageCopy->Read(0, length - offset, readBuffer) == length - offset, "Message::Read failed\n");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, length - offset) == 0,
+                     "Message::CopyTo content failed\n");
+        messageCopy->Free();
+
+        // Copy within the same message towards its start (as done when inserting the MPL option).
+        VerifyOrQuit(message->CopyTo(offset, 0, length - offset, *message) == length - offset,
+                     "Message::CopyTo failed\n");
+        VerifyOrQuit(message->Read(0, length - offset, readBuffer) == length - offset, "Message::Read failed\n");
+        VerifyOrQuit(memcmp(readBuffer, writeBuffer + offset, length - offset) == 0,
+                     "Message::CopyTo content failed\n");
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+// Reference byte-at-a-time checksum, `aPosition` is the position of `aBuf` within the checksummed data.
+static void VerifyMessageContent(const ot::Message &aMessage, const uint8_t *aContent, uint16_t aLength)
+{
+    uint8_t            readBuffer[1500];
+    ot::Message::Chunk chunk;
+    uint16_t           length = aLength;
+    uint16_t           offset = 0;
+
+    VerifyOrQuit(aMessage.GetLength() == aLength, "Message::GetLength failed\n");
+    VerifyOrQuit(aMessage.Read(0, aLength, readBuffer) == aLength, "Message::Read failed\n");
+    VerifyOrQuit(memcmp(readBuffer, aContent, aLength) == 0, "Message content does not match\n");
+
+    for (aMessage.GetFirstChunk(0, length, chunk); chunk.GetLength() > 0; aMessage.GetNextChunk(length, chunk))
+    {
+        VerifyOrQuit(memcmp(chunk.GetData(), aContent + offset, chunk.GetLength()) == 0, "Chunk content mismatch\n");
+        offset += chunk.GetLength();
+    }
+
+    VerifyOrQuit(offset == aLength, "Chunks do not cover the message\n");
+}
+
+void TestMessageBufferPool(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    ot::Message *    fillers[ot::kNumBuffers + ot::kNumLargeBuffers];
+    uint16_t         numFillers = 0;
+    uint16_t         freeBuffers;
+    uint16_t         freeLargeBuffers;
+    uint16_t         failedAllocations;
+    uint8_t          content[1280];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(content); i++)
+    {
+        content[i] = static_cast<uint8_t>(random());
+    }
+
+    freeBuffers      = messagePool->GetFreeBufferCount();
+    freeLargeBuffers = messagePool->GetFreeLargeBufferCount();
+
+    VerifyOrQuit(freeBuffers == ot::kNumBuffers, "GetFreeBufferCount failed\n");
+    VerifyOrQuit(freeLargeBuffers == ot::kNumLargeBuffers, "GetFreeLargeBufferCount failed\n");
+
+    // A long message is chained across the buffer classes, the buffer
+    // pool statistics track the buffers in use.
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(content + 200, sizeof(content) - 200), "Message::Append failed\n");
+    SuccessOrQuit(message->Prepend(content, 200), "Message::Prepend failed\n");
+    VerifyMessageContent(*message, content, sizeof(content));
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() + messagePool->GetFreeLargeBufferCount() +
+                         message->GetBufferCount() ==
+                     freeBuffers + freeLargeBuffers,
+                 "Buffer accounting failed\n");
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() >= freeBuffers - messagePool->GetFreeBufferCount(),
+                 "GetMaxUsedBufferCount failed\n");
+
+    if (ot::kNumLargeBuffers > 0)
+    {
+        VerifyOrQuit(messagePool->GetFreeLargeBufferCount() < freeLargeBuffers, "Large buffers were not used\n");
+        VerifyOrQuit(messagePool->GetMaxUsedLargeBufferCount() > 0, "GetMaxUsedLargeBufferCount failed\n");
+    }
+
+    SuccessOrQuit(message->SetLength(100), "Message::SetLength failed\n");
+    VerifyMessageContent(*message, content, 100);
+    message->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers, "Buffers were not freed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == freeLargeBuffers, "Large buffers were not freed\n");
+
+    // Prepending to a message when the small buffers are exhausted
+    // uses buffers from the other class (if any).
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(content + 600, 300), "Message::Append failed\n");
+
+    while (messagePool->GetFreeBufferCount() > 0)
+    {
+        VerifyOrQuit((fillers[numFillers] = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL,
+                     "Message::New failed\n");
+        numFillers++;
+    }
+
+    if (ot::kNumLargeBuffers > 0)
+    {
+        uint16_t fallbackAllocations = messagePool->GetFallbackAllocationCount();
+
+        SuccessOrQuit(message->Prepend(content, 600), "Message::Prepend failed\n");
+        VerifyMessageContent(*message, content, 900);
+        VerifyOrQuit(messagePool->GetFallbackAllocationCount() > fallbackAllocations,
+                     "GetFallbackAllocationCount failed\n");
+    }
+
+    // Allocating once all buffers are in use fails and is counted.
+
+    while (messagePool->GetFreeBufferCount() + messagePool->GetFreeLargeBufferCount() > 0)
+    {
+        VerifyOrQuit((fillers[numFillers] = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL,
+                     "Message::New failed\n");
+        numFillers++;
+    }
+
+    failedAllocations = messagePool->GetFailedAllocationCount();
+    VerifyOrQuit(messagePool->New(ot::Message::kTypeIp6, 0) == NULL, "Message::New did not fail\n");
+    VerifyOrQuit(messagePool->GetFailedAllocationCount() == failedAllocations + 1, "GetFailedAllocationCount failed\n");
+    VerifyOrQuit(messagePool->GetMaxUsedBufferCount() == ot::kNumBuffers, "GetMaxUsedBufferCount failed\n");
+    VerifyOrQuit(messagePool->GetMaxUsedLargeBufferCount() == ot::kNumLargeBuffers,
+                 "GetMaxUsedLargeBufferCount failed\n");
+
+    while (numFillers > 0)
+    {
+        fillers[--numFillers]->Free();
+    }
+
+    message->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers, "Buffers were not freed\n");
+    VerifyOrQuit(messagePool->GetFreeLargeBufferCount() == freeLargeBuffers, "Large buffers were not freed\n");
+
+    // Growing a message within the spare room of its large buffer
+    // needs no free buffers, even once all buffers are in use.
+
+    if (ot::kNumLargeBuffers > 0)
+    {
+        // Data following the head buffer which does not fit in a small buffer goes in a large one, which then
+        // has room for more than a small buffer of data.
+        const uint16_t length    = 2 * ot::kBufferSize;
+        const uint16_t maxLength = 3 * ot::kBufferSize;
+
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->Append(content, length), "Message::Append failed\n");
+        VerifyOrQuit(message->GetBufferCount() == 2, "Large buffer was not used\n");
+
+        while (messagePool->GetFreeBufferCount() + messagePool->GetFreeLargeBufferCount() > 0)
+        {
+            VerifyOrQuit((fillers[numFillers] = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL,
+                         "Message::New failed\n");
+            numFillers++;
+        }
+
+        SuccessOrQuit(message->SetLength(maxLength), "Message::SetLength failed\n");
+        VerifyOrQuit(message->GetBufferCount() == 2, "Message::SetLength allocated a buffer\n");
+        SuccessOrQuit(message->SetLength(length), "Message::SetLength failed\n");
+        VerifyMessageContent(*message, content, length);
+
+        while (numFillers > 0)
+        {
+            fillers[--numFillers]->Free();
+        }
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+static uint16_t ReferenceChecksum(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength, uint16_t aPosition)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        uint16_t value = ((aPosition + i) & 1) ? aBuf[i] : static_cast<uint16_t>(aBuf[i] << 8);
+
+        aChecksum = ot::Message::UpdateChecksum(aChecksum, value);
+    }
+
+    return aChecksum;
+}
+
+void TestMessageChecksum(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          buffer[1280 + sizeof(uint32_t)];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Flat buffers, all alignments and lengths (including odd ones).
+    for (uint16_t start = 0; start < sizeof(uint32_t); start++)
+    {
+        for (uint16_t length = 0; length <= 128; length++)
+        {
+            uint16_t checksum = static_cast<uint16_t>(random());
+
+            VerifyOrQuit(ot::Message::UpdateChecksum(checksum, buffer + start, length) ==
+                             ReferenceChecksum(checksum, buffer + start, length, 0),
+                         "Message::UpdateChecksum() failed on flat buffer\n");
+        }
+    }
+
+    VerifyOrQuit(ot::Message::UpdateChecksum(0, buffer, 1280) == ReferenceChecksum(0, buffer, 1280, 0),
+                 "Message::UpdateChecksum() failed on flat buffer\n");
+
+    memset(buffer, 0xff, sizeof(buffer));
+    VerifyOrQuit(ot::Message::UpdateChecksum(0xffff, buffer, 1280) == ReferenceChecksum(0xffff, buffer, 1280, 0),
+                 "Message::UpdateChecksum() failed on all ones buffer\n");
+
+    memset(buffer, 0, sizeof(buffer));
+    VerifyOrQuit(ot::Message::UpdateChecksum(0, buffer, 1280) == 0,
+                 "Message::UpdateChecksum() failed on zero buffer\n");
+
+    // Random buffer chains, with random reserved header and offset so that segments start at odd positions.
+    for (unsigned iteration = 0; iteration < 1000; iteration++)
+    {
+        uint16_t reserved = static_cast<uint16_t>(random() % 128);
+        uint16_t length   = static_cast<uint16_t>(1 + random() % 1280);
+        uint16_t offset   = static_cast<uint16_t>(random() % length);
+        uint16_t count    = static_cast<uint16_t>(random() % (length - offset + 1));
+        uint16_t checksum = static_cast<uint16_t>(random());
+
+        for (unsigned i = 0; i < length; i++)
+        {
+            buffer[i] = static_cast<uint8_t>(random());
+        }
+
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, reserved)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(length), "Message::SetLength failed\n");
+        VerifyOrQuit(message->Write(0, length, buffer) == length, "Message::Write failed\n");
+
+        VerifyOrQuit(message->UpdateChecksum(checksum, offset, count) ==
+                         ReferenceChecksum(checksum, buffer + offset, count, 0),
+                     "Message::UpdateChecksum() failed on buffer chain\n");
+
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+}
+
+void TestMessageChecksumPerformance(void)
+{
+    const uint16_t kLengths[]  = {64, 127, 1280};
+    const uint32_t kIterations = 20000;
+
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          buffer[1280];
+    uint16_t         checksum = 0;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    printf("TestMessageChecksumPerformance\n");
+
+    for (unsigned i = 0; i < sizeof(kLengths) / sizeof(kLengths[0]); i++)
+    {
+        uint16_t length = kLengths[i];
+        uint64_t startTime;
+        uint64_t referenceDuration;
+        uint64_t flatDuration;
+        uint64_t messageDuration;
+
+        VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(length), "Message::SetLength failed\n");
+        VerifyOrQuit(message->Write(0, length, buffer) == length, "Message::Write failed\n");
+
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kIterations; j++)
+        {
+            checksum = ReferenceChecksum(checksum, buffer, length, 0);
+        }
+
+        referenceDuration = testGetHostTimeUsec() - startTime;
+        startTime         = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kIterations; j++)
+        {
+            checksum = ot::Message::UpdateChecksum(checksum, buffer, length);
+        }
+
+        flatDuration = testGetHostTimeUsec() - startTime;
+        startTime    = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kIterations; j++)
+        {
+            checksum = message->UpdateChecksum(checksum, static_cast<uint16_t>(0), length);
+        }
+
+        messageDuration = testGetHostTimeUsec() - startTime;
+
+        printf("  %4u bytes: byte-at-a-time %7.1f ns, flat buffer %7.1f ns, buffer chain %7.1f ns\n", length,
+               (referenceDuration * 1000.0) / kIterations, (flatDuration * 1000.0) / kIterations,
+               (messageDuration * 1000.0) / kIterations);
+
+        message->Free();
+    }
+
+    // Use the result so that the checksum loops are not optimized out.
+    printf("  (checksum 0x%04x)\n", checksum);
+
+    testFreeInstance(instance);
+}
+
+void TestMessageFragmentReadPerformance(void)
+{
+    // Fragment payload sizes of a 127-byte frame without and with a mesh header (see `PrepareDataFrame()`).
+    const uint16_t kFragmentLengths[] = {96, 80};
+    const uint16_t kLength            = 1280;
+    const uint32_t kIterations        = 20000;
+
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          buffer[kLength];
+    uint8_t          frame[kLength];
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(kLength), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, kLength, buffer) == kLength, "Message::Write failed\n");
+
+    printf("TestMessageFragmentReadPerformance\n");
+
+    for (unsigned i = 0; i < sizeof(kFragmentLengths) / sizeof(kFragmentLengths[0]); i++)
+    {
+        uint16_t fragmentLength = kFragmentLengths[i];
+        uint64_t startTime;
+        uint64_t seekDuration;
+        uint64_t walkDuration;
+
+        // Each fragment seeks to its offset from the head buffer, as one frame is prepared per transmission.
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kIterations; j++)
+        {
+            for (uint16_t offset = 0; offset < kLength; offset += fragmentLength)
+            {
+                uint16_t           length = fragmentLength;
+                uint8_t *          cur    = frame + offset;
+                ot::Message::Chunk chunk;
+
+                for (message->GetFirstChunk(offset, length, chunk); chunk.GetLength() > 0;
+                     message->GetNextChunk(length, chunk))
+                {
+                    memcpy(cur, chunk.GetData(), chunk.GetLength());
+                    cur += chunk.GetLength();
+                }
+            }
+        }
+
+        seekDuration = testGetHostTimeUsec() - startTime;
+        VerifyOrQuit(memcmp(frame, buffer, kLength) == 0, "Fragment copy failed\n");
+        memset(frame, 0, sizeof(frame));
+
+        // Lower bound: a single walk of the buffer chain, as if a chunk cursor was kept across fragments.
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t j = 0; j < kIterations; j++)
+        {
+            uint16_t           length = kLength;
+            uint8_t *          cur    = frame;
+            ot::Message::Chunk chunk;
+
+            for (message->GetFirstChunk(0, length, chunk); chunk.GetLength() > 0; message->GetNextChunk(length, chunk))
+            {
+                memcpy(cur, chunk.GetData(), chunk.GetLength());
+                cur += chunk.GetLength();
+            }
+        }
+
+        walkDuration = testGetHostTimeUsec() - startTime;
+        VerifyOrQuit(memcmp(frame, buffer, kLength) == 0, "Message copy failed\n");
+
+        printf("  %4u bytes in %2u-byte fragments: seek per fragment %7.1f ns, single walk %7.1f ns\n", kLength,
+               fragmentLength, (seekDuration * 1000.0) / kIterations, (walkDuration * 1000.0) / kIterations);
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMessage();
+    TestMessageChunks();
+    TestMessageBufferPool();
+    TestMessageChecksum();
+    TestMessageChecksumPerformance();
+    TestMessageFragmentReadPerformance();
     printf("All tests passed\n");
     return 0;
 }
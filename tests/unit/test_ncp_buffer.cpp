@@ -32,6 +32,7 @@
 #include "common/instance.hpp"
 #include "common/message.hpp"
 #include "common/random.hpp"
+#include "ncp/hdlc.hpp"
 #include "ncp/ncp_buffer.hpp"
 
 #include "test_platform.h"
@@ -1095,6 +1096,120 @@ void TestFuzzNcpFrameBuffer(void)
     testFreeInstance(sInstance);
 }
 
+// Adds a `STREAM_NET`-like frame to the ncp buffer: a short header followed by a datagram message.
+static void WriteDatagramFrame(NcpFrameBuffer &aNcpBuffer, const uint8_t *aDatagram, uint16_t aLength)
+{
+    Message *message;
+
+    message = sMessagePool->New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != NULL, "Null Message");
+    SuccessOrQuit(message->SetLength(aLength), "Could not set the length of message.");
+    message->Write(0, aLength, aDatagram);
+
+    aNcpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
+    SuccessOrQuit(aNcpBuffer.InFrameFeedData(sHexText, 4), "InFrameFeedData() failed.");
+    SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message), "InFrameFeedMessage() failed.");
+    SuccessOrQuit(aNcpBuffer.InFrameEnd(), "InFrameEnd() failed.");
+}
+
+void TestNcpFrameBufferThroughput(void)
+{
+    enum
+    {
+        kDatagramLength = 1280,
+        kFrameLength    = 4 + kDatagramLength,
+        kNumFrames      = 20000,
+        kHdlcBufferSize = 2 * kFrameLength + 4, // Worst case, every byte escaped.
+    };
+
+    uint8_t                            buffer[kTestBufferSize];
+    NcpFrameBuffer                     ncpBuffer(buffer, kTestBufferSize);
+    uint8_t                            datagram[kDatagramLength];
+    uint8_t                            readBuffer[kFrameLength];
+    Hdlc::FrameBuffer<kHdlcBufferSize> hdlcBuffer;
+    Hdlc::Encoder                      encoder(hdlcBuffer);
+    uint16_t                           readLength;
+    uint64_t                           startTime;
+    uint64_t                           duration;
+
+    sInstance    = testInitInstance();
+    sMessagePool = &sInstance->Get<MessagePool>();
+
+    for (uint16_t i = 0; i < kDatagramLength; i++)
+    {
+        datagram[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+    }
+
+    // Verify that a datagram spanning several message buffers is read correctly, in chunks of different sizes.
+    for (uint16_t chunkLength = 1; chunkLength <= kFrameLength; chunkLength = chunkLength * 3 + 2)
+    {
+        WriteDatagramFrame(ncpBuffer, datagram, kDatagramLength);
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+        VerifyOrQuit(ncpBuffer.OutFrameGetLength() == kFrameLength, "OutFrameGetLength() failed.");
+
+        for (readLength = 0; !ncpBuffer.OutFrameHasEnded();)
+        {
+            readLength += ncpBuffer.OutFrameRead(chunkLength, readBuffer + readLength);
+        }
+
+        VerifyOrQuit(readLength == kFrameLength, "OutFrameRead() read wrong number of bytes.");
+        VerifyOrQuit(memcmp(readBuffer, sHexText, 4) == 0, "OutFrameRead() read wrong header.");
+        VerifyOrQuit(memcmp(readBuffer + 4, datagram, kDatagramLength) == 0, "OutFrameRead() read wrong datagram.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+        ReadAndVerifyContent(ncpBuffer, readBuffer, kFrameLength);
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded(), "Out frame did not end.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
+    }
+
+    VerifyOrQuit(ncpBuffer.IsEmpty(), "IsEmpty() failed.");
+
+    // Saturate the buffer with datagram frames and HDLC encode them byte by byte, as done by the UART NCP.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t frame = 0; frame < kNumFrames; frame++)
+    {
+        WriteDatagramFrame(ncpBuffer, datagram, kDatagramLength);
+
+        hdlcBuffer.Clear();
+        SuccessOrQuit(encoder.BeginFrame(), "Encoder::BeginFrame() failed");
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+
+        while (!ncpBuffer.OutFrameHasEnded())
+        {
+            SuccessOrQuit(encoder.Encode(ncpBuffer.OutFrameReadByte()), "Encoder::Encode() failed");
+        }
+
+        SuccessOrQuit(encoder.EndFrame(), "Encoder::EndFrame() failed");
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
+    }
+
+    duration = testGetHostTimeUsec() - startTime + 1;
+
+    printf("\nTestNcpFrameBufferThroughput: HDLC encoded %9.0f KB/sec",
+           static_cast<double>(kNumFrames) * kFrameLength * 1000000 / duration / 1024);
+
+    // Read the frames in one go into a frame buffer, as done by the SPI NCP.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t frame = 0; frame < kNumFrames; frame++)
+    {
+        WriteDatagramFrame(ncpBuffer, datagram, kDatagramLength);
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed.");
+        VerifyOrQuit(ncpBuffer.OutFrameRead(sizeof(readBuffer), readBuffer) == kFrameLength, "OutFrameRead() failed.");
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "OutFrameRemove() failed.");
+    }
+
+    duration = testGetHostTimeUsec() - startTime + 1;
+
+    printf("\nTestNcpFrameBufferThroughput: read         %9.0f KB/sec, sizeof(NcpFrameBuffer) %u bytes\n",
+           static_cast<double>(kNumFrames) * kFrameLength * 1000000 / duration / 1024,
+           static_cast<unsigned>(sizeof(NcpFrameBuffer)));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace Ncp
 } // namespace ot
 
@@ -1103,6 +1218,7 @@ int main(void)
 {
     ot::Ncp::TestNcpFrameBuffer();
     ot::Ncp::TestFuzzNcpFrameBuffer();
+    ot::Ncp::TestNcpFrameBufferThroughput();
     printf("\nAll tests passed.\n");
     return 0;
 }
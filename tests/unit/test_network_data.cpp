@@ -30,6 +30,8 @@
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 
 #include "test_platform.h"
@@ -171,12 +173,373 @@ void TestNetworkDataIterator(void)
     testFreeInstance(instance);
 }
 
+// Builds stable Network Data TLVs, for the Leader lookup tests.
+class NetworkDataBuilder
+{
+public:
+    NetworkDataBuilder(void)
+        : mLength(0)
+        , mPrefix(NULL)
+        , mSubTlv(NULL)
+    {
+    }
+
+    void BeginPrefix(const char *aPrefix, uint8_t aPrefixLength)
+    {
+        Ip6::Address prefix;
+
+        SuccessOrQuit(prefix.FromString(aPrefix), "Ip6::Address::FromString() failed");
+
+        mPrefix = reinterpret_cast<NetworkData::PrefixTlv *>(&mTlvs[mLength]);
+        mPrefix->Init(0, aPrefixLength, prefix.mFields.m8);
+        mPrefix->SetStable();
+        SetEnd(mPrefix->GetNext());
+    }
+
+    void AddContext(uint8_t aContextId, bool aCompress, uint8_t aContextLength)
+    {
+        NetworkData::ContextTlv *context = reinterpret_cast<NetworkData::ContextTlv *>(&mTlvs[mLength]);
+
+        context->Init();
+        context->SetStable();
+        context->SetContextId(aContextId);
+        context->SetContextLength(aContextLength);
+
+        if (aCompress)
+        {
+            context->SetCompress();
+        }
+
+        SetEnd(context->GetNext());
+    }
+
+    void BeginBorderRouter(void)
+    {
+        mSubTlv = reinterpret_cast<NetworkData::NetworkDataTlv *>(&mTlvs[mLength]);
+        static_cast<NetworkData::BorderRouterTlv *>(mSubTlv)->Init();
+        mSubTlv->SetStable();
+        SetEnd(mSubTlv->GetNext());
+    }
+
+    void AddBorderRouterEntry(uint16_t aRloc16, int8_t aPreference, uint8_t aFlags)
+    {
+        NetworkData::BorderRouterEntry *entry = reinterpret_cast<NetworkData::BorderRouterEntry *>(&mTlvs[mLength]);
+
+        entry->Init();
+        entry->SetRloc(aRloc16);
+        entry->SetFlags(aFlags);
+        entry->SetPreference(aPreference);
+        AddEntry(sizeof(*entry));
+    }
+
+    void BeginHasRoute(void)
+    {
+        mSubTlv = reinterpret_cast<NetworkData::NetworkDataTlv *>(&mTlvs[mLength]);
+        static_cast<NetworkData::HasRouteTlv *>(mSubTlv)->Init();
+        mSubTlv->SetStable();
+        SetEnd(mSubTlv->GetNext());
+    }
+
+    void AddHasRouteEntry(uint16_t aRloc16, int8_t aPreference)
+    {
+        NetworkData::HasRouteEntry *entry = reinterpret_cast<NetworkData::HasRouteEntry *>(&mTlvs[mLength]);
+
+        entry->Init();
+        entry->SetRloc(aRloc16);
+        entry->SetPreference(aPreference);
+        AddEntry(sizeof(*entry));
+    }
+
+    void EndPrefix(void)
+    {
+        mPrefix->SetSubTlvsLength(
+            static_cast<uint8_t>(&mTlvs[mLength] - reinterpret_cast<uint8_t *>(mPrefix->GetSubTlvs())));
+    }
+
+    uint8_t GetSpace(void) const { return NetworkData::NetworkData::kMaxSize - mLength; }
+
+    // Sets the built TLVs as the Leader Network Data, as received in an MLE Network Data TLV.
+    void SetLeaderNetworkData(Instance &aInstance)
+    {
+        Message *message = aInstance.Get<MessagePool>().New(Message::kTypeIp6, 0);
+        Mle::Tlv tlv;
+
+        VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+
+        tlv.SetType(Mle::Tlv::kNetworkData);
+        tlv.SetLength(mLength);
+        SuccessOrQuit(message->Append(&tlv, sizeof(tlv)), "Message::Append() failed");
+        SuccessOrQuit(message->Append(mTlvs, mLength), "Message::Append() failed");
+
+        SuccessOrQuit(aInstance.Get<NetworkData::Leader>().SetNetworkData(1, 1, false, *message, 0),
+                      "SetNetworkData() failed");
+
+        message->Free();
+    }
+
+private:
+    void SetEnd(NetworkData::NetworkDataTlv *aNext)
+    {
+        mLength = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(aNext) - mTlvs);
+    }
+
+    void AddEntry(uint8_t aEntrySize)
+    {
+        mSubTlv->SetLength(mSubTlv->GetLength() + aEntrySize);
+        mLength += aEntrySize;
+    }
+
+    uint8_t                      mTlvs[NetworkData::NetworkData::kMaxSize];
+    uint8_t                      mLength;
+    NetworkData::PrefixTlv *     mPrefix;
+    NetworkData::NetworkDataTlv *mSubTlv;
+};
+
+static Ip6::Address MakeAddress(const char *aString)
+{
+    Ip6::Address address;
+
+    SuccessOrQuit(address.FromString(aString), "Ip6::Address::FromString() failed");
+
+    return address;
+}
+
+void TestNetworkDataLeaderLookup(void)
+{
+    const uint8_t kOnMeshFlags =
+        NetworkData::BorderRouterEntry::kOnMeshFlag | NetworkData::BorderRouterEntry::kDefaultRouteFlag;
+
+    ot::Instance *     instance;
+    NetworkDataBuilder builder;
+    Lowpan::Context    context;
+    uint8_t            prefixMatch;
+    uint16_t           rloc16;
+    const Ip6::Address source = MakeAddress("fd00:1234::1");
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    NetworkData::Leader &leader = instance->Get<NetworkData::Leader>();
+
+    printf("\nTest #3: Leader Network Data lookups");
+    printf("\n-------------------------------------------------");
+
+    // On-mesh prefix with a compressed context and a default route.
+    builder.BeginPrefix("fd00:1234::", 64);
+    builder.AddContext(1, true, 64);
+    builder.BeginBorderRouter();
+    builder.AddBorderRouterEntry(0x1000, 0, kOnMeshFlags);
+    builder.EndPrefix();
+
+    // Shorter prefix with an uncompressed context only.
+    builder.BeginPrefix("fd00:1234::", 48);
+    builder.AddContext(2, false, 48);
+    builder.EndPrefix();
+
+    // External routes, the longer one preferred.
+    builder.BeginPrefix("fd00:abcd::", 32);
+    builder.BeginHasRoute();
+    builder.AddHasRouteEntry(0x2000, 0);
+    builder.AddHasRouteEntry(0x3000, 0);
+    builder.EndPrefix();
+
+    builder.BeginPrefix("fd00:abcd:1::", 48);
+    builder.BeginHasRoute();
+    builder.AddHasRouteEntry(0x4000, 1);
+    builder.EndPrefix();
+
+    builder.SetLeaderNetworkData(*instance);
+
+    SuccessOrQuit(leader.GetContext(MakeAddress("fd00:1234::1"), context), "GetContext() failed");
+    VerifyOrQuit(context.mContextId == 1 && context.mPrefixLength == 64 && context.mCompressFlag,
+                 "GetContext() did not return the longest prefix");
+
+    SuccessOrQuit(leader.GetContext(MakeAddress("fd00:1234:0:1::1"), context), "GetContext() failed");
+    VerifyOrQuit(context.mContextId == 2 && context.mPrefixLength == 48 && !context.mCompressFlag,
+                 "GetContext() did not return the matching prefix");
+
+    SuccessOrQuit(leader.GetContext(instance->Get<Mle::MleRouter>().GetMeshLocal16(), context), "GetContext() failed");
+    VerifyOrQuit(context.mContextId == Mle::kMeshLocalPrefixContextId, "GetContext() did not return mesh-local");
+
+    VerifyOrQuit(leader.GetContext(MakeAddress("fd00:abcd::1"), context) == OT_ERROR_NOT_FOUND,
+                 "GetContext() found a prefix without a context");
+
+    SuccessOrQuit(leader.GetContext(2, context), "GetContext(id) failed");
+    VerifyOrQuit(context.mPrefixLength == 48 && memcmp(context.mPrefix, source.mFields.m8, 6) == 0,
+                 "GetContext(id) returned the wrong prefix");
+    VerifyOrQuit(leader.GetContext(3, context) == OT_ERROR_NOT_FOUND, "GetContext(id) found an unused context");
+
+    VerifyOrQuit(leader.IsOnMesh(MakeAddress("fd00:1234::2")), "IsOnMesh() failed for on-mesh prefix");
+    VerifyOrQuit(!leader.IsOnMesh(MakeAddress("fd00:1234:0:1::1")), "IsOnMesh() true for context-only prefix");
+    VerifyOrQuit(!leader.IsOnMesh(MakeAddress("fd00:abcd::1")), "IsOnMesh() true for external route");
+    VerifyOrQuit(leader.IsOnMesh(instance->Get<Mle::MleRouter>().GetMeshLocal16()), "IsOnMesh() false for mesh-local");
+
+    SuccessOrQuit(leader.RouteLookup(source, MakeAddress("fd00:abcd:1::1"), &prefixMatch, &rloc16),
+                  "RouteLookup() failed");
+    VerifyOrQuit(rloc16 == 0x4000 && prefixMatch == 48, "RouteLookup() did not select the longest external route");
+
+    SuccessOrQuit(leader.RouteLookup(source, MakeAddress("fd00:abcd:2::1"), &prefixMatch, &rloc16),
+                  "RouteLookup() failed");
+    VerifyOrQuit(rloc16 == 0x2000 && prefixMatch == 32, "RouteLookup() did not select the first external route");
+
+    SuccessOrQuit(leader.RouteLookup(source, MakeAddress("2001:db8::1"), &prefixMatch, &rloc16),
+                  "RouteLookup() failed");
+    VerifyOrQuit(rloc16 == 0x1000 && prefixMatch == 0, "RouteLookup() did not select the default route");
+
+    VerifyOrQuit(leader.RouteLookup(MakeAddress("2001:db8::2"), MakeAddress("2001:db8::1"), NULL, &rloc16) ==
+                     OT_ERROR_NO_ROUTE,
+                 "RouteLookup() found a route for an unknown source");
+
+    // Changing the Network Data must be reflected by the next lookup.
+    builder = NetworkDataBuilder();
+    builder.BeginPrefix("fd00:1234::", 64);
+    builder.AddContext(3, true, 64);
+    builder.EndPrefix();
+    builder.SetLeaderNetworkData(*instance);
+
+    VerifyOrQuit(leader.GetContext(2, context) == OT_ERROR_NOT_FOUND, "GetContext(id) used stale Network Data");
+    SuccessOrQuit(leader.GetContext(MakeAddress("fd00:1234::1"), context), "GetContext() failed");
+    VerifyOrQuit(context.mContextId == 3, "GetContext() used stale Network Data");
+    VerifyOrQuit(!leader.IsOnMesh(MakeAddress("fd00:1234::2")), "IsOnMesh() used stale Network Data");
+
+    // A context prefix longer than 64 bits, including one within the mesh-local prefix.
+    builder.BeginPrefix("fd00:1234:0:0:1::", 80);
+    builder.AddContext(4, true, 80);
+    builder.EndPrefix();
+    builder.BeginPrefix("fdde:ad00:beef:0:1::", 80);
+    builder.AddContext(5, true, 80);
+    builder.EndPrefix();
+    builder.SetLeaderNetworkData(*instance);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        SuccessOrQuit(leader.GetContext(MakeAddress("fd00:1234::1:0:0:1"), context), "GetContext() failed");
+        VerifyOrQuit(context.mContextId == 4 && context.mPrefixLength == 80, "GetContext() missed the /80 prefix");
+
+        SuccessOrQuit(leader.GetContext(MakeAddress("fd00:1234::2:0:0:1"), context), "GetContext() failed");
+        VerifyOrQuit(context.mContextId == 3 && context.mPrefixLength == 64, "GetContext() missed the /64 prefix");
+
+        SuccessOrQuit(leader.GetContext(MakeAddress("fdde:ad00:beef:0:1::1"), context), "GetContext() failed");
+        VerifyOrQuit(context.mContextId == 5, "GetContext() did not override the mesh-local prefix");
+
+        SuccessOrQuit(leader.GetContext(MakeAddress("fdde:ad00:beef:0:2::1"), context), "GetContext() failed");
+        VerifyOrQuit(context.mContextId == Mle::kMeshLocalPrefixContextId, "GetContext() did not return mesh-local");
+    }
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(instance);
+}
+
+void TestNetworkDataLeaderLookupPerformance(void)
+{
+    enum
+    {
+        kNumOnMeshPrefixes = 6,
+        kNumExternalRoutes = 3,
+        kMaxAddresses      = 32,
+        kPerfIteration     = 100000,
+    };
+
+    ot::Instance *     instance;
+    NetworkDataBuilder builder;
+    Ip6::Address       addresses[kMaxAddresses];
+    uint8_t            numAddresses = 0;
+    uint8_t            numPrefixes  = 0;
+    uint8_t            numRouters   = 0;
+    uint32_t           numRouted    = 0;
+    char               string[40];
+    uint64_t           startTime;
+    uint64_t           duration;
+    Lowpan::Context    context;
+    uint16_t           rloc16;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    NetworkData::Leader &leader = instance->Get<NetworkData::Leader>();
+
+    // Thread Network Data is limited to 255 bytes, so fill it with as many prefixes and border routers as fit.
+
+    for (uint8_t i = 0; i < kNumOnMeshPrefixes; i++)
+    {
+        snprintf(string, sizeof(string), "fd00:%x::", 0x1000 + i);
+        builder.BeginPrefix(string, 64);
+        builder.AddContext(i + 1, true, 64);
+        builder.BeginBorderRouter();
+        builder.AddBorderRouterEntry(static_cast<uint16_t>(0x0400 * (numRouters++ + 1)), 0,
+                                     NetworkData::BorderRouterEntry::kOnMeshFlag |
+                                         NetworkData::BorderRouterEntry::kDefaultRouteFlag);
+        builder.AddBorderRouterEntry(static_cast<uint16_t>(0x0400 * (numRouters++ + 1)), 0,
+                                     NetworkData::BorderRouterEntry::kOnMeshFlag);
+        builder.EndPrefix();
+        numPrefixes++;
+
+        snprintf(string, sizeof(string), "fd00:%x::%x", 0x1000 + i, 0x100 + i);
+        addresses[numAddresses++] = MakeAddress(string);
+    }
+
+    while (builder.GetSpace() >= sizeof(NetworkData::PrefixTlv) + 6 + sizeof(NetworkData::HasRouteTlv) +
+                                     kNumExternalRoutes * sizeof(NetworkData::HasRouteEntry) &&
+           numAddresses < kMaxAddresses - 1)
+    {
+        snprintf(string, sizeof(string), "2001:db8:%x::", numPrefixes);
+        builder.BeginPrefix(string, 48);
+        builder.BeginHasRoute();
+
+        for (uint8_t i = 0; i < kNumExternalRoutes; i++)
+        {
+            builder.AddHasRouteEntry(static_cast<uint16_t>(0x0400 * (numRouters++ + 1)), 0);
+        }
+
+        builder.EndPrefix();
+
+        snprintf(string, sizeof(string), "2001:db8:%x::1", numPrefixes);
+        addresses[numAddresses++] = MakeAddress(string);
+        numPrefixes++;
+    }
+
+    addresses[numAddresses++] = MakeAddress("2001:db9::1");
+    builder.SetLeaderNetworkData(*instance);
+
+    printf("Test Leader lookup performance with %d prefixes and %d border router entries\n", numPrefixes, numRouters);
+
+    // Per forwarded datagram: the mesh forwarder checks on-mesh then routes, and 6LoWPAN compression looks up the
+    // source and destination contexts.
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        const Ip6::Address &source      = addresses[iter % kNumOnMeshPrefixes];
+        const Ip6::Address &destination = addresses[iter % numAddresses];
+
+        if (!leader.IsOnMesh(destination) && leader.RouteLookup(source, destination, NULL, &rloc16) == OT_ERROR_NONE)
+        {
+            numRouted++;
+        }
+
+        leader.GetContext(source, context);
+        leader.GetContext(destination, context);
+    }
+
+    duration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(numRouted > 0, "RouteLookup() failed to find a route");
+
+    printf("  %6.3f usec/datagram\n", static_cast<double>(duration) / kPerfIteration);
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestNetworkDataIterator();
+    ot::TestNetworkDataLeaderLookup();
+    ot::TestNetworkDataLeaderLookupPerformance();
 
     printf("\nAll tests passed\n");
     return 0;
@@ -101,6 +101,15 @@ void testFreeInstance(otInstance *aInstance)
 #endif
 }
 
+uint64_t testGetHostTimeUsec(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
 bool sDiagMode = false;
 
 extern "C" {
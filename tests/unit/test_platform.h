@@ -89,4 +89,7 @@ void          testFreeInstance(otInstance *aInstance);
 // Resets platform functions to defaults
 void testPlatResetToDefaults(void);
 
+// Returns the host time in microseconds (used to measure micro-benchmarks)
+uint64_t testGetHostTimeUsec(void);
+
 #endif // TEST_PLATFORM_H
@@ -323,10 +323,321 @@ void TestPriorityQueue(void)
     testFreeInstance(instance);
 }
 
+// This function verifies the direct and indirect sub-queues of the priority queue against the queue content.
+// The messages in each sub-queue are expected in the order given by `aStamps` (the time a message was added
+// to its current sub-queue), grouped by priority level.
+void VerifySubQueues(ot::PriorityQueue &aPriorityQueue, ot::Message **aMessages, const uint32_t *aStamps, int aCount)
+{
+    ot::Message *message;
+    int          index;
+    int          directIndex = -1;
+    int          numIndirect = 0;
+
+    for (int i = 0; i < aCount; i++)
+    {
+        if (!aMessages[i]->GetDirectTransmission())
+        {
+            numIndirect++;
+        }
+        else if ((directIndex < 0) || (aMessages[i]->GetPriority() > aMessages[directIndex]->GetPriority()) ||
+                 ((aMessages[i]->GetPriority() == aMessages[directIndex]->GetPriority()) &&
+                  (aStamps[i] < aStamps[directIndex])))
+        {
+            directIndex = i;
+        }
+    }
+
+    VerifyOrQuit(aPriorityQueue.GetHeadForDirectTx() == ((directIndex < 0) ? NULL : aMessages[directIndex]),
+                 "GetHeadForDirectTx() failed.\n");
+
+    for (uint8_t minPriority = 0; minPriority < ot::Message::kNumPriorities; minPriority++)
+    {
+        const ot::Message *prev = NULL;
+        int                count = 0;
+
+        for (message = aPriorityQueue.GetHeadForIndirectTx(minPriority); message != NULL;
+             message = aPriorityQueue.GetNextForIndirectTx(*message))
+        {
+            VerifyOrQuit(!message->GetDirectTransmission(), "Indirect sub-queue contains a direct message.\n");
+            VerifyOrQuit(message->GetPriority() >= minPriority, "GetHeadForIndirectTx() ignored min priority.\n");
+
+            for (index = 0; index < aCount && aMessages[index] != message; index++)
+            {
+            }
+
+            VerifyOrQuit(index < aCount, "Indirect sub-queue contains an unexpected message.\n");
+
+            if (prev != NULL)
+            {
+                int prevIndex;
+
+                for (prevIndex = 0; aMessages[prevIndex] != prev; prevIndex++)
+                {
+                }
+
+                VerifyOrQuit((prev->GetPriority() < message->GetPriority()) ||
+                                 ((prev->GetPriority() == message->GetPriority()) &&
+                                  (aStamps[prevIndex] < aStamps[index])),
+                             "Indirect sub-queue order is incorrect.\n");
+            }
+
+            prev = message;
+            count++;
+        }
+
+        if (minPriority == 0)
+        {
+            VerifyOrQuit(count == numIndirect, "Indirect sub-queue length is incorrect.\n");
+        }
+    }
+}
+
+void TestPriorityQueueSubQueues(void)
+{
+    enum
+    {
+        kNumMessages   = 12,
+        kNumIterations = 2000,
+    };
+
+    ot::Instance *    instance;
+    ot::MessagePool * messagePool;
+    ot::PriorityQueue queue;
+    ot::Message *     messages[kNumMessages];
+    uint32_t          stamps[kNumMessages];
+    bool              queued[kNumMessages];
+    ot::Message *     queuedMessages[kNumMessages];
+    uint32_t          queuedStamps[kNumMessages];
+    uint32_t          now = 0;
+
+    instance = testInitInstance();
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (int i = 0; i < kNumMessages; i++)
+    {
+        messages[i] = messagePool->New(ot::Message::kTypeIp6, 0, static_cast<uint8_t>(i % ot::Message::kNumPriorities));
+        VerifyOrQuit(messages[i] != NULL, "Message::New failed\n");
+        queued[i] = false;
+    }
+
+    // Randomly enqueue/dequeue messages, change their priority and their direct transmission flag, and check the
+    // sub-queues after each step.
+    for (int iter = 0; iter < kNumIterations; iter++)
+    {
+        int          index   = rand() % kNumMessages;
+        ot::Message &message = *messages[index];
+        int          count   = 0;
+
+        switch (rand() % 4)
+        {
+        case 0:
+            if (queued[index])
+            {
+                SuccessOrQuit(queue.Dequeue(message), "PriorityQueue::Dequeue() failed.\n");
+            }
+            else
+            {
+                SuccessOrQuit(queue.Enqueue(message), "PriorityQueue::Enqueue() failed.\n");
+                stamps[index] = now++;
+            }
+
+            queued[index] = !queued[index];
+            break;
+
+        case 1:
+        {
+            uint8_t priority = static_cast<uint8_t>(rand() % ot::Message::kNumPriorities);
+
+            if (priority != message.GetPriority())
+            {
+                SuccessOrQuit(message.SetPriority(priority), "Message::SetPriority() failed.\n");
+                stamps[index] = now++;
+            }
+
+            break;
+        }
+
+        default:
+            if (message.GetDirectTransmission())
+            {
+                message.ClearDirectTransmission();
+            }
+            else
+            {
+                message.SetDirectTransmission();
+            }
+
+            stamps[index] = now++;
+            break;
+        }
+
+        for (int i = 0; i < kNumMessages; i++)
+        {
+            if (queued[i])
+            {
+                queuedMessages[count] = messages[i];
+                queuedStamps[count]   = stamps[i];
+                count++;
+            }
+        }
+
+        VerifySubQueues(queue, queuedMessages, queuedStamps, count);
+    }
+
+    for (int i = 0; i < kNumMessages; i++)
+    {
+        if (queued[i])
+        {
+            SuccessOrQuit(queue.Dequeue(*messages[i]), "PriorityQueue::Dequeue() failed.\n");
+        }
+
+        messages[i]->Free();
+    }
+
+    VerifyPriorityQueueContent(queue, 0);
+    VerifyOrQuit(queue.GetHeadForDirectTx() == NULL, "GetHeadForDirectTx() non-NULL when empty.\n");
+    VerifyOrQuit(queue.GetHeadForIndirectTx(0) == NULL, "GetHeadForIndirectTx() non-NULL when empty.\n");
+
+    testFreeInstance(instance);
+}
+
+// Messages used by the stress test are not allocated from the message pool,
+// since it only holds `OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS` buffers.
+static ot::Buffer sStressBuffers[4096];
+
+void TestPriorityQueuePerformance(void)
+{
+    const int      kNumMessages    = static_cast<int>(OT_ARRAY_LENGTH(sStressBuffers));
+    const int      kNumDirect      = kNumMessages / 2;
+    const uint32_t kNumOperations  = 20000;
+    const uint32_t kNumScanSamples = 200;
+
+    ot::PriorityQueue queue;
+    ot::Message *     message;
+    uint64_t          startTime;
+    uint64_t          scanDuration;
+    uint64_t          directDuration;
+    uint64_t          dequeueDuration;
+    uint64_t          evictScanDuration;
+    uint64_t          evictDuration;
+    uintptr_t         sum = 0;
+
+    printf("TestPriorityQueuePerformance\n");
+
+    // Queue indirect messages (e.g. for sleepy children) on the higher priority levels, and direct transmission
+    // messages on the lowest priority level. This is the worst case for a linear scan looking for either kind.
+    for (int i = 0; i < kNumMessages; i++)
+    {
+        message = static_cast<ot::Message *>(&sStressBuffers[i]);
+        memset(message, 0, sizeof(*message));
+
+        if (i < kNumDirect)
+        {
+            SuccessOrQuit(message->SetPriority(ot::Message::kPriorityLow), "Message::SetPriority() failed.\n");
+            message->SetDirectTransmission();
+        }
+        else
+        {
+            SuccessOrQuit(message->SetPriority(static_cast<uint8_t>(1 + i % (ot::Message::kNumPriorities - 1))),
+                          "Message::SetPriority() failed.\n");
+            message->SetChildMask(0);
+        }
+
+        SuccessOrQuit(queue.Enqueue(*message), "PriorityQueue::Enqueue() failed.\n");
+    }
+
+    // Picking the next direct transmission: linear scan of the queue versus the direct sub-queue.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kNumScanSamples; i++)
+    {
+        for (message = queue.GetHead(); message != NULL && !message->GetDirectTransmission();
+             message = message->GetNext())
+        {
+        }
+
+        sum += reinterpret_cast<uintptr_t>(message);
+    }
+
+    scanDuration = testGetHostTimeUsec() - startTime;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kNumOperations; i++)
+    {
+        sum += reinterpret_cast<uintptr_t>(queue.GetHeadForDirectTx());
+    }
+
+    directDuration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(queue.GetHeadForDirectTx() == static_cast<ot::Message *>(&sStressBuffers[0]),
+                 "GetHeadForDirectTx() failed.\n");
+
+    // Dequeue the next direct transmission and enqueue it back (round robin through the direct messages).
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kNumOperations; i++)
+    {
+        message = queue.GetHeadForDirectTx();
+        SuccessOrQuit(queue.Dequeue(*message), "PriorityQueue::Dequeue() failed.\n");
+        SuccessOrQuit(queue.Enqueue(*message), "PriorityQueue::Enqueue() failed.\n");
+    }
+
+    dequeueDuration = testGetHostTimeUsec() - startTime;
+
+    // Picking an eviction victim at or above low priority: linear scan versus the indirect sub-queues.
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kNumScanSamples; i++)
+    {
+        for (message = queue.GetHeadForPriority(ot::Message::kPriorityLow);
+             message != NULL && message->GetDirectTransmission(); message = message->GetNext())
+        {
+        }
+
+        sum += reinterpret_cast<uintptr_t>(message);
+    }
+
+    evictScanDuration = testGetHostTimeUsec() - startTime;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t i = 0; i < kNumOperations; i++)
+    {
+        sum += reinterpret_cast<uintptr_t>(queue.GetHeadForIndirectTx(ot::Message::kPriorityLow));
+    }
+
+    evictDuration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(queue.GetHeadForIndirectTx(ot::Message::kPriorityLow) ==
+                     queue.GetHeadForPriority(ot::Message::kPriorityNormal),
+                 "GetHeadForIndirectTx() failed.\n");
+
+    printf("  %d messages: next direct tx scan %8.1f ns, sub-queue %5.1f ns, dequeue+enqueue %5.1f ns\n",
+           kNumMessages, (scanDuration * 1000.0) / kNumScanSamples, (directDuration * 1000.0) / kNumOperations,
+           (dequeueDuration * 1000.0) / kNumOperations);
+    printf("  %d messages: eviction victim scan %8.1f ns, sub-queue %5.1f ns\n", kNumMessages,
+           (evictScanDuration * 1000.0) / kNumScanSamples, (evictDuration * 1000.0) / kNumOperations);
+
+    // Use the result so that the loops are not optimized out.
+    printf("  (sum 0x%lx)\n", static_cast<unsigned long>(sum & 0xffff));
+
+    while ((message = queue.GetHead()) != NULL)
+    {
+        SuccessOrQuit(queue.Dequeue(*message), "PriorityQueue::Dequeue() failed.\n");
+    }
+
+    VerifyPriorityQueueContent(queue, 0);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestPriorityQueue();
+    TestPriorityQueueSubQueues();
+    TestPriorityQueuePerformance();
     printf("All tests passed\n");
     return 0;
 }
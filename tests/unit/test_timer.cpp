@@ -28,6 +28,8 @@
 
 #include "test_platform.h"
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/instance.hpp"
@@ -559,11 +561,265 @@ int TestTenTimers(void)
     return 0;
 }
 
+/**
+ * `CheckedTimer` sub-classes `ot::TimerMilli` and verifies from its handler that timers fire in order and not before
+ * their fire time.
+ */
+class CheckedTimer : public ot::TimerMilli
+{
+public:
+    CheckedTimer(ot::Instance &aInstance)
+        : ot::TimerMilli(aInstance, CheckedTimer::HandleTimerFired, NULL)
+        , mFiredCounter(0)
+    {
+    }
+
+    static void HandleTimerFired(ot::Timer &aTimer) { static_cast<CheckedTimer &>(aTimer).HandleTimerFired(); }
+
+    void HandleTimerFired(void)
+    {
+        VerifyOrQuit(!ot::TimerScheduler::IsStrictlyBefore(sNow, GetFireTime()),
+                     "CheckedTimer: Timer fired before its fire time.\n");
+        VerifyOrQuit(!sLastFireTimeValid || !ot::TimerScheduler::IsStrictlyBefore(GetFireTime(), sLastFireTime),
+                     "CheckedTimer: Timers fired out of order.\n");
+
+        sLastFireTime      = GetFireTime();
+        sLastFireTimeValid = true;
+        mFiredCounter++;
+    }
+
+    uint32_t GetFiredCounter(void) const { return mFiredCounter; }
+
+    static uint32_t sLastFireTime;
+    static bool     sLastFireTimeValid;
+
+private:
+    uint32_t mFiredCounter;
+};
+
+uint32_t CheckedTimer::sLastFireTime;
+bool     CheckedTimer::sLastFireTimeValid;
+
+static uint32_t sRandomSeed;
+
+static uint32_t TestRandom(void)
+{
+    sRandomSeed = sRandomSeed * 1103515245 + 12345;
+
+    return (sRandomSeed >> 8);
+}
+
+/**
+ * This function signals alarm fired until there is no more expired timer.
+ */
+static void FireExpiredTimers(ot::Instance &aInstance)
+{
+    while (sTimerOn && !ot::TimerScheduler::IsStrictlyBefore(sNow, sPlatT0 + sPlatDt))
+    {
+        otPlatAlarmMilliFired(&aInstance);
+    }
+}
+
+static uint32_t GetRandomInterval(void)
+{
+    uint32_t interval;
+
+    switch (TestRandom() % 4)
+    {
+    case 0:
+        interval = TestRandom() % 64;
+        break;
+    case 1:
+        interval = TestRandom() % 5000;
+        break;
+    case 2:
+        interval = TestRandom() % 1000000;
+        break;
+    default:
+        interval = TestRandom() % ot::Timer::kMaxDt;
+        break;
+    }
+
+    return interval;
+}
+
+/**
+ * Test the TimerScheduler's behavior with many timers randomly started, stopped and fired.
+ *
+ * `aTimeShift` is added to the start time. It can be used to check the behavior around a 32-bit wrap.
+ */
+static void ManyTimers(uint32_t aTimeShift)
+{
+    const uint32_t              kNumTimers = 500;
+    const uint32_t              kNumSteps  = 2000;
+    ot::Instance *              instance   = testInitInstance();
+    std::vector<CheckedTimer *> timers;
+
+    printf("TestManyTimers() with aTimeShift=%-10u ", aTimeShift);
+
+    InitTestTimer();
+    InitCounters();
+
+    sRandomSeed                      = aTimeShift + 1;
+    sNow                             = aTimeShift;
+    CheckedTimer::sLastFireTimeValid = false;
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        timers.push_back(new CheckedTimer(*instance));
+        timers[i]->Start(GetRandomInterval());
+    }
+
+    for (uint32_t step = 0; step < kNumSteps; step++)
+    {
+        CheckedTimer &timer = *timers[TestRandom() % kNumTimers];
+
+        switch (TestRandom() % 4)
+        {
+        case 0:
+            timer.Stop();
+            break;
+
+        case 1:
+            // Start the timer relative to a time in the past (it may already be expired).
+            timer.StartAt(sNow - (TestRandom() % 100), TestRandom() % 200);
+            break;
+
+        default:
+            timer.Start(GetRandomInterval());
+            break;
+        }
+
+        // Signal the alarm (if expired) after the timer changes, so the newly expired timers fire in order.
+        CheckedTimer::sLastFireTimeValid = false;
+        FireExpiredTimers(*instance);
+
+        sNow += TestRandom() % 1000;
+        FireExpiredTimers(*instance);
+
+        for (uint32_t i = 0; i < kNumTimers; i++)
+        {
+            VerifyOrQuit(!timers[i]->IsRunning() ||
+                             ot::TimerScheduler::IsStrictlyBefore(sNow, timers[i]->GetFireTime()),
+                         "TestManyTimers: Expired timer did not fire.\n");
+        }
+    }
+
+    // Move the time forward until all timers are fired.
+
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        sNow += ot::Timer::kMaxDt / 4;
+        FireExpiredTimers(*instance);
+    }
+
+    VerifyOrQuit(!sTimerOn, "TestManyTimers: Platform Timer State Failed.\n");
+
+    for (uint32_t i = 0; i < kNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i]->IsRunning(), "TestManyTimers: Timer running Failed.\n");
+        delete timers[i];
+    }
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+}
+
+int TestManyTimers(void)
+{
+    const uint32_t kTimeShift[] = {
+        0, 100000U, 0U - 1U, 0U - 1100U, 0U - 3000000U, ot::Timer::kMaxDt, ot::Timer::kMaxDt + 1020U,
+    };
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(kTimeShift); i++)
+    {
+        ManyTimers(kTimeShift[i]);
+    }
+
+    return 0;
+}
+
+/**
+ * Measure the cost of starting (re-arming) and firing timers with different numbers of running timers.
+ */
+int TestTimerPerformance(void)
+{
+    const uint32_t kNumTimers[] = {10, 100, 1000};
+    const uint32_t kNumStarts   = 100000;
+
+    printf("TestTimerPerformance()\n");
+
+    for (size_t n = 0; n < OT_ARRAY_LENGTH(kNumTimers); n++)
+    {
+        ot::Instance *           instance  = testInitInstance();
+        uint32_t                 numTimers = kNumTimers[n];
+        std::vector<TestTimer *> timers;
+        uint64_t                 startTime;
+        uint64_t                 startDuration;
+        uint64_t                 fireDuration;
+
+        InitTestTimer();
+        InitCounters();
+
+        sRandomSeed = numTimers;
+        sNow        = 1000;
+
+        for (uint32_t i = 0; i < numTimers; i++)
+        {
+            timers.push_back(new TestTimer(*instance));
+            timers[i]->Start(1 + TestRandom() % 60000);
+        }
+
+        startTime = testGetHostTimeUsec();
+
+        for (uint32_t i = 0; i < kNumStarts; i++)
+        {
+            timers[i % numTimers]->Start(1 + TestRandom() % 60000);
+        }
+
+        startDuration = testGetHostTimeUsec() - startTime;
+
+        fireDuration = 0;
+
+        for (uint32_t i = 0; i < kNumStarts / numTimers; i++)
+        {
+            for (uint32_t j = 0; j < numTimers; j++)
+            {
+                timers[j]->Start(1 + TestRandom() % 60000);
+            }
+
+            sNow += 60000;
+
+            startTime = testGetHostTimeUsec();
+            FireExpiredTimers(*instance);
+            fireDuration += testGetHostTimeUsec() - startTime;
+        }
+
+        VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == (kNumStarts / numTimers) * numTimers,
+                     "TestTimerPerformance: Handler CallCount Failed.\n");
+
+        printf("  %4u timers: start %6.1f ns/timer, fire %6.1f ns/timer\n", numTimers,
+               (startDuration * 1000.0) / kNumStarts, (fireDuration * 1000.0) / kNumStarts);
+
+        for (uint32_t i = 0; i < numTimers; i++)
+        {
+            delete timers[i];
+        }
+
+        testFreeInstance(instance);
+    }
+
+    return 0;
+}
+
 void RunTimerTests(void)
 {
     TestOneTimer();
     TestTwoTimers();
     TestTenTimers();
+    TestManyTimers();
+    TestTimerPerformance();
 }
 
 #ifdef ENABLE_TEST_MAIN
@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/tlvs.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "utils/wrap_string.h"
+
+namespace ot {
+
+enum
+{
+    kHeaderLength  = 59,    // IPv6, UDP and MLE security headers in front of the MLE TLVs
+    kMaxTlvLength  = 64,    // Maximum TLV length used when reading TLVs
+    kPerfIteration = 20000, // Number of messages parsed in the parsing benchmark
+};
+
+struct TlvInfo
+{
+    uint8_t  mType;
+    uint16_t mLength;
+};
+
+// Source Address, Leader Data and Route64 TLVs (24 routers).
+static const TlvInfo sAdvertisementTlvs[] = {
+    {Mle::Tlv::kSourceAddress, 2},
+    {Mle::Tlv::kLeaderData, 8},
+    {Mle::Tlv::kRoute, 33},
+};
+
+// TLVs looked up by `MleRouter::HandleAdvertisement()`.
+static const uint8_t sAdvertisementLookups[] = {
+    Mle::Tlv::kSourceAddress,
+    Mle::Tlv::kLeaderData,
+    Mle::Tlv::kRoute,
+    Mle::Tlv::kRoute,
+};
+
+// Child ID Request with three registered addresses.
+static const TlvInfo sChildIdRequestTlvs[] = {
+    {Mle::Tlv::kResponse, 8},
+    {Mle::Tlv::kLinkFrameCounter, 4},
+    {Mle::Tlv::kMleFrameCounter, 4},
+    {Mle::Tlv::kMode, 1},
+    {Mle::Tlv::kTimeout, 4},
+    {Mle::Tlv::kVersion, 2},
+    {Mle::Tlv::kAddressRegistration, 43},
+    {Mle::Tlv::kTlvRequest, 3},
+    {Mle::Tlv::kActiveTimestamp, 8},
+};
+
+// TLVs looked up by `MleRouter::HandleChildIdRequest()`.
+static const uint8_t sChildIdRequestLookups[] = {
+    Mle::Tlv::kResponse,        Mle::Tlv::kLinkFrameCounter, Mle::Tlv::kMleFrameCounter,
+    Mle::Tlv::kMode,            Mle::Tlv::kTimeout,          Mle::Tlv::kTlvRequest,
+    Mle::Tlv::kActiveTimestamp, Mle::Tlv::kPendingTimestamp, Mle::Tlv::kAddressRegistration,
+};
+
+static Message *NewTlvMessage(Instance &aInstance, const TlvInfo *aTlvs, uint8_t aNumTlvs)
+{
+    Message *message = aInstance.Get<MessagePool>().New(Message::kTypeIp6, 0);
+    uint8_t  value[kMaxTlvLength];
+
+    VerifyOrQuit(message != NULL, "MessagePool::New() failed");
+    SuccessOrQuit(message->SetLength(kHeaderLength), "Message::SetLength() failed");
+    message->SetOffset(kHeaderLength);
+
+    for (uint8_t i = 0; i < aNumTlvs; i++)
+    {
+        uint8_t header[2] = {aTlvs[i].mType, static_cast<uint8_t>(aTlvs[i].mLength)};
+
+        memset(value, aTlvs[i].mType, sizeof(value));
+        SuccessOrQuit(message->Append(header, sizeof(header)), "Message::Append() failed");
+        SuccessOrQuit(message->Append(value, aTlvs[i].mLength), "Message::Append() failed");
+    }
+
+    return message;
+}
+
+static void VerifyIndexMatchesScan(const TlvIndex &aIndex, const Message &aMessage)
+{
+    for (uint16_t type = 0; type <= 0xff; type++)
+    {
+        uint16_t indexOffset = 0;
+        uint16_t scanOffset  = 0;
+        otError  indexError  = aIndex.GetOffset(aMessage, static_cast<uint8_t>(type), indexOffset);
+        otError  scanError   = Tlv::GetOffset(aMessage, static_cast<uint8_t>(type), scanOffset);
+
+        VerifyOrQuit(indexError == scanError, "TlvIndex::GetOffset() error does not match Tlv::GetOffset()");
+        VerifyOrQuit(indexOffset == scanOffset, "TlvIndex::GetOffset() offset does not match Tlv::GetOffset()");
+    }
+}
+
+void TestTlvIndex(void)
+{
+    Instance *instance = testInitInstance();
+    Message * message;
+    Message * otherMessage;
+    TlvIndex  index;
+    uint8_t   bytes[300];
+    uint16_t  offset;
+
+    VerifyOrQuit(instance != NULL, "Null instance");
+
+    // Duplicate types, a type beyond the indexed range, an extended TLV and a truncated TLV at the end.
+
+    message = NewTlvMessage(*instance, sAdvertisementTlvs, OT_ARRAY_LENGTH(sAdvertisementTlvs));
+
+    memset(bytes, 0, sizeof(bytes));
+    bytes[0]  = Mle::Tlv::kLeaderData;
+    bytes[1]  = 3;
+    bytes[5]  = Mle::Tlv::kTimeParameter;
+    bytes[6]  = 1;
+    bytes[8]  = Mle::Tlv::kNetworkData;
+    bytes[9]  = 0xff;
+    bytes[10] = 0;
+    bytes[11] = 200;
+    SuccessOrQuit(message->Append(bytes, 212), "Message::Append() failed");
+
+    bytes[0] = Mle::Tlv::kChallenge;
+    bytes[1] = 8;
+    SuccessOrQuit(message->Append(bytes, 4), "Message::Append() failed");
+
+    index.Init(*message);
+    VerifyIndexMatchesScan(index, *message);
+    SuccessOrQuit(index.GetOffset(*message, Mle::Tlv::kNetworkData, offset), "Extended TLV not found");
+    VerifyOrQuit(index.GetOffset(*message, Mle::Tlv::kChallenge, offset) == OT_ERROR_NOT_FOUND,
+                 "Truncated TLV was found");
+
+    // Lookups for a message that is not indexed fall back to scanning.
+
+    otherMessage = NewTlvMessage(*instance, sChildIdRequestTlvs, OT_ARRAY_LENGTH(sChildIdRequestTlvs));
+    VerifyIndexMatchesScan(index, *otherMessage);
+
+    // A changed message offset invalidates the index.
+
+    message->MoveOffset(4);
+    VerifyIndexMatchesScan(index, *message);
+
+    index.Clear();
+    VerifyIndexMatchesScan(index, *message);
+
+    message->Free();
+    otherMessage->Free();
+    testFreeInstance(instance);
+}
+
+static void MeasureParsing(Instance &     aInstance,
+                           const char *   aName,
+                           const TlvInfo *aTlvs,
+                           uint8_t        aNumTlvs,
+                           const uint8_t *aLookups,
+                           uint8_t        aNumLookups)
+{
+    Message *message = NewTlvMessage(aInstance, aTlvs, aNumTlvs);
+    TlvIndex index;
+    uint8_t  buffer[sizeof(Tlv) + kMaxTlvLength];
+    Tlv &    tlv = *reinterpret_cast<Tlv *>(buffer);
+    uint32_t sum = 0;
+    uint64_t startTime;
+    uint64_t scanDuration;
+    uint64_t indexDuration;
+
+    startTime = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        for (uint8_t i = 0; i < aNumLookups; i++)
+        {
+            if (Tlv::Get(*message, aLookups[i], sizeof(buffer), tlv) == OT_ERROR_NONE)
+            {
+                sum += tlv.GetLength();
+            }
+        }
+    }
+
+    scanDuration = testGetHostTimeUsec() - startTime;
+    startTime    = testGetHostTimeUsec();
+
+    for (uint32_t iter = 0; iter < kPerfIteration; iter++)
+    {
+        index.Init(*message);
+
+        for (uint8_t i = 0; i < aNumLookups; i++)
+        {
+            if (index.Get(*message, aLookups[i], sizeof(buffer), tlv) == OT_ERROR_NONE)
+            {
+                sum -= tlv.GetLength();
+            }
+        }
+    }
+
+    indexDuration = testGetHostTimeUsec() - startTime;
+
+    VerifyOrQuit(sum == 0, "TlvIndex::Get() does not match Tlv::Get()");
+
+    printf("  %-17s scan %6.3f usec/message, index %6.3f usec/message\n", aName,
+           static_cast<double>(scanDuration) / kPerfIteration, static_cast<double>(indexDuration) / kPerfIteration);
+
+    message->Free();
+}
+
+void TestTlvIndexPerformance(void)
+{
+    Instance *instance = testInitInstance();
+
+    VerifyOrQuit(instance != NULL, "Null instance");
+
+    MeasureParsing(*instance, "Advertisement", sAdvertisementTlvs, OT_ARRAY_LENGTH(sAdvertisementTlvs),
+                   sAdvertisementLookups, OT_ARRAY_LENGTH(sAdvertisementLookups));
+    MeasureParsing(*instance, "Child ID Request", sChildIdRequestTlvs, OT_ARRAY_LENGTH(sChildIdRequestTlvs),
+                   sChildIdRequestLookups, OT_ARRAY_LENGTH(sChildIdRequestLookups));
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestTlvIndex();
+    ot::TestTlvIndexPerformance();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
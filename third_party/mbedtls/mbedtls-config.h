@@ -42,6 +42,9 @@
 
 #define MBEDTLS_AES_C
 #define MBEDTLS_AES_ROM_TABLES
+#if OPENTHREAD_CONFIG_MBEDTLS_AESNI_ENABLE
+#define MBEDTLS_AESNI_C
+#endif
 #define MBEDTLS_ASN1_PARSE_C
 #define MBEDTLS_ASN1_WRITE_C
 #define MBEDTLS_BIGNUM_C